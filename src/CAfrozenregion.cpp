@@ -0,0 +1,130 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include "CAfrozenregion.hpp"
+
+#include "mpi.h"
+
+#include <iostream>
+#include <utility>
+
+//*****************************************************************************/
+// Replace a view with a copy of its values for all but the first FreezeSize cells. Views that were never sized to the
+// domain (MeltTimeStep without remelting) are left as is
+template <typename ViewType>
+void dropBottomCells(ViewType &CellView, int FreezeSize) {
+
+    int ViewSize = CellView.extent(0);
+    if (ViewSize == 0)
+        return;
+    ViewType ResidentView(Kokkos::ViewAllocateWithoutInitializing(CellView.label()), ViewSize - FreezeSize);
+    Kokkos::deep_copy(ResidentView, Kokkos::subview(CellView, std::make_pair(FreezeSize, ViewSize)));
+    CellView = ResidentView;
+}
+
+// Replace a view with one holding the values in FrozenValues_Host followed by the view's current values
+void prependBottomCells(ViewI &CellView, ViewI_H FrozenValues_Host) {
+
+    int FrozenSize = FrozenValues_Host.extent(0);
+    int ResidentSize = CellView.extent(0);
+    ViewI FullView(Kokkos::ViewAllocateWithoutInitializing(CellView.label()), FrozenSize + ResidentSize);
+    Kokkos::deep_copy(Kokkos::subview(FullView, std::make_pair(0, FrozenSize)), FrozenValues_Host);
+    Kokkos::deep_copy(Kokkos::subview(FullView, std::make_pair(FrozenSize, FrozenSize + ResidentSize)), CellView);
+    CellView = FullView;
+}
+
+//*****************************************************************************/
+// Move the GrainID and LayerID values for the bottom nzFreeze Z coordinates of cells still stored in the views into
+// the frozen region store, and shrink all views sized to the domain to the cells above them. Z coordinates of the
+// remaining cells are relative to the top of the frozen region afterwards
+void FreezeBottomCells(int id, FrozenRegion &Frozen, int nzFreeze, int nx, int MyYSlices, ViewI &GrainID,
+                       ViewI &LayerID, ViewI &CellType, ViewI &CritTimeStep, ViewF &UndercoolingChange,
+                       ViewF &UndercoolingCurrent, ViewI &MeltTimeStep) {
+
+    if (nzFreeze <= 0)
+        return;
+    int FreezeSize = nzFreeze * nx * MyYSlices;
+    std::pair<int, int> FreezeRange(0, FreezeSize);
+    ViewI_H GrainID_Host(Kokkos::ViewAllocateWithoutInitializing("GrainID_Host"), FreezeSize);
+    ViewI_H LayerID_Host(Kokkos::ViewAllocateWithoutInitializing("LayerID_Host"), FreezeSize);
+    Kokkos::deep_copy(GrainID_Host, Kokkos::subview(GrainID, FreezeRange));
+    Kokkos::deep_copy(LayerID_Host, Kokkos::subview(LayerID, FreezeRange));
+
+    // Append the lines of cells in X to the store, in order of Z coordinate and then Y coordinate
+    for (int k = 0; k < nzFreeze; k++) {
+        for (int j = 0; j < MyYSlices; j++) {
+            for (int i = 0; i < nx; i++) {
+                int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
+                int MyGrainID = GrainID_Host(D3D1ConvPosition);
+                int MyLayerID = LayerID_Host(D3D1ConvPosition);
+                // Extend the previous run if this cell continues it
+                if ((Frozen.RunLengthEncode) && (i > 0) && (Frozen.RunGrainID.back() == MyGrainID) &&
+                    (Frozen.RunLayerID.back() == MyLayerID))
+                    Frozen.RunLength.back()++;
+                else {
+                    Frozen.RunGrainID.push_back(MyGrainID);
+                    Frozen.RunLayerID.push_back(MyLayerID);
+                    if (Frozen.RunLengthEncode)
+                        Frozen.RunLength.push_back(1);
+                }
+            }
+            Frozen.LineStart.push_back(Frozen.RunGrainID.size());
+        }
+    }
+    Frozen.nzFrozen += nzFreeze;
+
+    // The frozen cells' data is no longer needed in the device views
+    dropBottomCells(GrainID, FreezeSize);
+    dropBottomCells(LayerID, FreezeSize);
+    dropBottomCells(CellType, FreezeSize);
+    dropBottomCells(CritTimeStep, FreezeSize);
+    dropBottomCells(UndercoolingChange, FreezeSize);
+    dropBottomCells(UndercoolingCurrent, FreezeSize);
+    dropBottomCells(MeltTimeStep, FreezeSize);
+
+    unsigned long int LocalRuns = Frozen.RunGrainID.size();
+    unsigned long int GlobalRuns;
+    MPI_Reduce(&LocalRuns, &GlobalRuns, 1, MPI_UNSIGNED_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+    if (id == 0)
+        std::cout << "Cells with Z coordinates 0 through " << Frozen.nzFrozen - 1
+                  << " are fully solidified and held in the frozen region store (" << GlobalRuns << " runs of cells)"
+                  << std::endl;
+}
+
+// Restore the cells in the frozen region store to the bottom of the GrainID and LayerID views, such that these views
+// again span the full domain, and empty the store
+void UnfreezeBottomCells(FrozenRegion &Frozen, int nx, int MyYSlices, ViewI &GrainID, ViewI &LayerID) {
+
+    if (Frozen.nzFrozen == 0)
+        return;
+    int FrozenSize = Frozen.nzFrozen * nx * MyYSlices;
+    ViewI_H GrainID_Host(Kokkos::ViewAllocateWithoutInitializing("GrainID_Host"), FrozenSize);
+    ViewI_H LayerID_Host(Kokkos::ViewAllocateWithoutInitializing("LayerID_Host"), FrozenSize);
+    for (int k = 0; k < Frozen.nzFrozen; k++) {
+        for (int j = 0; j < MyYSlices; j++) {
+            int LineNumber = k * MyYSlices + j;
+            int i = 0;
+            for (int Run = Frozen.LineStart[LineNumber]; Run < Frozen.LineStart[LineNumber + 1]; Run++) {
+                int MyRunLength = 1;
+                if (Frozen.RunLengthEncode)
+                    MyRunLength = Frozen.RunLength[Run];
+                for (int n = 0; n < MyRunLength; n++) {
+                    int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
+                    GrainID_Host(D3D1ConvPosition) = Frozen.RunGrainID[Run];
+                    LayerID_Host(D3D1ConvPosition) = Frozen.RunLayerID[Run];
+                    i++;
+                }
+            }
+        }
+    }
+    prependBottomCells(GrainID, GrainID_Host);
+    prependBottomCells(LayerID, LayerID_Host);
+
+    Frozen.nzFrozen = 0;
+    Frozen.LineStart.assign(1, 0);
+    Frozen.RunGrainID.clear();
+    Frozen.RunLayerID.clear();
+    Frozen.RunLength.clear();
+}
@@ -0,0 +1,36 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_FROZENREGION_HPP
+#define EXACA_FROZENREGION_HPP
+
+#include "CAtypes.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+// Host storage for cells at the bottom of an MPI rank's domain that finished solidifying and are below the melt pools
+// of all remaining layers. Only GrainID and LayerID are kept for these cells, either one value per cell or as runs of
+// consecutive cells in X with the same GrainID and LayerID
+struct FrozenRegion {
+    // Number of Z coordinates, starting from the bottom of the domain, held in the store
+    int nzFrozen = 0;
+    bool RunLengthEncode = true;
+    // Runs for the line of cells in X at Z coordinate k and Y coordinate j (line number k * MyYSlices + j) are stored
+    // at positions LineStart[line number] through LineStart[line number + 1] - 1. Without run length encoding, each run
+    // is a single cell and RunLength is unused
+    std::vector<int> LineStart = {0};
+    std::vector<int> RunGrainID;
+    std::vector<int> RunLayerID;
+    std::vector<int> RunLength;
+};
+
+void FreezeBottomCells(int id, FrozenRegion &Frozen, int nzFreeze, int nx, int MyYSlices, ViewI &GrainID,
+                       ViewI &LayerID, ViewI &CellType, ViewI &CritTimeStep, ViewF &UndercoolingChange,
+                       ViewF &UndercoolingCurrent, ViewI &MeltTimeStep);
+void UnfreezeBottomCells(FrozenRegion &Frozen, int nx, int MyYSlices, ViewI &GrainID, ViewI &LayerID);
+
+#endif
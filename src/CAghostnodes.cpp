@@ -11,28 +11,54 @@
 #include <cmath>
 #include <vector>
 
+//*****************************************************************************/
+// Create persistent send/recv requests for the 1D halo exchange. These are tied to the current buffer allocations, and
+// must be freed and recreated whenever the buffers are reallocated (i.e., at the start of each layer)
+void InitHaloRequests(int NeighborRank_North, int NeighborRank_South, Buffer2D BufferNorthSend,
+                      Buffer2D BufferSouthSend, Buffer2D BufferNorthRecv, Buffer2D BufferSouthRecv, int BufSizeX,
+                      int BufSizeZ, std::vector<MPI_Request> &SendRequests, std::vector<MPI_Request> &RecvRequests) {
+
+    SendRequests.assign(2, MPI_REQUEST_NULL);
+    RecvRequests.assign(2, MPI_REQUEST_NULL);
+    int BufCount = 5 * BufSizeX * BufSizeZ;
+
+    // Index 0 corresponds to the south neighbor, index 1 to the north neighbor
+    MPI_Send_init(BufferSouthSend.data(), BufCount, MPI_DOUBLE, NeighborRank_South, 0, MPI_COMM_WORLD,
+                  &SendRequests[0]);
+    MPI_Send_init(BufferNorthSend.data(), BufCount, MPI_DOUBLE, NeighborRank_North, 0, MPI_COMM_WORLD,
+                  &SendRequests[1]);
+    MPI_Recv_init(BufferSouthRecv.data(), BufCount, MPI_DOUBLE, NeighborRank_South, 0, MPI_COMM_WORLD,
+                  &RecvRequests[0]);
+    MPI_Recv_init(BufferNorthRecv.data(), BufCount, MPI_DOUBLE, NeighborRank_North, 0, MPI_COMM_WORLD,
+                  &RecvRequests[1]);
+}
+
+//*****************************************************************************/
+// Release persistent halo exchange requests (no-op for requests that were never created)
+void FreeHaloRequests(std::vector<MPI_Request> &SendRequests, std::vector<MPI_Request> &RecvRequests) {
+
+    for (auto &Request : SendRequests) {
+        if (Request != MPI_REQUEST_NULL)
+            MPI_Request_free(&Request);
+    }
+    for (auto &Request : RecvRequests) {
+        if (Request != MPI_REQUEST_NULL)
+            MPI_Request_free(&Request);
+    }
+}
+
 //*****************************************************************************/
 // 1D domain decomposition: update ghost nodes with new cell data from Nucleation and CellCapture routines
 void GhostNodes1D(int, int, int NeighborRank_North, int NeighborRank_South, int nx, int MyYSlices, int MyYOffset,
                   NList NeighborX, NList NeighborY, NList NeighborZ, ViewI CellType, ViewF DOCenter, ViewI GrainID,
                   ViewF GrainUnitVector, ViewF DiagonalLength, ViewF CritDiagonalLength, int NGrainOrientations,
-                  Buffer2D BufferNorthSend, Buffer2D BufferSouthSend, Buffer2D BufferNorthRecv,
-                  Buffer2D BufferSouthRecv, int BufSizeX, int BufSizeZ, int ZBound_Low) {
-
-    std::vector<MPI_Request> SendRequests(2, MPI_REQUEST_NULL);
-    std::vector<MPI_Request> RecvRequests(2, MPI_REQUEST_NULL);
-
-    // Send data to each other rank (MPI_Isend)
-    MPI_Isend(BufferSouthSend.data(), 5 * BufSizeX * BufSizeZ, MPI_DOUBLE, NeighborRank_South, 0, MPI_COMM_WORLD,
-              &SendRequests[0]);
-    MPI_Isend(BufferNorthSend.data(), 5 * BufSizeX * BufSizeZ, MPI_DOUBLE, NeighborRank_North, 0, MPI_COMM_WORLD,
-              &SendRequests[1]);
+                  Buffer2D, Buffer2D, Buffer2D BufferNorthRecv, Buffer2D BufferSouthRecv, int BufSizeX, int BufSizeZ,
+                  int ZBound_Low, int XBound_Low, int nxActive, int YBound_Low, int nyActive,
+                  std::vector<MPI_Request> &SendRequests, std::vector<MPI_Request> &RecvRequests) {
 
-    // Receive buffers for all neighbors (MPI_Irecv)
-    MPI_Irecv(BufferSouthRecv.data(), 5 * BufSizeX * BufSizeZ, MPI_DOUBLE, NeighborRank_South, 0, MPI_COMM_WORLD,
-              &RecvRequests[0]);
-    MPI_Irecv(BufferNorthRecv.data(), 5 * BufSizeX * BufSizeZ, MPI_DOUBLE, NeighborRank_North, 0, MPI_COMM_WORLD,
-              &RecvRequests[1]);
+    // Start the persistent receives and sends created by InitHaloRequests for the current buffers
+    MPI_Startall(2, RecvRequests.data());
+    MPI_Startall(2, SendRequests.data());
 
     // unpack in any order
     bool unpack_complete = false;
@@ -40,7 +66,8 @@ void GhostNodes1D(int, int, int NeighborRank_North, int NeighborRank_South, int
         // Get the next buffer to unpack from rank "unpack_index"
         int unpack_index = MPI_UNDEFINED;
         MPI_Waitany(2, RecvRequests.data(), &unpack_index, MPI_STATUS_IGNORE);
-        // If there are no more buffers to unpack, leave the while loop
+        // If there are no more buffers to unpack (persistent requests are inactive once completed), leave the while
+        // loop
         if (MPI_UNDEFINED == unpack_index) {
             unpack_complete = true;
         }
@@ -50,17 +77,17 @@ void GhostNodes1D(int, int, int NeighborRank_North, int NeighborRank_South, int
             Kokkos::parallel_for(
                 "BufferUnpack", RecvBufSize, KOKKOS_LAMBDA(const int &BufPosition) {
                     int RankX, RankY, RankZ, NewGrainID;
-                    long int CellLocation;
                     double DOCenterX, DOCenterY, DOCenterZ, NewDiagonalLength;
                     bool Place = false;
+                    // Buffers span the X extent of the active region
                     RankZ = BufPosition / BufSizeX;
-                    RankX = BufPosition % BufSizeX;
+                    int ActiveX = BufPosition % BufSizeX;
+                    RankX = ActiveX + XBound_Low;
                     // Which rank was the data received from?
                     if ((unpack_index == 0) && (NeighborRank_South != MPI_PROC_NULL)) {
                         // Data receieved from South
                         RankY = 0;
-                        CellLocation = RankZ * nx * MyYSlices + MyYSlices * RankX + RankY;
-                        int GlobalCellLocation = CellLocation + ZBound_Low * nx * MyYSlices;
+                        int GlobalCellLocation = (RankZ + ZBound_Low) * nx * MyYSlices + MyYSlices * RankX + RankY;
                         if ((BufferSouthRecv(BufPosition, 4) > 0) && (CellType(GlobalCellLocation) == Liquid)) {
                             Place = true;
                             NewGrainID = (int)(BufferSouthRecv(BufPosition, 0));
@@ -73,8 +100,7 @@ void GhostNodes1D(int, int, int NeighborRank_North, int NeighborRank_South, int
                     else if ((unpack_index == 1) && (NeighborRank_North != MPI_PROC_NULL)) {
                         // Data received from North
                         RankY = MyYSlices - 1;
-                        CellLocation = RankZ * nx * MyYSlices + MyYSlices * RankX + RankY;
-                        int GlobalCellLocation = CellLocation + ZBound_Low * nx * MyYSlices;
+                        int GlobalCellLocation = (RankZ + ZBound_Low) * nx * MyYSlices + MyYSlices * RankX + RankY;
                         if ((BufferNorthRecv(BufPosition, 4) > 0) && (CellType(GlobalCellLocation) == Liquid)) {
                             Place = true;
                             NewGrainID = (int)(BufferNorthRecv(BufPosition, 0));
@@ -87,6 +113,8 @@ void GhostNodes1D(int, int, int NeighborRank_North, int NeighborRank_South, int
                     if (Place) {
                         int GlobalZ = RankZ + ZBound_Low;
                         int GlobalCellLocation = GlobalZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+                        // Liquid cells always lie within the active region bounds
+                        long int CellLocation = RankZ * nxActive * nyActive + ActiveX * nyActive + (RankY - YBound_Low);
 
                         // Update this ghost node cell's information with data from other rank
                         GrainID(GlobalCellLocation) = NewGrainID;
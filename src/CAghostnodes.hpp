@@ -10,15 +10,20 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "mpi.h"
+
+#include <vector>
+
 // Load data (GrainID, DOCenter, DiagonalLength) into ghost nodes if the given RankY is associated with a 1D halo region
+// ActiveX is the X coordinate relative to the lower X bound of the active region
 KOKKOS_INLINE_FUNCTION void loadghostnodes(const double GhostGID, const double GhostDOCX, const double GhostDOCY,
                                            const double GhostDOCZ, const double GhostDL, const int BufSizeX,
-                                           const int MyYSlices, const int RankX, const int RankY, const int RankZ,
+                                           const int MyYSlices, const int ActiveX, const int RankY, const int RankZ,
                                            const bool AtNorthBoundary, const bool AtSouthBoundary,
                                            Buffer2D BufferSouthSend, Buffer2D BufferNorthSend) {
 
     if ((RankY == 1) && (!(AtSouthBoundary))) {
-        int GNPosition = RankZ * BufSizeX + RankX;
+        int GNPosition = RankZ * BufSizeX + ActiveX;
         BufferSouthSend(GNPosition, 0) = GhostGID;
         BufferSouthSend(GNPosition, 1) = GhostDOCX;
         BufferSouthSend(GNPosition, 2) = GhostDOCY;
@@ -26,7 +31,7 @@ KOKKOS_INLINE_FUNCTION void loadghostnodes(const double GhostGID, const double G
         BufferSouthSend(GNPosition, 4) = GhostDL;
     }
     else if ((RankY == MyYSlices - 2) && (!(AtNorthBoundary))) {
-        int GNPosition = RankZ * BufSizeX + RankX;
+        int GNPosition = RankZ * BufSizeX + ActiveX;
         BufferNorthSend(GNPosition, 0) = GhostGID;
         BufferNorthSend(GNPosition, 1) = GhostDOCX;
         BufferNorthSend(GNPosition, 2) = GhostDOCY;
@@ -34,10 +39,16 @@ KOKKOS_INLINE_FUNCTION void loadghostnodes(const double GhostGID, const double G
         BufferNorthSend(GNPosition, 4) = GhostDL;
     }
 }
+void InitHaloRequests(int NeighborRank_North, int NeighborRank_South, Buffer2D BufferNorthSend,
+                      Buffer2D BufferSouthSend, Buffer2D BufferNorthRecv, Buffer2D BufferSouthRecv, int BufSizeX,
+                      int BufSizeZ, std::vector<MPI_Request> &SendRequests, std::vector<MPI_Request> &RecvRequests);
+void FreeHaloRequests(std::vector<MPI_Request> &SendRequests, std::vector<MPI_Request> &RecvRequests);
 void GhostNodes1D(int, int, int NeighborRank_North, int NeighborRank_South, int nx, int MyYSlices, int MyYOffset,
                   NList NeighborX, NList NeighborY, NList NeighborZ, ViewI CellType, ViewF DOCenter, ViewI GrainID,
                   ViewF GrainUnitVector, ViewF DiagonalLength, ViewF CritDiagonalLength, int NGrainOrientations,
                   Buffer2D BufferNorthSend, Buffer2D BufferSouthSend, Buffer2D BufferNorthRecv,
-                  Buffer2D BufferSouthRecv, int BufSizeX, int BufSizeZ, int ZBound_Low);
+                  Buffer2D BufferSouthRecv, int BufSizeX, int BufSizeZ, int ZBound_Low, int XBound_Low, int nxActive,
+                  int YBound_Low, int nyActive, std::vector<MPI_Request> &SendRequests,
+                  std::vector<MPI_Request> &RecvRequests);
 
 #endif
@@ -9,16 +9,20 @@
 #include "CAfunctions.hpp"
 #include "CAghostnodes.hpp"
 #include "CAparsefiles.hpp"
+#include "CAtempcache.hpp"
 #include "CAupdate.hpp"
 
+#include <Kokkos_Sort.hpp>
+
 #include "mpi.h"
 
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <fstream>
 #include <iostream>
-#include <random>
 #include <regex>
+#include <utility>
 
 // Initializes input parameters, mesh, temperature field, and grain structures for CA simulations
 
@@ -35,7 +39,9 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
                        int &NSpotsY, int &SpotOffset, int &SpotRadius, bool &PrintTimeSeries, int &TimeSeriesInc,
                        bool &PrintIdleTimeSeriesFrames, bool &PrintDefaultRVE, double &RNGSeed,
                        bool &BaseplateThroughPowder, double &PowderActiveFraction, int &RVESize,
-                       bool &LayerwiseTempRead, bool &PrintBinary) {
+                       bool &LayerwiseTempRead, bool &PrintBinary, bool &FreezeSolidifiedCells,
+                       bool &RunLengthEncodeFrozen, int &TempReaderRanks, int &TempReuseMemory, int &TempEventWindow,
+                       RosenthalRasterProvider &Raster, const TemperatureCoupling &Coupling) {
 
     // Required inputs that should be present in the input file, regardless of problem type
     std::vector<std::string> RequiredInputs_General = {
@@ -53,14 +59,16 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
 
     // Optional inputs that may be present in the input file, regardless of problem type
     std::vector<std::string> OptionalInputs_General = {
-        "Debug check (reduced)",                        // Optional input 0
-        "Debug check (extensive)",                      // Optional input 1
-        "Print intermediate output frames",             // Optional input 2
-        "separate frames",                              // Optional input 3
-        "output even if system is unchanged",           // Optional input 4
-        "file of final undercooling values",            // Optional input 5
-        "Random seed for grains and nuclei generation", // Optional input 6
-        "Print vtk data as binary",                     // Optional input 7
+        "Debug check (reduced)",                          // Optional input 0
+        "Debug check (extensive)",                        // Optional input 1
+        "Print intermediate output frames",               // Optional input 2
+        "separate frames",                                // Optional input 3
+        "output even if system is unchanged",             // Optional input 4
+        "file of final undercooling values",              // Optional input 5
+        "Random seed for grains and nuclei generation",   // Optional input 6
+        "Print vtk data as binary",                       // Optional input 7
+        "Store fully solidified cells as grain IDs only", // Optional input 8
+        "Run-length encode stored solidified cells",      // Optional input 9
     };
     std::vector<std::string> DeprecatedInputs_General = {
         "Decomposition strategy", // Deprecated input 0
@@ -78,8 +86,8 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
     std::ifstream InputData;
     InputData.open(InputFile);
     skipLines(InputData, "*****"); // Skip lines until past the header lines above the asterisks
-    // First line after the header must be the problem type: either R, C, or S
-    // An "M" after the problem type ("SM" or "RM") indicates that the problem uses remelting logic
+    // First line after the header must be the problem type: either R, C, S, or L
+    // An "M" after the problem type ("SM", "LM", or "RM") indicates that the problem uses remelting logic
     // Additional required/optional inputs depending on problem type
     SimulationType = parseInput(InputData, "Problem type");
     std::vector<std::string> RequiredInputs_ProblemSpecific, OptionalInputs_ProblemSpecific,
@@ -99,6 +107,11 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
         SimulationType = "S";
         RemeltingYN = true;
     }
+    else if (SimulationType == "LM") {
+        // Simulation using a raster scan by a moving point heat source ("L") with remelting
+        SimulationType = "L";
+        RemeltingYN = true;
+    }
     else {
         // Simulation does not including remelting logic
         RemeltingYN = false;
@@ -130,6 +143,26 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
         OptionalInputs_ProblemSpecific[2] = "Extend baseplate through layers";
         OptionalInputs_ProblemSpecific[3] = "Density of powder surface sites active";
     }
+    else if (SimulationType == "L") {
+        RequiredInputs_ProblemSpecific.resize(12);
+        RequiredInputs_ProblemSpecific[0] = "Time step";
+        RequiredInputs_ProblemSpecific[1] = "Absorbed beam power";
+        RequiredInputs_ProblemSpecific[2] = "Scan speed";
+        RequiredInputs_ProblemSpecific[3] = "Thermal conductivity";
+        RequiredInputs_ProblemSpecific[4] = "Thermal diffusivity";
+        RequiredInputs_ProblemSpecific[5] = "Preheat temperature";
+        RequiredInputs_ProblemSpecific[6] = "Liquidus temperature";
+        RequiredInputs_ProblemSpecific[7] = "Track length";
+        RequiredInputs_ProblemSpecific[8] = "Hatch spacing";
+        RequiredInputs_ProblemSpecific[9] = "Number of tracks";
+        RequiredInputs_ProblemSpecific[10] = "Number of layers";
+        RequiredInputs_ProblemSpecific[11] = "Offset between layers";
+        OptionalInputs_ProblemSpecific.resize(4);
+        OptionalInputs_ProblemSpecific[0] = "Substrate grain spacing";
+        OptionalInputs_ProblemSpecific[1] = "Substrate filename";
+        OptionalInputs_ProblemSpecific[2] = "Extend baseplate through layers";
+        OptionalInputs_ProblemSpecific[3] = "Density of powder surface sites active";
+    }
     else if (SimulationType == "R") {
         RequiredInputs_ProblemSpecific.resize(2);
         RequiredInputs_ProblemSpecific[0] = "Time step";
@@ -143,7 +176,7 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
         OptionalInputs_ProblemSpecific[5] = "Default RVE size, in CA cells";
     }
     else {
-        std::string error = "Error: problem type must be C, S, or R: the value given was " + SimulationType;
+        std::string error = "Error: problem type must be C, S, L, or R: the value given was " + SimulationType;
         throw std::runtime_error(error);
     }
     int NumRequiredInputs_General = RequiredInputs_General.size();
@@ -240,7 +273,8 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
         std::string TemperatureFieldInstructions = RequiredInputsRead_ProblemSpecific[1];
         if (!(RequiredInputsRead_ProblemSpecific[1].empty()))
             parseTInstuctionsFile(id, TemperatureFieldInstructions, TempFilesInSeries, NumberOfLayers, LayerHeight,
-                                  deltax, HT_deltax, temp_paths, RemeltingYN, LayerwiseTempRead);
+                                  deltax, HT_deltax, temp_paths, RemeltingYN, LayerwiseTempRead, TempReaderRanks,
+                                  TempReuseMemory, TempEventWindow);
         if ((OptionalInputsRead_ProblemSpecific[3].empty()))
             BaseplateThroughPowder = false; // defaults to using baseplate only for layer 0 substrate
         else
@@ -330,6 +364,57 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
             std::cout << "The time step is " << deltat * pow(10, 6) << " microseconds" << std::endl;
         }
     }
+    else if (SimulationType == "L") {
+        deltat = getInputDouble(RequiredInputsRead_ProblemSpecific[0], -6);
+        double AbsorbedPower = getInputDouble(RequiredInputsRead_ProblemSpecific[1]);
+        double ScanSpeed = getInputDouble(RequiredInputsRead_ProblemSpecific[2]);
+        double Conductivity = getInputDouble(RequiredInputsRead_ProblemSpecific[3]);
+        double Diffusivity = getInputDouble(RequiredInputsRead_ProblemSpecific[4]);
+        double PreheatTemperature = getInputDouble(RequiredInputsRead_ProblemSpecific[5]);
+        double LiquidusTemperature = getInputDouble(RequiredInputsRead_ProblemSpecific[6]);
+        // Track length and hatch spacing are given in microns
+        int TrackLength = round(getInputDouble(RequiredInputsRead_ProblemSpecific[7], -6) / deltax);
+        int HatchSpacing = round(getInputDouble(RequiredInputsRead_ProblemSpecific[8], -6) / deltax);
+        int NumberOfTracks = getInputInt(RequiredInputsRead_ProblemSpecific[9]);
+        Raster = RosenthalRasterProvider(AbsorbedPower, ScanSpeed, Conductivity, Diffusivity, PreheatTemperature,
+                                         LiquidusTemperature, TrackLength, HatchSpacing, NumberOfTracks, deltax,
+                                         deltat);
+        NumberOfLayers = getInputInt(RequiredInputsRead_ProblemSpecific[10]);
+        LayerHeight = getInputInt(RequiredInputsRead_ProblemSpecific[11]);
+        // The melt pool depth takes the place of the spot radius in setting the Z bounds of each layer
+        SpotRadius = Raster.PoolRadius;
+        // Calculate nx, ny, and nz based on the track pattern, melt pool size, and number of layers
+        nz = SpotRadius + 1 + (NumberOfLayers - 1) * LayerHeight;
+        nx = TrackLength + 1;
+        ny = 2 * SpotRadius + 1 + HatchSpacing * (NumberOfTracks - 1);
+        if ((OptionalInputsRead_ProblemSpecific[2].empty()))
+            BaseplateThroughPowder = false; // defaults to using baseplate only for layer 0 substrate
+        else
+            BaseplateThroughPowder = getInputBool(OptionalInputsRead_ProblemSpecific[2]);
+        if ((OptionalInputsRead_ProblemSpecific[3].empty()))
+            PowderActiveFraction = 1.0; // defaults to a unique grain at each site in the powder layers
+        else {
+            PowderActiveFraction =
+                getInputDouble(OptionalInputsRead_ProblemSpecific[3], 12) *
+                pow(deltax, 3); // powder density is given as a density per unit volume, normalized by 10^12 m^-3 -->
+                                // convert this into a density of sites active on the CA grid (0 to 1)
+            if ((PowderActiveFraction < 0.0) || (PowderActiveFraction > 1.0))
+                throw std::runtime_error("Error: Density of powder surface sites active must be larger than 0 and less "
+                                         "than 1/(CA cell volume)");
+            if (BaseplateThroughPowder)
+                throw std::runtime_error("Error: if the option to extend the baseplate through the powder layers it "
+                                         "toggled, a powder density cannot be given");
+        }
+        if (id == 0) {
+            std::cout << "CA Simulation using a raster scan of " << NumberOfTracks
+                      << " tracks per layer by a moving point heat source, with a Rosenthal temperature field"
+                      << std::endl;
+            std::cout << "The melt pool depth and half-width is " << SpotRadius << " CA cells" << std::endl;
+            std::cout << "A total of " << NumberOfLayers << " layers, offset by " << LayerHeight
+                      << " CA cells will be simulated" << std::endl;
+            std::cout << "The time step is " << deltat * pow(10, 6) << " microseconds" << std::endl;
+        }
+    }
 
     // Optional inputs - should files post-initialization be printed for debugging?
     bool PrintDebugA = false;
@@ -386,8 +471,26 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
         PrintBinary = false;
     else
         PrintBinary = getInputBool(OptionalInputsRead_General[7]);
+    // Should cells below the melt pools of all remaining layers be moved out of the views, keeping only GrainID and
+    // LayerID? (By default, all views span the entire domain for the whole simulation)
+    if (OptionalInputsRead_General[8].empty())
+        FreezeSolidifiedCells = false;
+    else
+        FreezeSolidifiedCells = getInputBool(OptionalInputsRead_General[8]);
+    if (OptionalInputsRead_General[9].empty())
+        RunLengthEncodeFrozen = true;
+    else
+        RunLengthEncodeFrozen = getInputBool(OptionalInputsRead_General[9]);
+    // The other views are needed for the whole domain when printing intermediate output or final undercooling values
+    if ((FreezeSolidifiedCells) && ((PrintTimeSeries) || (PrintFinalUndercoolingVals))) {
+        if (id == 0)
+            std::cout << "Note: fully solidified cells cannot be stored as grain IDs only when printing intermediate "
+                         "output frames or final undercooling values, and will remain in all views"
+                      << std::endl;
+        FreezeSolidifiedCells = false;
+    }
     // For simulations with substrate grain structures, should an input grain spacing or a substrate file be used?
-    if ((SimulationType == "S") || (SimulationType == "R")) {
+    if ((SimulationType == "S") || (SimulationType == "L") || (SimulationType == "R")) {
         // Exactly one of the two inputs "sub grain size" and "sub filename" should be present
         if ((!(OptionalInputsRead_ProblemSpecific[0].empty())) && (!(OptionalInputsRead_ProblemSpecific[1].empty())))
             throw std::runtime_error("Error: only one of substrate grain size and substrate structure filename should "
@@ -415,8 +518,10 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
             throw std::runtime_error("Error: For simulations with external temperature data and remelting logic, CA "
                                      "cell size and input temperature data resolution must be equivalent");
         }
-        // Check that temperature file(s) exist
+        // Check that temperature file(s) exist, unless their data comes from a coupled code
         for (int i = 0; i < TempFilesInSeries; i++) {
+            if (Coupling.hasDataSet(temp_paths[i]))
+                continue;
             if (id == 0)
                 std::cout << "Checking file " << temp_paths[i] << std::endl;
             checkFileExists(temp_paths[i], id);
@@ -512,12 +617,25 @@ bool checkTemperatureFileFormat(std::string tempfile_thislayer) {
     return BinaryInputData;
 }
 
+// Read the data within the Y bounds from a temperature file in any of the supported formats (ASCII, binary, or
+// temperature cache), adding it to RawData. HT_deltax is the heat transport data mesh size, which a temperature cache
+// file must have been written with
+void readTemperatureFile(std::string tempfile_thislayer, double HT_deltax, int LowerYBound, int UpperYBound,
+                         RawTemperatureData &RawData, bool HostParallel) {
+
+    if (checkTemperatureCacheFormat(tempfile_thislayer))
+        parseTemperatureData_Cache(tempfile_thislayer, HT_deltax, LowerYBound, UpperYBound, RawData);
+    else
+        parseTemperatureData(tempfile_thislayer, LowerYBound, UpperYBound, RawData,
+                             checkTemperatureFileFormat(tempfile_thislayer), HostParallel);
+}
+
 // Obtain the physical XYZ bounds of the domain, using either domain size from the input file, or reading temperature
 // data files and parsing the coordinates
-void FindXYZBounds(std::string SimulationType, int id, double &deltax, int &nx, int &ny, int &nz,
+void FindXYZBounds(std::string SimulationType, int id, int np, double &deltax, int &nx, int &ny, int &nz,
                    std::vector<std::string> &temp_paths, double &XMin, double &XMax, double &YMin, double &YMax,
                    double &ZMin, double &ZMax, int &LayerHeight, int NumberOfLayers, int TempFilesInSeries,
-                   double *ZMinLayer, double *ZMaxLayer, int SpotRadius) {
+                   double *ZMinLayer, double *ZMaxLayer, int SpotRadius, const TemperatureCoupling &Coupling) {
 
     if (SimulationType == "R") {
         // Two passes through reading temperature data files- the first pass only reads the headers to
@@ -536,29 +654,79 @@ void FindXYZBounds(std::string SimulationType, int id, double &deltax, int &nx,
         // Read the first temperature file, first line to determine if the "new" OpenFOAM output format (with a 1 line
         // header) is used, or whether the "old" OpenFOAM header (which contains information like the X/Y/Z bounds of
         // the simulation domain) is
-        std::ifstream FirstTemperatureFile;
-        FirstTemperatureFile.open(temp_paths[0]);
-        std::string FirstLineFirstFile;
-        getline(FirstTemperatureFile, FirstLineFirstFile);
-        std::size_t found = FirstLineFirstFile.find("Number of temperature data points");
-        if (found != std::string::npos) {
-            // Old temperature data format detected - no longer supported by ExaCA
-            std::string error = "Error: Old header and temperature file format no longer supported";
-            throw std::runtime_error(error);
+        if (!(Coupling.hasDataSet(temp_paths[0]))) {
+            std::ifstream FirstTemperatureFile;
+            FirstTemperatureFile.open(temp_paths[0]);
+            std::string FirstLineFirstFile;
+            getline(FirstTemperatureFile, FirstLineFirstFile);
+            std::size_t found = FirstLineFirstFile.find("Number of temperature data points");
+            if (found != std::string::npos) {
+                // Old temperature data format detected - no longer supported by ExaCA
+                std::string error = "Error: Old header and temperature file format no longer supported";
+                throw std::runtime_error(error);
+            }
         }
 
         // Read all data files to determine the domain bounds, max number of remelting events
-        // for simulations with remelting
+        // for simulations with remelting. Each file is split into PartsPerFile parts, such that there are at least as
+        // many parts as MPI ranks, and the parts are distributed among the ranks. The min/max coordinates from each
+        // rank's parts are then combined, with max values negated such that a single MPI_MIN reduction is used
         int LayersToRead = std::min(NumberOfLayers, TempFilesInSeries); // was given in input file
-        for (int LayerReadCount = 1; LayerReadCount <= LayersToRead; LayerReadCount++) {
-
+        int PartsPerFile = (np + LayersToRead - 1) / LayersToRead;
+        std::vector<double> XYZMinMax_Local(6 * LayersToRead, std::numeric_limits<double>::max());
+        for (int FilePart = id; FilePart < LayersToRead * PartsPerFile; FilePart += np) {
+            int LayerReadCount = FilePart / PartsPerFile + 1;
             std::string tempfile_thislayer = temp_paths[LayerReadCount - 1];
-            // Get min and max x coordinates in this file, which can be a binary or ASCII input file
-            // binary file type uses extension .catemp, all other file types assumed to be comma-separated ASCII input
-            bool BinaryInputData = checkTemperatureFileFormat(tempfile_thislayer);
             // { Xmin, Xmax, Ymin, Ymax, Zmin, Zmax }
-            std::array<double, 6> XYZMinMax_ThisLayer =
-                parseTemperatureCoordinateMinMax(tempfile_thislayer, BinaryInputData);
+            std::array<double, 6> XYZMinMax_ThisPart;
+            if (Coupling.hasDataSet(tempfile_thislayer))
+                continue;
+            if (checkTemperatureCacheFormat(tempfile_thislayer)) {
+                // Temperature cache files store the bounds in the header, read by the rank with the first part
+                if (FilePart % PartsPerFile == 0)
+                    XYZMinMax_ThisPart = readTemperatureCacheHeader(tempfile_thislayer).XYZMinMax;
+                else {
+                    for (int n = 0; n < 3; n++) {
+                        XYZMinMax_ThisPart[2 * n] = std::numeric_limits<double>::max();
+                        XYZMinMax_ThisPart[2 * n + 1] = std::numeric_limits<double>::lowest();
+                    }
+                }
+            }
+            else {
+                // Get min and max x coordinates in this part of the file, which can be a binary or ASCII input file
+                // binary file type uses extension .catemp, all other file types assumed to be comma-separated ASCII
+                bool BinaryInputData = checkTemperatureFileFormat(tempfile_thislayer);
+                XYZMinMax_ThisPart = parseTemperatureCoordinateMinMax(tempfile_thislayer, BinaryInputData,
+                                                                      FilePart % PartsPerFile, PartsPerFile);
+            }
+            for (int n = 0; n < 3; n++) {
+                XYZMinMax_Local[6 * (LayerReadCount - 1) + 2 * n] =
+                    std::min(XYZMinMax_Local[6 * (LayerReadCount - 1) + 2 * n], XYZMinMax_ThisPart[2 * n]);
+                XYZMinMax_Local[6 * (LayerReadCount - 1) + 2 * n + 1] =
+                    std::min(XYZMinMax_Local[6 * (LayerReadCount - 1) + 2 * n + 1], -XYZMinMax_ThisPart[2 * n + 1]);
+            }
+        }
+        // Data sets from a coupled code are spread among all ranks, so each rank adds the bounds of its own data points
+        for (int LayerReadCount = 1; LayerReadCount <= LayersToRead; LayerReadCount++) {
+            std::string tempfile_thislayer = temp_paths[LayerReadCount - 1];
+            if (Coupling.hasDataSet(tempfile_thislayer)) {
+                std::array<double, 6> XYZMinMax_Coupled = calcCoupledCoordinateMinMax(Coupling, tempfile_thislayer);
+                for (int n = 0; n < 3; n++) {
+                    XYZMinMax_Local[6 * (LayerReadCount - 1) + 2 * n] = XYZMinMax_Coupled[2 * n];
+                    XYZMinMax_Local[6 * (LayerReadCount - 1) + 2 * n + 1] = -XYZMinMax_Coupled[2 * n + 1];
+                }
+            }
+        }
+        std::vector<double> XYZMinMax_Global(6 * LayersToRead);
+        MPI_Allreduce(XYZMinMax_Local.data(), XYZMinMax_Global.data(), 6 * LayersToRead, MPI_DOUBLE, MPI_MIN,
+                      MPI_COMM_WORLD);
+        for (int LayerReadCount = 1; LayerReadCount <= LayersToRead; LayerReadCount++) {
+
+            std::array<double, 6> XYZMinMax_ThisLayer;
+            for (int n = 0; n < 3; n++) {
+                XYZMinMax_ThisLayer[2 * n] = XYZMinMax_Global[6 * (LayerReadCount - 1) + 2 * n];
+                XYZMinMax_ThisLayer[2 * n + 1] = -XYZMinMax_Global[6 * (LayerReadCount - 1) + 2 * n + 1];
+            }
 
             // Based on the input file's layer offset, adjust ZMin/ZMax from the temperature data coordinate
             // system to the multilayer CA coordinate system Check to see in the XYZ bounds for this layer are
@@ -665,11 +833,101 @@ void DomainDecomposition(int id, int np, int &MyYSlices, int &MyYOffset, int &Ne
     LocalDomainSize = nx * MyYSlices * nz; // Number of cells on this MPI rank
 }
 
+// Send the data points in RankData[Rank] (x, y, z, tm, tl, cr values for each) to each rank "Rank", adding the data
+// points received by this rank to RawData in order of the sending rank
+void exchangeTemperatureData(int np, std::vector<std::vector<double>> &RankData, RawTemperatureData &RawData) {
+
+    // Data points are exchanged using a datatype of 6 doubles, so counts and displacements are numbers of data points.
+    // These are counted as 64-bit values first, as the MPI counts are ints
+    std::vector<long int> SendPoints(np), RecvPoints(np);
+    long int SendSize = 0;
+    for (int Rank = 0; Rank < np; Rank++) {
+        SendPoints[Rank] = RankData[Rank].size() / 6;
+        SendSize += SendPoints[Rank];
+    }
+    MPI_Alltoall(SendPoints.data(), 1, MPI_LONG, RecvPoints.data(), 1, MPI_LONG, MPI_COMM_WORLD);
+    long int RecvSize = 0;
+    for (int Rank = 0; Rank < np; Rank++)
+        RecvSize += RecvPoints[Rank];
+    // All ranks stop if any rank would send or receive too many data points for the MPI counts
+    int CountOverflow = ((SendSize > INT_MAX) || (RecvSize > INT_MAX));
+    int CountOverflow_Global;
+    MPI_Allreduce(&CountOverflow, &CountOverflow_Global, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (CountOverflow_Global)
+        throw std::runtime_error("Error: Too many temperature data points to send to or receive from other ranks; use "
+                                 "more MPI ranks or reader ranks");
+
+    std::vector<int> SendCounts(np), SendDispls(np), RecvCounts(np), RecvDispls(np);
+    for (int Rank = 0; Rank < np; Rank++) {
+        SendCounts[Rank] = SendPoints[Rank];
+        RecvCounts[Rank] = RecvPoints[Rank];
+        SendDispls[Rank] = (Rank == 0) ? 0 : SendDispls[Rank - 1] + SendCounts[Rank - 1];
+        RecvDispls[Rank] = (Rank == 0) ? 0 : RecvDispls[Rank - 1] + RecvCounts[Rank - 1];
+    }
+    std::vector<double> SendBuffer(6 * SendSize);
+    for (int Rank = 0; Rank < np; Rank++) {
+        std::copy(RankData[Rank].begin(), RankData[Rank].end(), SendBuffer.begin() + 6L * SendDispls[Rank]);
+        std::vector<double>().swap(RankData[Rank]);
+    }
+    std::vector<double> RecvBuffer(6 * RecvSize);
+    MPI_Datatype DataPointType;
+    MPI_Type_contiguous(6, MPI_DOUBLE, &DataPointType);
+    MPI_Type_commit(&DataPointType);
+    MPI_Alltoallv(SendBuffer.data(), SendCounts.data(), SendDispls.data(), DataPointType, RecvBuffer.data(),
+                  RecvCounts.data(), RecvDispls.data(), DataPointType, MPI_COMM_WORLD);
+    MPI_Type_free(&DataPointType);
+    std::vector<double>().swap(SendBuffer);
+    RawData.reserve(RawData.size() + RecvSize);
+    for (long int DataPoint = 0; DataPoint < RecvSize; DataPoint++)
+        RawData.addPoint(RecvBuffer.data() + 6 * DataPoint);
+}
+
+// Read temperature file tempfile_thislayer on the first NumReaderRanks ranks, each parsing one part of the file, and
+// send each data point to the rank(s) whose Y bounds contain it. Received data points are added to RawData in order of
+// the sending rank, and therefore in the order they appear in the file
+void scatterTemperatureData(int id, int np, int NumReaderRanks, std::string tempfile_thislayer,
+                            std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds, RawTemperatureData &RawData,
+                            bool BinaryInputData) {
+
+    // Data points from this rank's part of the file (x, y, z, tm, tl, cr values for each), binned by destination rank
+    std::vector<std::vector<double>> RankData(np);
+    if (id < NumReaderRanks)
+        parseTemperatureDataByRank(tempfile_thislayer, RawData.YMin, RawData.deltax, LowerYBounds, UpperYBounds,
+                                   RankData, BinaryInputData, id, NumReaderRanks);
+    exchangeTemperatureData(np, RankData, RawData);
+}
+
+// Send the data points of coupled temperature data set tempfile_thislayer, added on any rank, to the rank(s) whose Y
+// bounds contain them. Received data points are added to RawData in order of the rank that added them
+void scatterCoupledTemperatureData(int np, const TemperatureCoupling &Coupling, std::string tempfile_thislayer,
+                                   std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds,
+                                   RawTemperatureData &RawData) {
+
+    std::vector<std::vector<double>> RankData(np);
+    binCoupledTemperatureData(Coupling, tempfile_thislayer, RawData.YMin, RawData.deltax, LowerYBounds, UpperYBounds,
+                              RankData);
+    exchangeTemperatureData(np, RankData, RawData);
+}
+
+// Get the Y bounds (in CA cells) of the temperature data needed by this MPI rank. If HTtoCAratio > 1, an
+// interpolation of input temperature data is needed, and the region (for this MPI rank) of the physical domain that
+// needs to be read extends past the actual spatial extent of the local domain for purposes of interpolating from
+// HT_deltax to deltax
+void calcTemperatureYBounds(int HTtoCAratio, int MyYSlices, int MyYOffset, int &LowerYBound, int &UpperYBound) {
+
+    LowerYBound = MyYOffset - (MyYOffset % HTtoCAratio);
+    if (HTtoCAratio == 1)
+        UpperYBound = MyYOffset + MyYSlices - 1;
+    else
+        UpperYBound = MyYOffset + MyYSlices - 1 + HTtoCAratio - (MyYOffset + MyYSlices - 1) % HTtoCAratio;
+}
+
 // Read in temperature data from files, stored in "RawData", with the appropriate MPI ranks storing the appropriate data
-void ReadTemperatureData(int id, double &deltax, double HT_deltax, int &HTtoCAratio, int MyYSlices, int MyYOffset,
-                         double YMin, std::vector<std::string> &temp_paths, int NumberOfLayers, int TempFilesInSeries,
-                         unsigned int &NumberOfTemperatureDataPoints, std::vector<double> &RawData, int *FirstValue,
-                         int *LastValue, bool LayerwiseTempRead, int layernumber) {
+void ReadTemperatureData(int id, int np, double &deltax, double HT_deltax, int &HTtoCAratio, int MyYSlices,
+                         int MyYOffset, double XMin, double YMin, double ZMin, std::vector<std::string> &temp_paths,
+                         int NumberOfLayers, int TempFilesInSeries, RawTemperatureData &RawData, int *FirstValue,
+                         int *LastValue, bool LayerwiseTempRead, int layernumber, int TempReaderRanks,
+                         const TemperatureCoupling &Coupling) {
 
     double HTtoCAratio_unrounded = HT_deltax / deltax;
     double HTtoCAratio_floor = floor(HTtoCAratio_unrounded);
@@ -686,23 +944,24 @@ void ReadTemperatureData(int id, double &deltax, double HT_deltax, int &HTtoCAra
     // Adjust deltax to exact value based on temperature data spacing and ratio between heat transport/CA cell sizes
     deltax = HT_deltax / HTtoCAratio_floor;
     HTtoCAratio = round(HT_deltax / deltax); // OpenFOAM/CA cell size ratio
-    // If HTtoCAratio > 1, an interpolation of input temperature data is needed
-    // The Y bounds are the region (for this MPI rank) of the physical domain that needs to be
-    // read extends past the actual spatial extent of the local domain for purposes of interpolating
-    // from HT_deltax to deltax
-    int LowerYBound = MyYOffset - (MyYOffset % HTtoCAratio);
-    int UpperYBound;
-    if (HTtoCAratio == 1)
-        UpperYBound = MyYOffset + MyYSlices - 1;
-    else
-        UpperYBound = MyYOffset + MyYSlices - 1 + HTtoCAratio - (MyYOffset + MyYSlices - 1) % HTtoCAratio;
-
-    // Store raw data relevant to each rank in the vector structure RawData
+    int LowerYBound, UpperYBound;
+    calcTemperatureYBounds(HTtoCAratio, MyYSlices, MyYOffset, LowerYBound, UpperYBound);
+    // If TempReaderRanks is nonzero, only this many ranks read each temperature file, sending the data to the other
+    // ranks. Otherwise, each rank reads all of the temperature data and keeps the data inside its own Y bounds. Data
+    // sets from a coupled code are always sent to the ranks that need them
+    int NumReaderRanks = std::min(TempReaderRanks, np);
+    std::vector<int> LowerYBounds(np), UpperYBounds(np);
+    if ((NumReaderRanks > 0) || (!(Coupling.empty()))) {
+        MPI_Allgather(&LowerYBound, 1, MPI_INT, LowerYBounds.data(), 1, MPI_INT, MPI_COMM_WORLD);
+        MPI_Allgather(&UpperYBound, 1, MPI_INT, UpperYBounds.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    }
+
+    // Store raw data relevant to each rank in RawData, with the X, Y, Z coordinates of each point as CA cell indices
     // Two passes through reading temperature data files- this is the second pass, reading the actual X/Y/Z/liquidus
     // time/cooling rate data and each rank stores the data relevant to itself in "RawData". With remelting
     // (SimulationType == "RM"), this is the same except that some X/Y/Z coordinates may be repeated in a file, and
     // a "melting time" value is stored in addition to liquidus time and cooling rate
-    NumberOfTemperatureDataPoints = 0; // reset to 0 during each call to ReadTemperatureData
+    RawData = RawTemperatureData(XMin, YMin, ZMin, deltax); // reset during each call to ReadTemperatureData
     // Second pass through the files - ignore header line
     int FirstLayerToRead, LastLayerToRead;
     if (LayerwiseTempRead) {
@@ -724,15 +983,19 @@ void ReadTemperatureData(int id, double &deltax, double HT_deltax, int &HTtoCAra
         else
             tempfile_thislayer = temp_paths[LayerReadCount];
 
-        FirstValue[LayerReadCount] = NumberOfTemperatureDataPoints;
-        // Read and parse temperature file for either binary or ASCII, storing the appropriate values on each MPI rank
-        // within RawData and incrementing NumberOfTemperatureDataPoints appropriately
-        bool BinaryInputData = checkTemperatureFileFormat(tempfile_thislayer);
-        parseTemperatureData(tempfile_thislayer, YMin, deltax, LowerYBound, UpperYBound, RawData,
-                             NumberOfTemperatureDataPoints, BinaryInputData);
-        LastValue[LayerReadCount] = NumberOfTemperatureDataPoints;
+        FirstValue[LayerReadCount] = RawData.size();
+        // Read and parse temperature file for either binary or ASCII, adding the appropriate data points on each MPI
+        // rank to RawData. Temperature cache files are indexed by Y coordinate, so each rank reads only the part of the
+        // file within its own Y bounds
+        if (Coupling.hasDataSet(tempfile_thislayer))
+            scatterCoupledTemperatureData(np, Coupling, tempfile_thislayer, LowerYBounds, UpperYBounds, RawData);
+        else if ((NumReaderRanks > 0) && (!(checkTemperatureCacheFormat(tempfile_thislayer))))
+            scatterTemperatureData(id, np, NumReaderRanks, tempfile_thislayer, LowerYBounds, UpperYBounds, RawData,
+                                   checkTemperatureFileFormat(tempfile_thislayer));
+        else
+            readTemperatureFile(tempfile_thislayer, HT_deltax, LowerYBound, UpperYBound, RawData);
+        LastValue[LayerReadCount] = RawData.size();
     } // End loop over all files read for all layers
-    RawData.resize(NumberOfTemperatureDataPoints);
     // Determine start values for each layer's data within "RawData", if all layers were read
     if (!(LayerwiseTempRead)) {
         if (NumberOfLayers > TempFilesInSeries) {
@@ -764,7 +1027,7 @@ int calcZBound_Low(std::string SimulationType, int LayerHeight, int layernumber,
         // Not a multilayer problem, top of "layer" is the top of the overall simulation domain
         ZBound_Low = 0;
     }
-    else if (SimulationType == "S") {
+    else if ((SimulationType == "S") || (SimulationType == "L")) {
         // lower bound of domain is an integer multiple of the layer spacing, since the temperature field is the
         // same for every layer
         ZBound_Low = LayerHeight * layernumber;
@@ -774,7 +1037,7 @@ int calcZBound_Low(std::string SimulationType, int LayerHeight, int layernumber,
         ZBound_Low = round((ZMinLayer[layernumber] - ZMin) / deltax);
     }
     if (ZBound_Low == -1)
-        throw std::runtime_error("Error: ZBound_Low went uninitialized, problem type must be C, S, or R");
+        throw std::runtime_error("Error: ZBound_Low went uninitialized, problem type must be C, S, L, or R");
     return ZBound_Low;
 }
 //*****************************************************************************/
@@ -787,9 +1050,9 @@ int calcZBound_High(std::string SimulationType, int SpotRadius, int LayerHeight,
         // Not a multilayer problem, top of "layer" is the top of the overall simulation domain
         ZBound_High = nz - 1;
     }
-    else if (SimulationType == "S") {
-        // Top of layer is equal to the spot radius for a problem of hemispherical spot solidification, plus an offset
-        // depending on the layer number
+    else if ((SimulationType == "S") || (SimulationType == "L")) {
+        // Top of layer is equal to the spot radius for a problem of hemispherical spot solidification (or the melt
+        // pool depth for a raster scan), plus an offset depending on the layer number
         ZBound_High = SpotRadius + LayerHeight * layernumber;
     }
     else if (SimulationType == "R") {
@@ -798,10 +1061,25 @@ int calcZBound_High(std::string SimulationType, int SpotRadius, int LayerHeight,
         ZBound_High = round((ZMaxLayer[layernumber] - ZMin) / deltax);
     }
     if (ZBound_High == -1)
-        throw std::runtime_error("Error: ZBound_High went uninitialized, problem type must be C, S, or R");
+        throw std::runtime_error("Error: ZBound_High went uninitialized, problem type must be C, S, L, or R");
     return ZBound_High;
 }
 //*****************************************************************************/
+// Get the number of Z coordinates at the bottom of the domain that cannot change once layer "layernumber" is finished:
+// the cells below the lower bounds and the powder of all remaining layers. This is also capped at the top of the
+// finished layer, as cell type initialization for the next layer may check the neighbors of cells directly above it
+int calcFrozenZ(std::string SimulationType, int SpotRadius, int LayerHeight, int layernumber, int NumberOfLayers,
+                double ZMin, double deltax, int nz, double *ZMinLayer, double *ZMaxLayer) {
+
+    int FrozenZ = calcZBound_High(SimulationType, SpotRadius, LayerHeight, layernumber, ZMin, deltax, nz, ZMaxLayer);
+    for (int RemainingLayer = layernumber + 1; RemainingLayer < NumberOfLayers; RemainingLayer++) {
+        int RemainingLayerZ = calcZBound_Low(SimulationType, LayerHeight, RemainingLayer, ZMinLayer, ZMin, deltax);
+        int PowderBottomZ = round((ZMaxLayer[RemainingLayer] - ZMin) / deltax) + 1 - LayerHeight;
+        FrozenZ = std::min({FrozenZ, RemainingLayerZ, PowderBottomZ});
+    }
+    return std::max(FrozenZ, 0);
+}
+//*****************************************************************************/
 // Calculate the size of the active domain in Z
 int calcnzActive(int ZBound_Low, int ZBound_High, int id, int layernumber) {
     int nzActive = ZBound_High - ZBound_Low + 1;
@@ -817,33 +1095,133 @@ int calcLocalActiveDomainSize(int nx, int MyYSlices, int nzActive) {
     return LocalActiveDomainSize;
 }
 //*****************************************************************************/
+// Calculate the X and Y bounds of this layer's active region from the cells with temperature data in the layer's Z
+// bounds. The X bounds are the same on all ranks so that halo buffers match between neighbors, while the Y bounds are
+// local to each rank. All cells of the layer outside of these bounds stay solid for the entire layer
+void calcActiveRegionBounds(std::string SimulationType, int id, int layernumber, int nx, int MyYSlices, int nzActive,
+                            int ZBound_Low, ViewI CritTimeStep, int &XBound_Low, int &nxActive, int &YBound_Low,
+                            int &nyActive) {
+
+    // Constrained solidification problems have active cells at the bottom surface that have no temperature data
+    if (SimulationType == "C") {
+        XBound_Low = 0;
+        nxActive = nx;
+        YBound_Low = 0;
+        nyActive = MyYSlices;
+        return;
+    }
+    Kokkos::MinMaxScalar<int> XRange, YRange;
+    Kokkos::parallel_reduce(
+        "ActiveRegionBoundsX", nx * MyYSlices * nzActive,
+        KOKKOS_LAMBDA(const int &D3D1ConvPosition, Kokkos::MinMaxScalar<int> &update) {
+            int GlobalD3D1ConvPosition = D3D1ConvPosition + ZBound_Low * nx * MyYSlices;
+            if (CritTimeStep(GlobalD3D1ConvPosition) != 0) {
+                int RankX = (D3D1ConvPosition % (nx * MyYSlices)) / MyYSlices;
+                if (RankX < update.min_val)
+                    update.min_val = RankX;
+                if (RankX > update.max_val)
+                    update.max_val = RankX;
+            }
+        },
+        Kokkos::MinMax<int>(XRange));
+    Kokkos::parallel_reduce(
+        "ActiveRegionBoundsY", nx * MyYSlices * nzActive,
+        KOKKOS_LAMBDA(const int &D3D1ConvPosition, Kokkos::MinMaxScalar<int> &update) {
+            int GlobalD3D1ConvPosition = D3D1ConvPosition + ZBound_Low * nx * MyYSlices;
+            if (CritTimeStep(GlobalD3D1ConvPosition) != 0) {
+                int RankY = D3D1ConvPosition % MyYSlices;
+                if (RankY < update.min_val)
+                    update.min_val = RankY;
+                if (RankY > update.max_val)
+                    update.max_val = RankY;
+            }
+        },
+        Kokkos::MinMax<int>(YRange));
+
+    int XBound_High;
+    MPI_Allreduce(&XRange.min_val, &XBound_Low, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&XRange.max_val, &XBound_High, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    // Empty regions (no cells with temperature data) are given a size of 0
+    if (XBound_Low > XBound_High) {
+        XBound_Low = 0;
+        nxActive = 0;
+    }
+    else
+        nxActive = XBound_High - XBound_Low + 1;
+    if (YRange.min_val > YRange.max_val) {
+        YBound_Low = 0;
+        nyActive = 0;
+    }
+    else {
+        YBound_Low = YRange.min_val;
+        nyActive = YRange.max_val - YRange.min_val + 1;
+    }
+    if (id == 0)
+        std::cout << "Layer " << layernumber << "'s active region spans X = " << XBound_Low << " through "
+                  << XBound_Low + nxActive - 1 << " (" << nxActive << ") cells" << std::endl;
+}
+//*****************************************************************************/
+// Copy the layer's solidification event data, initialized for all cells in the layer's Z bounds, into views sized to
+// the active region
+void TrimEventDataToActiveRegion(int nx, int MyYSlices, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                                 int nyActive, ViewF2D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
+                                 ViewI &SolidificationEventOffset, ViewI &SolidificationEventCounter) {
+
+    int LocalActiveDomainSize = nxActive * nyActive * nzActive;
+    ViewI NumberOfSolidificationEvents_Active(Kokkos::ViewAllocateWithoutInitializing("NumSEvents"),
+                                              LocalActiveDomainSize);
+    ViewI SolidificationEventOffset_Active(Kokkos::ViewAllocateWithoutInitializing("SEventOffset"),
+                                           LocalActiveDomainSize + 1);
+    ViewF2D LayerTimeTempHistory_Layer = LayerTimeTempHistory;
+    ViewI NumberOfSolidificationEvents_Layer = NumberOfSolidificationEvents;
+    ViewI SolidificationEventOffset_Layer = SolidificationEventOffset;
+    Kokkos::parallel_for(
+        "TrimEventCounts", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+            int RankZ = D3D1ConvPosition / (nxActive * nyActive);
+            int Rem = D3D1ConvPosition % (nxActive * nyActive);
+            int RankX = Rem / nyActive + XBound_Low;
+            int RankY = Rem % nyActive + YBound_Low;
+            int LayerD3D1ConvPosition = RankZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+            NumberOfSolidificationEvents_Active(D3D1ConvPosition) =
+                NumberOfSolidificationEvents_Layer(LayerD3D1ConvPosition);
+        });
+    int NumberOfEvents_Active = calcSolidificationEventOffsets(
+        LocalActiveDomainSize, NumberOfSolidificationEvents_Active, SolidificationEventOffset_Active);
+    ViewF2D LayerTimeTempHistory_Active(Kokkos::ViewAllocateWithoutInitializing("TimeTempHistory"),
+                                        NumberOfEvents_Active, 3);
+    Kokkos::parallel_for(
+        "TrimEventData", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+            int RankZ = D3D1ConvPosition / (nxActive * nyActive);
+            int Rem = D3D1ConvPosition % (nxActive * nyActive);
+            int RankX = Rem / nyActive + XBound_Low;
+            int RankY = Rem % nyActive + YBound_Low;
+            int LayerD3D1ConvPosition = RankZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+            int FirstEvent_Active = SolidificationEventOffset_Active(D3D1ConvPosition);
+            int FirstEvent_Layer = SolidificationEventOffset_Layer(LayerD3D1ConvPosition);
+            for (int n = 0; n < NumberOfSolidificationEvents_Active(D3D1ConvPosition); n++) {
+                for (int l = 0; l < 3; l++)
+                    LayerTimeTempHistory_Active(FirstEvent_Active + n, l) =
+                        LayerTimeTempHistory_Layer(FirstEvent_Layer + n, l);
+            }
+        });
+    Kokkos::fence();
+    LayerTimeTempHistory = LayerTimeTempHistory_Active;
+    NumberOfSolidificationEvents = NumberOfSolidificationEvents_Active;
+    SolidificationEventOffset = SolidificationEventOffset_Active;
+    // Solidification event counter starts at 0 for each cell
+    Kokkos::realloc(SolidificationEventCounter, LocalActiveDomainSize);
+    Kokkos::deep_copy(SolidificationEventCounter, 0);
+}
+//*****************************************************************************/
 // Initialize temperature data for a constrained solidification test problem
 void TempInit_DirSolidification(double G, double R, int, int &nx, int &MyYSlices, double deltax, double deltat, int nz,
                                 int LocalDomainSize, ViewI &CritTimeStep, ViewF &UndercoolingChange, ViewI &LayerID) {
 
-    // These views are initialized on the host, filled with data, and then copied to the device for layer "layernumber"
-    // This view is initialized with zeros
-    ViewI_H LayerID_Host("LayerID_H", LocalDomainSize);
-    // These views will be filled with non-zero values
-    ViewI_H CritTimeStep_Host(Kokkos::ViewAllocateWithoutInitializing("CritTimeStep_H"), LocalDomainSize);
-    ViewF_H UndercoolingChange_Host(Kokkos::ViewAllocateWithoutInitializing("UndercoolingChange_H"), LocalDomainSize);
-
     // Initialize temperature field in Z direction with thermal gradient G set in input file
     // Cells at the bottom surface (Z = 0) are at the liquidus at time step 0 (no wall cells at the bottom boundary)
-    for (int k = 0; k < nz; k++) {
-        for (int i = 0; i < nx; i++) {
-            for (int j = 0; j < MyYSlices; j++) {
-                int GlobalD3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
-                UndercoolingChange_Host(GlobalD3D1ConvPosition) = R * deltat;
-                CritTimeStep_Host(GlobalD3D1ConvPosition) = (int)((k * G * deltax) / (R * deltat));
-            }
-        }
-    }
-
-    // Copy initialized host data back to device
-    CritTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), CritTimeStep_Host);
-    LayerID = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerID_Host);
-    UndercoolingChange = Kokkos::create_mirror_view_and_copy(device_memory_space(), UndercoolingChange_Host);
+    DirSolidificationProvider Provider(G, R, deltax, deltat);
+    TempInit_ProviderNoRemelt(Provider, nx, MyYSlices, 0, LocalDomainSize, 1, nz, nz, CritTimeStep, UndercoolingChange,
+                              LayerID);
 }
 
 // Initialize temperature data for an array of overlapping spot melts (done during simulation initialization, no
@@ -853,96 +1231,43 @@ void TempInit_SpotNoRemelt(double G, double R, std::string, int id, int &nx, int
                            ViewF &UndercoolingChange, int LayerHeight, int NumberOfLayers, double FreezingRange,
                            ViewI &LayerID, int NSpotsX, int NSpotsY, int SpotRadius, int SpotOffset) {
 
-    // This view is initialized with -1 for all cells, populated with other data, and later copied to the device
-    ViewI_H LayerID_Host(Kokkos::ViewAllocateWithoutInitializing("LayerID_H"), LocalDomainSize);
-    Kokkos::deep_copy(LayerID_Host, -1);
-    // These views are initialized with zero values on the host, populated with other data, and later copied to the
-    // device
-    ViewI_H CritTimeStep_Host("CritTimeStep_H", LocalDomainSize);
-    ViewF_H UndercoolingChange_Host("UndercoolingChange_H", LocalDomainSize);
-
-    int NumberOfSpots = NSpotsX * NSpotsY;
-    // Outer edges of spots are initialized at the liquidus temperature
-    // Spots cool at constant rate R, spot thermal gradient = G
-    // Time between "start" of next spot is the time it takes for the previous spot
-    // to have entirely gone below the solidus temperature
-    float IsothermVelocity = (R / G) * deltat / deltax;                                  // in cells per time step
-    int TimeBetweenSpots = SpotRadius / IsothermVelocity + (FreezingRange / R) / deltat; // in time steps
+    SpotArrayProvider Provider(G, R, deltax, deltat, FreezingRange, NSpotsX, NSpotsY, SpotRadius, SpotOffset);
     if (id == 0)
-        std::cout << "Initializing temperature field for " << NumberOfSpots
-                  << " spots, each of which takes approximately " << TimeBetweenSpots << " time steps to solidify"
-                  << std::endl;
-    for (int layernumber = 0; layernumber < NumberOfLayers; layernumber++) {
-        for (int n = 0; n < NumberOfSpots; n++) {
-            if (id == 0)
-                std::cout << "Initializing spot " << n << " on layer " << layernumber << std::endl;
-            // Initialize critical time step/cooling rate values for this spot/this layer
-            int XSpotPos = SpotRadius + (n % NSpotsX) * SpotOffset;
-            int YSpotPos = SpotRadius + (n / NSpotsX) * SpotOffset;
-            int ZSpotPos = SpotRadius + LayerHeight * layernumber;
-            for (int k = 0; k <= SpotRadius; k++) {
-                // Distance of this cell from the spot center
-                float DistZ = (float)(ZSpotPos - (k + LayerHeight * layernumber));
-                for (int i = 0; i < nx; i++) {
-                    float DistX = (float)(XSpotPos - i);
-                    for (int j = 0; j < MyYSlices; j++) {
-                        int YGlobal = j + MyYOffset;
-                        float DistY = (float)(YSpotPos - YGlobal);
-                        float TotDist = sqrt(DistX * DistX + DistY * DistY + DistZ * DistZ);
-                        if (TotDist <= SpotRadius) {
-                            int GlobalD3D1ConvPosition =
-                                (k + layernumber * LayerHeight) * nx * MyYSlices + i * MyYSlices + j;
-                            CritTimeStep_Host(GlobalD3D1ConvPosition) =
-                                1 + (int)(((float)(SpotRadius)-TotDist) / IsothermVelocity) + TimeBetweenSpots * n;
-                            UndercoolingChange_Host(GlobalD3D1ConvPosition) = R * deltat;
-                            LayerID_Host(GlobalD3D1ConvPosition) = layernumber;
-                        }
-                    }
-                }
-            }
-        }
-    }
+        std::cout << "Initializing temperature field for " << Provider.NumberOfSpots
+                  << " spots, each of which takes approximately " << Provider.TimeBetweenSpots
+                  << " time steps to solidify" << std::endl;
+    TempInit_ProviderNoRemelt(Provider, nx, MyYSlices, MyYOffset, LocalDomainSize, NumberOfLayers, LayerHeight,
+                              SpotRadius + 1, CritTimeStep, UndercoolingChange, LayerID);
+}
 
-    // Copy initialized host data back to device
-    CritTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), CritTimeStep_Host);
-    LayerID = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerID_Host);
-    UndercoolingChange = Kokkos::create_mirror_view_and_copy(device_memory_space(), UndercoolingChange_Host);
+// Store the position of each cell's first solidification event in LayerTimeTempHistory in
+// SolidificationEventOffset_Host, with each cell's events stored consecutively. The last value is the total number of
+// events, which is also returned
+int calcSolidificationEventOffsets(int LocalActiveDomainSize, ViewI_H NumberOfSolidificationEvents_Host,
+                                   ViewI_H SolidificationEventOffset_Host) {
+
+    SolidificationEventOffset_Host(0) = 0;
+    for (int n = 0; n < LocalActiveDomainSize; n++)
+        SolidificationEventOffset_Host(n + 1) =
+            SolidificationEventOffset_Host(n) + NumberOfSolidificationEvents_Host(n);
+    return SolidificationEventOffset_Host(LocalActiveDomainSize);
 }
 
-// For an overlapping spot melt pattern, determine the maximum number of times a cell will melt/solidify as part of a
-// layer
-int calcMaxSolidificationEventsSpot(int nx, int MyYSlices, int NumberOfSpots, int NSpotsX, int SpotRadius,
-                                    int SpotOffset, int MyYOffset) {
-
-    ViewI2D_H MaxSolidificationEvents_Temp("SEvents_Temp", nx, MyYSlices);
-    for (int n = 0; n < NumberOfSpots; n++) {
-        int XSpotPos = SpotRadius + (n % NSpotsX) * SpotOffset;
-        int YSpotPos = SpotRadius + (n / NSpotsX) * SpotOffset;
-        for (int i = 0; i < nx; i++) {
-            float DistX = (float)(XSpotPos - i);
-            for (int j = 0; j < MyYSlices; j++) {
-                int YGlobal = j + MyYOffset;
-                float DistY = (float)(YSpotPos - YGlobal);
-                float TotDist = sqrt(DistX * DistX + DistY * DistY);
-                if (TotDist <= SpotRadius) {
-                    MaxSolidificationEvents_Temp(i, j)++;
-                }
-            }
-        }
-    }
-    int TempMax = 0;
-    for (int i = 0; i < nx; i++) {
-        for (int j = 0; j < MyYSlices; j++) {
-            if (MaxSolidificationEvents_Temp(i, j) > TempMax) {
-                TempMax = MaxSolidificationEvents_Temp(i, j);
-            }
-        }
-    }
-    // Max solidification events should be the same on each rank (and each layer, since the pattern for all layers is
-    // identical)
-    int GlobalMaxSEvents;
-    MPI_Allreduce(&TempMax, &GlobalMaxSEvents, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
-    return GlobalMaxSEvents;
+// Device version of calcSolidificationEventOffsets, for views NumberOfSolidificationEvents and
+// SolidificationEventOffset in device memory
+int calcSolidificationEventOffsets(int LocalActiveDomainSize, ViewI NumberOfSolidificationEvents,
+                                   ViewI SolidificationEventOffset) {
+
+    Kokkos::parallel_scan(
+        "SEventOffsets", LocalActiveDomainSize + 1, KOKKOS_LAMBDA(const int &n, int &Update, const bool &final) {
+            if (final)
+                SolidificationEventOffset(n) = Update;
+            if (n < LocalActiveDomainSize)
+                Update += NumberOfSolidificationEvents(n);
+        });
+    int NumberOfEvents;
+    Kokkos::deep_copy(NumberOfEvents, Kokkos::subview(SolidificationEventOffset, LocalActiveDomainSize));
+    return NumberOfEvents;
 }
 
 // Initialize temperature data for an array of overlapping spot melts (done at the start of each layer, with remelting)
@@ -950,177 +1275,104 @@ void TempInit_SpotRemelt(int layernumber, double G, double R, std::string, int i
                          int &MyYOffset, double deltax, double deltat, int ZBound_Low, int, int LocalActiveDomainSize,
                          int LocalDomainSize, ViewI &CritTimeStep, ViewF &UndercoolingChange,
                          ViewF &UndercoolingCurrent, int, double FreezingRange, ViewI &LayerID, int NSpotsX,
-                         int NSpotsY, int SpotRadius, int SpotOffset, ViewF3D &LayerTimeTempHistory,
-                         ViewI &NumberOfSolidificationEvents, ViewI &MeltTimeStep, ViewI &MaxSolidificationEvents,
-                         ViewI &SolidificationEventCounter) {
-
-    int NumberOfSpots = NSpotsX * NSpotsY;
-
-    // Temporary host view for the maximum number of times a cell in a given layer will solidify
-    ViewI_H MaxSolidificationEvents_Host =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
-    MaxSolidificationEvents_Host(layernumber) =
-        calcMaxSolidificationEventsSpot(nx, MyYSlices, NumberOfSpots, NSpotsX, SpotRadius, SpotOffset, MyYOffset);
-
-    // These views are initialized to zeros on the host (requires knowing MaxSolidificationEvents first), filled with
-    // data, and then copied to the device for layer "layernumber"
-    ViewF3D_H LayerTimeTempHistory_Host("TimeTempHistory_H", LocalActiveDomainSize,
-                                        MaxSolidificationEvents_Host(layernumber), 3);
-    ViewI_H NumberOfSolidificationEvents_Host("NumSEvents_H", LocalActiveDomainSize);
-
-    // Resize device views for active domain size if initializing first layer (don't resize after that, as all layers
-    // are the same)
-    if (layernumber == 0) {
-        Kokkos::resize(LayerTimeTempHistory, LocalActiveDomainSize, MaxSolidificationEvents_Host(0), 3);
-        Kokkos::resize(NumberOfSolidificationEvents, LocalActiveDomainSize);
-        Kokkos::resize(SolidificationEventCounter, LocalActiveDomainSize);
-        Kokkos::resize(MeltTimeStep, LocalDomainSize);
-    }
-
-    // Temporary host views for storing initialized temperature data for active region data structures
-    // No resize of device views necessary, as multilayer spot melt simulations have the same active domain size for all
-    // layers These views are copied to the host, updated for layer "layernumber", and later copied back to the device
-    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
-    ViewI_H MeltTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep);
-    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
-    ViewF_H UndercoolingChange_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange);
-
-    // First layer - all LayerID values are -1, to later be populated with other values
-    if (layernumber == 0)
-        Kokkos::deep_copy(LayerID_Host, -1);
-
-    // Outer edges of spots are initialized at the liquidus temperature
-    // Spots cool at constant rate R, spot thermal gradient = G
-    // Time between "start" of next spot is the time it takes for the previous spot
-    // to have entirely gone below the solidus temperature
-    float IsothermVelocity = (R / G) * deltat / deltax;                                  // in cells per time step
-    int TimeBetweenSpots = SpotRadius / IsothermVelocity + (FreezingRange / R) / deltat; // in time steps
+                         int NSpotsY, int SpotRadius, int SpotOffset, ViewF2D &LayerTimeTempHistory,
+                         ViewI &NumberOfSolidificationEvents, ViewI &SolidificationEventOffset, ViewI &MeltTimeStep,
+                         ViewI &MaxSolidificationEvents, ViewI &SolidificationEventCounter) {
 
+    SpotArrayProvider Provider(G, R, deltax, deltat, FreezingRange, NSpotsX, NSpotsY, SpotRadius, SpotOffset);
     if (id == 0)
-        std::cout << "Initializing temperature field for " << NumberOfSpots << " spots on layer " << layernumber
-                  << ", each of which takes approximately " << TimeBetweenSpots << " time steps to solidify"
-                  << std::endl;
-
-    for (int n = 0; n < NumberOfSpots; n++) {
-        if (id == 0)
-            std::cout << "Initializing spot " << n << " on layer " << layernumber << std::endl;
-        // Initialize LayerTimeTempHistory data values for this spot/this layer - relative to the layer bottom
-        int XSpotPos = SpotRadius + (n % NSpotsX) * SpotOffset;
-        int YSpotPos = SpotRadius + (n / NSpotsX) * SpotOffset;
-        for (int k = 0; k <= SpotRadius; k++) {
-            // Distance of this cell from the spot center
-            float DistZ = (float)(SpotRadius - k);
-            for (int i = 0; i < nx; i++) {
-                float DistX = (float)(XSpotPos - i);
-                for (int j = 0; j < MyYSlices; j++) {
-                    int YGlobal = j + MyYOffset;
-                    float DistY = (float)(YSpotPos - YGlobal);
-                    float TotDist = sqrt(DistX * DistX + DistY * DistY + DistZ * DistZ);
-                    if (TotDist <= SpotRadius) {
-                        int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
-                        // Melt time
-                        LayerTimeTempHistory_Host(D3D1ConvPosition, NumberOfSolidificationEvents_Host(D3D1ConvPosition),
-                                                  0) = 1 + TimeBetweenSpots * n;
-                        // Liquidus time
-                        LayerTimeTempHistory_Host(D3D1ConvPosition, NumberOfSolidificationEvents_Host(D3D1ConvPosition),
-                                                  1) =
-                            1 + (int)(((float)(SpotRadius)-TotDist) / IsothermVelocity) + TimeBetweenSpots * n;
-                        // Cooling rate
-                        LayerTimeTempHistory_Host(D3D1ConvPosition, NumberOfSolidificationEvents_Host(D3D1ConvPosition),
-                                                  2) = R * deltat;
-                        NumberOfSolidificationEvents_Host(D3D1ConvPosition)++;
-                    }
-                }
-            }
-        }
-    }
+        std::cout << "Initializing temperature field for " << Provider.NumberOfSpots << " spots on layer "
+                  << layernumber << ", each of which takes approximately " << Provider.TimeBetweenSpots
+                  << " time steps to solidify" << std::endl;
+    // All layers have the same temperature field, relative to the layer bottom
+    int MaxEvents = TempInit_ProviderRemelt(Provider, layernumber, nx, MyYSlices, MyYOffset, ZBound_Low,
+                                            LocalActiveDomainSize, LocalDomainSize, CritTimeStep, UndercoolingChange,
+                                            UndercoolingCurrent, LayerID, LayerTimeTempHistory,
+                                            NumberOfSolidificationEvents, SolidificationEventOffset, MeltTimeStep,
+                                            MaxSolidificationEvents, SolidificationEventCounter);
+    if (id == 0)
+        std::cout << "Spot melt temperature field with remelting for layer " << layernumber
+                  << " initialized; each cell will solidify up to " << MaxEvents << " times" << std::endl;
+}
 
-    // Initialize data for first melt-solidification event for all cells with data in this layer
-    for (int k = 0; k <= SpotRadius; k++) {
-        for (int i = 0; i < nx; i++) {
-            for (int j = 0; j < MyYSlices; j++) {
-                int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
-                int GlobalD3D1ConvPosition = (k + ZBound_Low) * nx * MyYSlices + i * MyYSlices + j;
-                if (NumberOfSolidificationEvents_Host(D3D1ConvPosition) > 0) {
-                    MeltTimeStep_Host(GlobalD3D1ConvPosition) = LayerTimeTempHistory_Host(D3D1ConvPosition, 0, 0);
-                    CritTimeStep_Host(GlobalD3D1ConvPosition) = LayerTimeTempHistory_Host(D3D1ConvPosition, 0, 1);
-                    UndercoolingChange_Host(GlobalD3D1ConvPosition) = LayerTimeTempHistory_Host(D3D1ConvPosition, 0, 2);
-                    LayerID_Host(GlobalD3D1ConvPosition) = layernumber;
-                }
-                else {
-                    MeltTimeStep_Host(GlobalD3D1ConvPosition) = 0;
-                    CritTimeStep_Host(GlobalD3D1ConvPosition) = 0;
-                    UndercoolingChange_Host(GlobalD3D1ConvPosition) = 0.0;
-                }
-            }
-        }
-    }
+// Initialize temperature data for a raster scan by a moving point heat source (done during simulation initialization,
+// no remelting)
+void TempInit_RasterNoRemelt(const RosenthalRasterProvider &Raster, int id, int nx, int MyYSlices, int MyYOffset,
+                             int LocalDomainSize, ViewI &CritTimeStep, ViewF &UndercoolingChange, int LayerHeight,
+                             int NumberOfLayers, ViewI &LayerID) {
 
-    // Initial undercooling of all cells is 0, solidification event counter is 0 at the start of each layer
-    Kokkos::deep_copy(UndercoolingCurrent, 0.0);
-    Kokkos::deep_copy(SolidificationEventCounter, 0.0);
+    if (id == 0)
+        std::cout << "Initializing temperature field for " << Raster.NumberOfTracks
+                  << " raster tracks per layer, with a melt pool depth and half-width of " << Raster.PoolRadius
+                  << " cells" << std::endl;
+    TempInit_ProviderNoRemelt(Raster, nx, MyYSlices, MyYOffset, LocalDomainSize, NumberOfLayers, LayerHeight,
+                              Raster.PoolRadius + 1, CritTimeStep, UndercoolingChange, LayerID);
+}
 
-    // Copy host view data back to device
-    MaxSolidificationEvents = Kokkos::create_mirror_view_and_copy(device_memory_space(), MaxSolidificationEvents_Host);
-    LayerID = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerID_Host);
-    MeltTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), MeltTimeStep_Host);
-    CritTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), CritTimeStep_Host);
-    UndercoolingChange = Kokkos::create_mirror_view_and_copy(device_memory_space(), UndercoolingChange_Host);
-    LayerTimeTempHistory = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerTimeTempHistory_Host);
-    NumberOfSolidificationEvents =
-        Kokkos::create_mirror_view_and_copy(device_memory_space(), NumberOfSolidificationEvents_Host);
-    MPI_Barrier(MPI_COMM_WORLD);
+// Initialize temperature data for a raster scan by a moving point heat source (done at the start of each layer, with
+// remelting)
+void TempInit_RasterRemelt(const RosenthalRasterProvider &Raster, int layernumber, int id, int nx, int MyYSlices,
+                           int MyYOffset, int ZBound_Low, int LocalActiveDomainSize, int LocalDomainSize,
+                           ViewI &CritTimeStep, ViewF &UndercoolingChange, ViewF &UndercoolingCurrent, ViewI &LayerID,
+                           ViewF2D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
+                           ViewI &SolidificationEventOffset, ViewI &MeltTimeStep, ViewI &MaxSolidificationEvents,
+                           ViewI &SolidificationEventCounter) {
+
+    // All layers have the same temperature field, relative to the layer bottom
+    int MaxEvents = TempInit_ProviderRemelt(Raster, layernumber, nx, MyYSlices, MyYOffset, ZBound_Low,
+                                            LocalActiveDomainSize, LocalDomainSize, CritTimeStep, UndercoolingChange,
+                                            UndercoolingCurrent, LayerID, LayerTimeTempHistory,
+                                            NumberOfSolidificationEvents, SolidificationEventOffset, MeltTimeStep,
+                                            MaxSolidificationEvents, SolidificationEventCounter);
     if (id == 0)
-        std::cout << "Spot melt temperature field with remelting for layer " << layernumber
-                  << " initialized; each cell will solidify up to " << MaxSolidificationEvents_Host(layernumber)
-                  << " times" << std::endl;
+        std::cout << "Raster scan temperature field with remelting for layer " << layernumber
+                  << " initialized; each cell will solidify up to " << MaxEvents << " times" << std::endl;
 }
 
-// Read data from storage, and calculate the normalized x value of the data point
-int getTempCoordX(int i, double XMin, double deltax, const std::vector<double> &RawData) {
-    int XInt = round((RawData[i] - XMin) / deltax);
+// Read data from storage, obtaining the normalized x value of the data point
+int getTempCoordX(int i, const RawTemperatureData &RawData) {
+    int XInt = RawData.XInt[i];
     return XInt;
 }
-// Read data from storage, and calculate the normalized y value of the data point
-int getTempCoordY(int i, double YMin, double deltax, const std::vector<double> &RawData) {
-    int YInt = round((RawData[i + 1] - YMin) / deltax);
+// Read data from storage, obtaining the normalized y value of the data point
+int getTempCoordY(int i, const RawTemperatureData &RawData) {
+    int YInt = RawData.YInt[i];
     return YInt;
 }
-// Read data from storage, and calculate the normalized z value of the data point
-int getTempCoordZ(int i, double deltax, const std::vector<double> &RawData, int LayerHeight, int LayerCounter,
-                  double *ZMinLayer) {
-    int ZInt = round((RawData[i + 2] + deltax * LayerHeight * LayerCounter - ZMinLayer[LayerCounter]) / deltax);
+// Read data from storage, and calculate the normalized z value of the data point relative to the bottom of layer
+// LayerCounter's data
+int getTempCoordZ(int i, const RawTemperatureData &RawData, int LayerHeight, int LayerCounter, double *ZMinLayer) {
+    int ZOffset = round((RawData.ZMin + RawData.deltax * LayerHeight * LayerCounter - ZMinLayer[LayerCounter]) /
+                        RawData.deltax);
+    int ZInt = RawData.ZInt[i] + ZOffset;
     return ZInt;
 }
 // Read data from storage, obtain melting time
-double getTempCoordTM(int i, const std::vector<double> &RawData) {
-    double TMelting = RawData[i + 3];
+double getTempCoordTM(int i, const RawTemperatureData &RawData) {
+    double TMelting = RawData.TMelting[i];
     return TMelting;
 }
 // Read data from storage, obtain liquidus time
-double getTempCoordTL(int i, const std::vector<double> &RawData) {
-    double TLiquidus = RawData[i + 4];
+double getTempCoordTL(int i, const RawTemperatureData &RawData) {
+    double TLiquidus = RawData.TLiquidus[i];
     return TLiquidus;
 }
 // Read data from storage, obtain cooling rate
-double getTempCoordCR(int i, const std::vector<double> &RawData) {
-    double CoolingRate = RawData[i + 5];
+double getTempCoordCR(int i, const RawTemperatureData &RawData) {
+    double CoolingRate = RawData.CoolingRate[i];
     return CoolingRate;
 }
 
-// Initialize temperature data for a problem using the reduced/sparse data format and input temperature data from
-// file(s)
-void TempInit_ReadDataNoRemelt(int id, int &nx, int &MyYSlices, int &MyYOffset, double deltax, int HTtoCAratio,
-                               double deltat, int, int LocalDomainSize, ViewI &CritTimeStep, ViewF &UndercoolingChange,
-                               double XMin, double YMin, double ZMin, double *ZMinLayer, double *ZMaxLayer,
-                               int LayerHeight, int NumberOfLayers, int *FinishTimeStep, double FreezingRange,
-                               ViewI &LayerID, int *FirstValue, int *LastValue, std::vector<double> RawData, int ny) {
-
-    // These views are initialized to zeros on the host, filled with data, and then copied to the device for layer
-    // "layernumber"
-    ViewI_H LayerID_Host(Kokkos::ViewAllocateWithoutInitializing("LayerID_H"), LocalDomainSize);
-    ViewI_H CritTimeStep_Host("CritTimeStep_H", LocalDomainSize);
-    ViewF_H UndercoolingChange_Host("UndercoolingChange_H", LocalDomainSize);
+// Place the temperature data for layer "LayerCounter" into the device views CritTimeStep, UndercoolingChange, and
+// LayerID, which hold the cells starting at global Z coordinate FrozenZ. Only cells between global Z coordinates
+// InitZ_Low and InitZ_High (inclusive) are placed; layer data outside of these Z bounds is still used to find the
+// layer's time bounds
+void placeLayerTempData_NoRemelt(int LayerCounter, int id, int nx, int MyYSlices, int MyYOffset, double deltax,
+                                 int HTtoCAratio, double deltat, double ZMin, double *ZMinLayer, double *ZMaxLayer,
+                                 int LayerHeight, int *FinishTimeStep, double FreezingRange, int *FirstValue,
+                                 int *LastValue, const RawTemperatureData &RawData, int ny, int InitZ_Low,
+                                 int InitZ_High, int FrozenZ, ViewI CritTimeStep, ViewF UndercoolingChange,
+                                 ViewI LayerID) {
 
     // Temperature data read
     // If HTtoCAratio > 1, an interpolation of input temperature data is needed
@@ -1133,211 +1385,262 @@ void TempInit_ReadDataNoRemelt(int id, int &nx, int &MyYSlices, int &MyYOffset,
     if (UpperYBound >= ny)
         UpperYBound = ny - 1;
 
-    // LayerID = -1 for cells that don't solidify as part of any layer of the multilayer problem
-    Kokkos::deep_copy(LayerID_Host, -1);
-
-    // removed unused LayerwiseTSOffset variable
+    double SmallestTime = 1000000000;
+    double SmallestTime_Global = 1000000000;
+    double LargestTime = 0;
+    double LargestTime_Global = 0;
 
-    for (int LayerCounter = 0; LayerCounter < NumberOfLayers; LayerCounter++) {
+    // How many CA cells in the vertical direction are needed to hold this layer's temperature data?
+    int nzTempValuesThisLayer = round((ZMaxLayer[LayerCounter] - ZMinLayer[LayerCounter]) / deltax) + 1;
+    int nyTempValuesThisLayer = UpperYBound - LowerYBound + 1;
+    int TempGridSize = nzTempValuesThisLayer * nx * nyTempValuesThisLayer;
+    if (id == 0)
+        std::cout << "Initializing temporary temperature data structures with " << nzTempValuesThisLayer
+                  << " cells in z direction" << std::endl;
+    if (id == 0)
+        std::cout << "Layer " << LayerCounter << " rank " << id << " ZMin this layer is " << ZMinLayer[LayerCounter]
+                  << std::endl;
+    // Data was already read into the "RawData" temporary data structure
+    // Determine which section of "RawData" is relevant for this layer of the overall domain
+    int StartRange = FirstValue[LayerCounter];
+    int EndRange = LastValue[LayerCounter];
+    int NumDataPoints = EndRange - StartRange;
+    if (id == 0)
+        std::cout << "Range for layer " << LayerCounter << " on rank 0 is " << StartRange << " to " << EndRange
+                  << std::endl;
+    MPI_Barrier(MPI_COMM_WORLD);
 
-        double SmallestTime = 1000000000;
-        double SmallestTime_Global = 1000000000;
-        double LargestTime = 0;
-        double LargestTime_Global = 0;
+    // Location of each of this layer's data points on the layer's temperature grid (Z, X, Y - LowerYBound), along with
+    // their TL and CR values, copied to the device
+    ViewI_H TempGridLocation_Host(Kokkos::ViewAllocateWithoutInitializing("TempGridLocation_H"), NumDataPoints);
+    ViewD_H TLiquidus_Host(Kokkos::ViewAllocateWithoutInitializing("TLiquidus_H"), NumDataPoints);
+    ViewD_H CoolingRate_Host(Kokkos::ViewAllocateWithoutInitializing("CoolingRate_H"), NumDataPoints);
+    for (int n = 0; n < NumDataPoints; n++) {
+        int i = StartRange + n;
+        int XInt = getTempCoordX(i, RawData);
+        int YInt = getTempCoordY(i, RawData);
+        int ZInt = getTempCoordZ(i, RawData, LayerHeight, LayerCounter, ZMinLayer);
+        TempGridLocation_Host(n) = (ZInt * nx + XInt) * nyTempValuesThisLayer + YInt - LowerYBound;
+        TLiquidus_Host(n) = getTempCoordTL(i, RawData);
+        CoolingRate_Host(n) = getTempCoordCR(i, RawData);
+    }
+    ViewI TempGridLocation = Kokkos::create_mirror_view_and_copy(device_memory_space(), TempGridLocation_Host);
+    ViewD TLiquidus = Kokkos::create_mirror_view_and_copy(device_memory_space(), TLiquidus_Host);
+    ViewD CoolingRate = Kokkos::create_mirror_view_and_copy(device_memory_space(), CoolingRate_Host);
+
+    // Group the data points by temperature grid location: count the data points at each location (storing each data
+    // point's position among them), then use the counts to find where each location's list of data points starts
+    ViewI TempGridCount("TempGridCount", TempGridSize);
+    ViewI TempGridStart(Kokkos::ViewAllocateWithoutInitializing("TempGridStart"), TempGridSize);
+    ViewI TempGridPosition(Kokkos::ViewAllocateWithoutInitializing("TempGridPosition"), NumDataPoints);
+    ViewI TempGridDataPoints(Kokkos::ViewAllocateWithoutInitializing("TempGridDataPoints"), NumDataPoints);
+    Kokkos::parallel_for(
+        "CountTempDataPoints", NumDataPoints, KOKKOS_LAMBDA(const int &n) {
+            TempGridPosition(n) = Kokkos::atomic_fetch_add(&TempGridCount(TempGridLocation(n)), 1);
+        });
+    Kokkos::parallel_scan(
+        "TempGridStart", TempGridSize, KOKKOS_LAMBDA(const int &m, int &Update, const bool &final) {
+            if (final)
+                TempGridStart(m) = Update;
+            Update += TempGridCount(m);
+        });
+    Kokkos::parallel_for(
+        "GroupTempDataPoints", NumDataPoints, KOKKOS_LAMBDA(const int &n) {
+            TempGridDataPoints(TempGridStart(TempGridLocation(n)) + TempGridPosition(n)) = n;
+        });
 
-        // How many CA cells in the vertical direction are needed to hold this layer's temperature data?
-        int nzTempValuesThisLayer = round((ZMaxLayer[LayerCounter] - ZMinLayer[LayerCounter]) / deltax) + 1;
-        if (id == 0)
-            std::cout << "Initializing temporary temperature data structures with " << nzTempValuesThisLayer
-                      << " cells in z direction" << std::endl;
-        if (id == 0)
-            std::cout << "Layer " << LayerCounter << " rank " << id << " ZMin this layer is " << ZMinLayer[LayerCounter]
-                      << std::endl;
-        std::vector<std::vector<std::vector<double>>> CR, CritTL;
-        for (int k = 0; k < nzTempValuesThisLayer; k++) {
-            std::vector<std::vector<double>> TemperatureXX;
-            for (int i = 0; i < nx; i++) {
-                std::vector<double> TemperatureX;
-                for (int j = LowerYBound; j <= UpperYBound; j++) {
-                    TemperatureX.push_back(-1.0);
+    // Liquidus time/cooling rate - only keep values for the last time that this point went below the liquidus. Each
+    // location's data points are considered in the order they were read, marking those that set a new liquidus time,
+    // and the largest TSolidus value (based on liquidus/cooling rate/freezing range) over these points is stored
+    ViewD CritTL(Kokkos::ViewAllocateWithoutInitializing("CritTL"), TempGridSize);
+    ViewD CR(Kokkos::ViewAllocateWithoutInitializing("CR"), TempGridSize);
+    ViewI NewLiquidusTime("NewLiquidusTime", NumDataPoints);
+    Kokkos::parallel_reduce(
+        "PlaceTempDataPoints", TempGridSize,
+        KOKKOS_LAMBDA(const int &m, double &LocalLargestTime) {
+            int FirstPoint = TempGridStart(m);
+            int LastPoint = FirstPoint + TempGridCount(m);
+            // Sort this location's data points back into the order they were read
+            for (int p = FirstPoint + 1; p < LastPoint; p++) {
+                int n = TempGridDataPoints(p);
+                int q = p - 1;
+                while ((q >= FirstPoint) && (TempGridDataPoints(q) > n)) {
+                    TempGridDataPoints(q + 1) = TempGridDataPoints(q);
+                    q--;
                 }
-                TemperatureXX.push_back(TemperatureX);
+                TempGridDataPoints(q + 1) = n;
             }
-            CR.push_back(TemperatureXX);
-            CritTL.push_back(TemperatureXX);
-        }
-        // Data was already read into the "RawData" temporary data structure
-        // Determine which section of "RawData" is relevant for this layer of the overall domain
-        int StartRange = FirstValue[LayerCounter];
-        int EndRange = LastValue[LayerCounter];
-        if (id == 0)
-            std::cout << "Range for layer " << LayerCounter << " on rank 0 is " << StartRange << " to " << EndRange
-                      << std::endl;
-        MPI_Barrier(MPI_COMM_WORLD);
-        for (int i = StartRange; i < EndRange; i += 6) {
-
-            // Get the integer X, Y, Z coordinates associated with this data point, along with TL and CR values
-            int XInt = getTempCoordX(i, XMin, deltax, RawData);
-            int YInt = getTempCoordY(i, YMin, deltax, RawData);
-            int ZInt = getTempCoordZ(i, deltax, RawData, LayerHeight, LayerCounter, ZMinLayer);
-            double TLiquidus = getTempCoordTL(i, RawData);
-            // Liquidus time/cooling rate - only keep values for the last time that this point went below the liquidus
-            if (TLiquidus > CritTL[ZInt][XInt][YInt - LowerYBound]) {
-                CritTL[ZInt][XInt][YInt - LowerYBound] = TLiquidus;
-                if (TLiquidus < SmallestTime) {
-                    // Store smallest read TLiquidus value over all cells
-                    SmallestTime = RawData[i];
-                }
-                double CoolingRate = getTempCoordCR(i, RawData);
-                CR[ZInt][XInt][YInt - LowerYBound] = CoolingRate;
-                double SolidusTime =
-                    CritTL[ZInt][XInt][YInt - LowerYBound] + FreezingRange / CR[ZInt][XInt][YInt - LowerYBound];
-                if (SolidusTime > LargestTime) {
-                    // Store largest TSolidus value (based on liquidus/cooling rate/freezing range) over all cells
-                    LargestTime = SolidusTime;
+            double CritTL_m = -1.0;
+            double CR_m = -1.0;
+            for (int p = FirstPoint; p < LastPoint; p++) {
+                int n = TempGridDataPoints(p);
+                if (TLiquidus(n) > CritTL_m) {
+                    CritTL_m = TLiquidus(n);
+                    CR_m = CoolingRate(n);
+                    NewLiquidusTime(n) = 1;
+                    double SolidusTime = CritTL_m + FreezingRange / CR_m;
+                    if (SolidusTime > LocalLargestTime)
+                        LocalLargestTime = SolidusTime;
                 }
             }
+            CritTL(m) = CritTL_m;
+            CR(m) = CR_m;
+        },
+        Kokkos::Max<double>(LargestTime));
+    LargestTime = std::max(LargestTime, 0.0);
+
+    // Store smallest read TLiquidus value over all cells, checking the points that set a new liquidus time in the order
+    // they were read
+    ViewI_H NewLiquidusTime_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NewLiquidusTime);
+    for (int n = 0; n < NumDataPoints; n++) {
+        if ((NewLiquidusTime_Host(n) == 1) && (TLiquidus_Host(n) < SmallestTime)) {
+            SmallestTime = TLiquidus_Host(n);
         }
+    }
 
-        // If reading data from files without a script, time values start at 0 for each layer
-        // If reading data with input from a script time values each layer are continuous, are should be
-        // renormalized to 0 for each layer
-        MPI_Reduce(&LargestTime, &LargestTime_Global, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
-        MPI_Bcast(&LargestTime_Global, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-        MPI_Reduce(&SmallestTime, &SmallestTime_Global, 1, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
-        MPI_Bcast(&SmallestTime_Global, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    // If reading data from files without a script, time values start at 0 for each layer
+    // If reading data with input from a script time values each layer are continuous, are should be
+    // renormalized to 0 for each layer
+    MPI_Reduce(&LargestTime, &LargestTime_Global, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&LargestTime_Global, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&SmallestTime, &SmallestTime_Global, 1, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&SmallestTime_Global, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
 
-        if (id == 0) {
-            std::cout << "Smallest time globally for layer " << LayerCounter << " is " << SmallestTime_Global
-                      << std::endl;
-            std::cout << "Largest time globally for layer " << LayerCounter << " is " << LargestTime_Global
-                      << std::endl;
-        }
-        // renormalize last time step value with the start of the layer as time step 0
-        // Previously normalized "time 0" to be the first time a cell goes below the liquidus; this is removed such that
-        // time is consistent with simulations that include remelting, which don't normalize "time 0"
-        FinishTimeStep[LayerCounter] = round(LargestTime_Global / deltat);
-        if (id == 0)
-            std::cout << " Layer " << LayerCounter << " FINISH TIME STEP IS " << FinishTimeStep[LayerCounter]
-                      << std::endl;
-        if (id == 0)
-            std::cout << "Layer " << LayerCounter << " temperatures read" << std::endl;
-
-        // Data interpolation between heat transport and CA grids, if necessary
-        if (HTtoCAratio != 1) {
-            for (int k = 0; k < nzTempValuesThisLayer; k++) {
-                int LowZ = k - (k % HTtoCAratio);
-                int HighZ = LowZ + HTtoCAratio;
-                double FHighZ = (double)(k - LowZ) / (double)(HTtoCAratio);
-                double FLowZ = 1.0 - FHighZ;
-                if (HighZ > nzTempValuesThisLayer - 1)
-                    HighZ = LowZ;
-                for (int i = 0; i < nx; i++) {
-                    int LowX = i - (i % HTtoCAratio);
-                    int HighX = LowX + HTtoCAratio;
-                    double FHighX = (double)(i - LowX) / (double)(HTtoCAratio);
-                    double FLowX = 1.0 - FHighX;
-                    if (HighX >= nx)
-                        HighX = LowX;
-
-                    for (int j = 0; j <= UpperYBound - LowerYBound; j++) {
-                        int LowY = j - (j % HTtoCAratio);
-                        int HighY = LowY + HTtoCAratio;
-                        double FHighY = (float)(j - LowY) / (float)(HTtoCAratio);
-                        double FLowY = 1.0 - FHighY;
-                        if (HighY > UpperYBound - LowerYBound)
-                            HighY = LowY;
-                        double Pt1 = CritTL[LowZ][LowX][LowY];
-                        double Pt2 = CritTL[LowZ][HighX][LowY];
-                        double Pt12 = FLowX * Pt1 + FHighX * Pt2;
-                        double Pt3 = CritTL[LowZ][LowX][HighY];
-                        double Pt4 = CritTL[LowZ][HighX][HighY];
-                        double Pt34 = FLowX * Pt3 + FHighX * Pt4;
-                        double Pt1234 = Pt12 * FLowY + Pt34 * FHighY;
-                        double Pt5 = CritTL[HighZ][LowX][LowY];
-                        double Pt6 = CritTL[HighZ][HighX][LowY];
-                        double Pt56 = FLowX * Pt5 + FHighX * Pt6;
-                        double Pt7 = CritTL[HighZ][LowX][HighY];
-                        double Pt8 = CritTL[HighZ][HighX][HighY];
-                        double Pt78 = FLowX * Pt7 + FHighX * Pt8;
-                        double Pt5678 = Pt56 * FLowY + Pt78 * FHighY;
-                        if ((Pt1 > 0) && (Pt2 > 0) && (Pt3 > 0) && (Pt4 > 0) && (Pt5 > 0) && (Pt6 > 0) && (Pt7 > 0) &&
-                            (Pt8 > 0)) {
-                            CritTL[k][i][j] = Pt1234 * FLowZ + Pt5678 * FHighZ;
-                        }
-                        Pt1 = CR[LowZ][LowX][LowY];
-                        Pt2 = CR[LowZ][HighX][LowY];
-                        Pt12 = FLowX * Pt1 + FHighX * Pt2;
-                        Pt3 = CR[LowZ][LowX][HighY];
-                        Pt4 = CR[LowZ][HighX][HighY];
-                        Pt34 = FLowX * Pt3 + FHighX * Pt4;
-                        Pt1234 = Pt12 * FLowY + Pt34 * FHighY;
-                        Pt5 = CR[HighZ][LowX][LowY];
-                        Pt6 = CR[HighZ][HighX][LowY];
-                        Pt56 = FLowX * Pt5 + FHighX * Pt6;
-                        Pt7 = CR[HighZ][LowX][HighY];
-                        Pt8 = CR[HighZ][HighX][HighY];
-                        Pt78 = FLowX * Pt7 + FHighX * Pt8;
-                        Pt5678 = Pt56 * FLowY + Pt78 * FHighY;
-                        if ((Pt1 > 0) && (Pt2 > 0) && (Pt3 > 0) && (Pt4 > 0) && (Pt5 > 0) && (Pt6 > 0) && (Pt7 > 0) &&
-                            (Pt8 > 0)) {
-                            CR[k][i][j] = Pt1234 * FLowZ + Pt5678 * FHighZ;
-                        }
-                    }
-                }
-            }
-        }
-        MPI_Barrier(MPI_COMM_WORLD);
-        if (id == 0)
-            std::cout << "Interpolation done" << std::endl;
+    if (id == 0) {
+        std::cout << "Smallest time globally for layer " << LayerCounter << " is " << SmallestTime_Global << std::endl;
+        std::cout << "Largest time globally for layer " << LayerCounter << " is " << LargestTime_Global << std::endl;
+    }
+    // renormalize last time step value with the start of the layer as time step 0
+    // Previously normalized "time 0" to be the first time a cell goes below the liquidus; this is removed such that
+    // time is consistent with simulations that include remelting, which don't normalize "time 0"
+    FinishTimeStep[LayerCounter] = round(LargestTime_Global / deltat);
+    if (id == 0)
+        std::cout << " Layer " << LayerCounter << " FINISH TIME STEP IS " << FinishTimeStep[LayerCounter] << std::endl;
+    if (id == 0)
+        std::cout << "Layer " << LayerCounter << " temperatures read" << std::endl;
 
-        // Convert CritTL, CritTS matrices into CritTimeStep and UndercoolingChange (change in undercooling with
-        // time step) "ZMin" is the global Z coordinate that corresponds to cells at Z = 0, "ZMax" is the global Z
-        // coordinate that corresponds to cells at Z = nz-1
-        if (id == 0)
-            std::cout << "Layer " << LayerCounter << " data belongs to global z coordinates of "
-                      << round((ZMinLayer[LayerCounter] - ZMin) / deltax) << " through "
-                      << round((ZMinLayer[LayerCounter] - ZMin) / deltax) + nzTempValuesThisLayer - 1 << std::endl;
-
-        for (int k = 0; k < nzTempValuesThisLayer; k++) {
-            for (int i = 0; i < nx; i++) {
-                for (int jj = LowerYBound; jj <= UpperYBound; jj++) {
-                    if ((jj >= MyYOffset) && (jj < MyYOffset + MyYSlices)) {
-                        int Adj_j = jj - MyYOffset;
-                        // Liquidus time normalized to the time at which the layer started solidifying
-                        double CTLiq = CritTL[k][i][jj - LowerYBound] - SmallestTime_Global;
-                        if (CTLiq > 0) {
-                            // Where does this layer's temperature data belong on the global (including all layers)
-                            // grid? Adjust Z coordinate by ZMin
-                            int ZOffset = round((ZMinLayer[LayerCounter] - ZMin) / deltax) + k;
-                            int Coord3D1D = ZOffset * nx * MyYSlices + i * MyYSlices + Adj_j;
-                            CritTimeStep_Host(Coord3D1D) = round(CTLiq / deltat);
-                            LayerID_Host(Coord3D1D) = LayerCounter;
-                            UndercoolingChange_Host(Coord3D1D) = std::abs(CR[k][i][jj - LowerYBound]) * deltat;
-                        }
-                    }
+    // Convert CritTL, CR values into CritTimeStep and UndercoolingChange (change in undercooling with time step),
+    // interpolating between heat transport and CA grids if necessary. "ZMin" is the global Z coordinate that
+    // corresponds to cells at Z = 0, "ZMax" is the global Z coordinate that corresponds to cells at Z = nz-1
+    if (id == 0)
+        std::cout << "Layer " << LayerCounter << " data belongs to global z coordinates of "
+                  << round((ZMinLayer[LayerCounter] - ZMin) / deltax) << " through "
+                  << round((ZMinLayer[LayerCounter] - ZMin) / deltax) + nzTempValuesThisLayer - 1 << std::endl;
+
+    // Only this layer's data between InitZ_Low and InitZ_High on the global grid is interpolated and placed
+    int LayerZOffset = round((ZMinLayer[LayerCounter] - ZMin) / deltax);
+    int kLow = std::max(0, InitZ_Low - LayerZOffset);
+    int kHigh = std::min(nzTempValuesThisLayer - 1, InitZ_High - LayerZOffset);
+    if (kHigh >= kLow) {
+        Kokkos::parallel_for(
+            "InterpolateTempData",
+            Kokkos::MDRangePolicy<Kokkos::Rank<3, Kokkos::Iterate::Right, Kokkos::Iterate::Right>>(
+                {kLow, 0, 0}, {kHigh + 1, nx, MyYSlices}),
+            KOKKOS_LAMBDA(const int k, const int i, const int Adj_j) {
+                int j = Adj_j + MyYOffset - LowerYBound;
+                double CritTL_kij = interpolateTempData(CritTL, k, i, j, nzTempValuesThisLayer, nx,
+                                                        nyTempValuesThisLayer, HTtoCAratio);
+                double CR_kij =
+                    interpolateTempData(CR, k, i, j, nzTempValuesThisLayer, nx, nyTempValuesThisLayer, HTtoCAratio);
+                // Liquidus time normalized to the time at which the layer started solidifying
+                double CTLiq = CritTL_kij - SmallestTime_Global;
+                if (CTLiq > 0) {
+                    // Where does this layer's temperature data belong on the global (including all layers) grid?
+                    // Adjust Z coordinate by ZMin, and store relative to the first row held in the views
+                    int ZOffset = LayerZOffset + k;
+                    int Coord3D1D = (ZOffset - FrozenZ) * nx * MyYSlices + i * MyYSlices + Adj_j;
+                    CritTimeStep(Coord3D1D) = round(CTLiq / deltat);
+                    LayerID(Coord3D1D) = LayerCounter;
+                    UndercoolingChange(Coord3D1D) = fabs(CR_kij) * deltat;
                 }
-            }
-        }
-    } // End read over all temperature files and placement of data
-
-    // Copy initialized host data back to device
-    CritTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), CritTimeStep_Host);
-    LayerID = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerID_Host);
-    UndercoolingChange = Kokkos::create_mirror_view_and_copy(device_memory_space(), UndercoolingChange_Host);
+            });
+    }
+    Kokkos::fence();
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (id == 0)
+        std::cout << "Interpolation done" << std::endl;
 }
 
-// Calculate the number of times that a cell in layer "layernumber" undergoes melting/solidification, and store in
-// MaxSolidificationEvents_Host
-void calcMaxSolidificationEventsR(int id, int layernumber, int TempFilesInSeries, ViewI_H MaxSolidificationEvents_Host,
-                                  int StartRange, int EndRange, std::vector<double> RawData, double XMin, double YMin,
-                                  double deltax, double *ZMinLayer, int LayerHeight, int nx, int MyYSlices,
-                                  int MyYOffset, int LocalActiveDomainSize) {
+// Initialize temperature data for a problem using the reduced/sparse data format and input temperature data from
+// file(s)
+void TempInit_ReadDataNoRemelt(int id, int &nx, int &MyYSlices, int &MyYOffset, double deltax, int HTtoCAratio,
+                               double deltat, int nz, int LocalDomainSize, ViewI &CritTimeStep,
+                               ViewF &UndercoolingChange, double ZMin, double *ZMinLayer, double *ZMaxLayer,
+                               int LayerHeight, int NumberOfLayers, int *FinishTimeStep, double FreezingRange,
+                               ViewI &LayerID, int *FirstValue, int *LastValue, const RawTemperatureData &RawData,
+                               int ny) {
 
-    if (layernumber > TempFilesInSeries) {
-        // Use the value from a previously checked layer, since the time-temperature history is reused
-        if (TempFilesInSeries == 1) {
-            // All layers have the same temperature data, MaxSolidificationEvents for this layer is the same as the last
+    // These views are initialized to zeros on the device, then filled with data from each layer
+    CritTimeStep = ViewI("CritTimeStep", LocalDomainSize);
+    UndercoolingChange = ViewF("UndercoolingChange", LocalDomainSize);
+    LayerID = ViewI(Kokkos::ViewAllocateWithoutInitializing("LayerID"), LocalDomainSize);
+
+    // LayerID = -1 for cells that don't solidify as part of any layer of the multilayer problem
+    Kokkos::deep_copy(LayerID, -1);
+
+    // Data from all layers is placed into the views, with data from later layers overwriting that from earlier ones
+    for (int LayerCounter = 0; LayerCounter < NumberOfLayers; LayerCounter++)
+        placeLayerTempData_NoRemelt(LayerCounter, id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio, deltat, ZMin,
+                                    ZMinLayer, ZMaxLayer, LayerHeight, FinishTimeStep, FreezingRange, FirstValue,
+                                    LastValue, RawData, ny, 0, nz - 1, 0, CritTimeStep, UndercoolingChange, LayerID);
+}
+
+// Initialize temperature data for a problem using the reduced/sparse data format and input temperature data from
+// file(s), one layer at a time: only cells between global Z coordinates InitZ_Low and InitZ_High (the cells above the
+// previous layer, through the top of this layer), along with the row of cells directly above them, are initialized. As
+// data from later layers overwrites that from earlier ones, all layers with data in these Z bounds are considered.
+// Cells below global Z coordinate FrozenZ are not stored in the views
+void TempInit_ReadDataNoRemelt_Layer(int layernumber, int id, int nx, int MyYSlices, int MyYOffset, double deltax,
+                                     int HTtoCAratio, double deltat, int nz, ViewI CritTimeStep,
+                                     ViewF UndercoolingChange, ViewI LayerID, double ZMin, double *ZMinLayer,
+                                     double *ZMaxLayer, int LayerHeight, int NumberOfLayers, int *FinishTimeStep,
+                                     double FreezingRange, int *FirstValue, int *LastValue,
+                                     const RawTemperatureData &RawData, int ny, int InitZ_Low, int InitZ_High,
+                                     int FrozenZ) {
+
+    // Cells that are never initialized do not solidify as part of any layer
+    if (layernumber == 0) {
+        Kokkos::deep_copy(CritTimeStep, 0);
+        Kokkos::deep_copy(UndercoolingChange, 0.0);
+        Kokkos::deep_copy(LayerID, -1);
+    }
+    // Cell type initialization checks the neighbors of the top row of cells, so the row above is also initialized
+    InitZ_High = std::min(InitZ_High + 1, nz - 1);
+    int InitSize = std::max(0, (InitZ_High - InitZ_Low + 1) * nx * MyYSlices);
+
+    // Reset this portion of the device views, then place the data from each layer into it
+    if (InitSize > 0) {
+        std::pair<int, int> InitRange((InitZ_Low - FrozenZ) * nx * MyYSlices,
+                                      (InitZ_High + 1 - FrozenZ) * nx * MyYSlices);
+        Kokkos::deep_copy(Kokkos::subview(CritTimeStep, InitRange), 0);
+        Kokkos::deep_copy(Kokkos::subview(UndercoolingChange, InitRange), 0.0);
+        Kokkos::deep_copy(Kokkos::subview(LayerID, InitRange), -1);
+    }
+
+    // Earlier layers have no data above the top of the previous layer
+    for (int LayerCounter = layernumber; LayerCounter < NumberOfLayers; LayerCounter++) {
+        int LayerZ_Low = round((ZMinLayer[LayerCounter] - ZMin) / deltax);
+        int LayerZ_High = round((ZMaxLayer[LayerCounter] - ZMin) / deltax);
+        if ((LayerZ_High >= InitZ_Low) && (LayerZ_Low <= InitZ_High))
+            placeLayerTempData_NoRemelt(LayerCounter, id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio, deltat, ZMin,
+                                        ZMinLayer, ZMaxLayer, LayerHeight, FinishTimeStep, FreezingRange, FirstValue,
+                                        LastValue, RawData, ny, InitZ_Low, InitZ_High, FrozenZ, CritTimeStep,
+                                        UndercoolingChange, LayerID);
+    }
+    if (id == 0)
+        std::cout << "Temperature data for layer " << layernumber << " initialized for Z = " << InitZ_Low
+                  << " through " << InitZ_High << std::endl;
+}
+
+// Calculate the maximum number of times that a cell in layer "layernumber" undergoes melting/solidification from the
+// number of events for each cell, and store in MaxSolidificationEvents_Host
+void calcMaxSolidificationEventsR(int id, int layernumber, int TempFilesInSeries, ViewI_H MaxSolidificationEvents_Host,
+                                  int LocalActiveDomainSize, ViewI NumberOfSolidificationEvents) {
+
+    if (layernumber > TempFilesInSeries) {
+        // Use the value from a previously checked layer, since the time-temperature history is reused
+        if (TempFilesInSeries == 1) {
+            // All layers have the same temperature data, MaxSolidificationEvents for this layer is the same as the last
             MaxSolidificationEvents_Host(layernumber) = MaxSolidificationEvents_Host(layernumber - 1);
         }
         else {
@@ -1347,25 +1650,16 @@ void calcMaxSolidificationEventsR(int id, int layernumber, int TempFilesInSeries
         }
     }
     else {
-        // Need to calculate MaxSolidificationEvents(layernumber) from the values in RawData
-        // Init to 0
-        ViewI_H TempMeltCount("TempMeltCount", LocalActiveDomainSize);
-
-        for (int i = StartRange; i < EndRange; i += 6) {
-
-            // Get the integer X, Y, Z coordinates associated with this data point
-            int XInt = getTempCoordX(i, XMin, deltax, RawData);
-            int YInt = getTempCoordY(i, YMin, deltax, RawData);
-            int ZInt = getTempCoordZ(i, deltax, RawData, LayerHeight, layernumber, ZMinLayer);
-            // Convert to 1D coordinate in the current layer's domain
-            int D3D1ConvPosition = ZInt * nx * MyYSlices + XInt * MyYSlices + (YInt - MyYOffset);
-            TempMeltCount(D3D1ConvPosition)++;
-        }
+        // Need to calculate MaxSolidificationEvents(layernumber) from the number of events for each cell
         int MaxCount = 0;
-        for (int i = 0; i < LocalActiveDomainSize; i++) {
-            if (TempMeltCount(i) > MaxCount)
-                MaxCount = TempMeltCount(i);
-        }
+        Kokkos::parallel_reduce(
+            "MaxSEvents", LocalActiveDomainSize,
+            KOKKOS_LAMBDA(const int &D3D1ConvPosition, int &LocalMaxCount) {
+                if (NumberOfSolidificationEvents(D3D1ConvPosition) > LocalMaxCount)
+                    LocalMaxCount = NumberOfSolidificationEvents(D3D1ConvPosition);
+            },
+            Kokkos::Max<int>(MaxCount));
+        MaxCount = std::max(MaxCount, 0);
         int MaxCountGlobal;
         MPI_Allreduce(&MaxCount, &MaxCountGlobal, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
         MaxSolidificationEvents_Host(layernumber) = MaxCountGlobal;
@@ -1377,88 +1671,312 @@ void calcMaxSolidificationEventsR(int id, int layernumber, int TempFilesInSeries
 
 // Initialize temperature fields for this layer if remelting is considered and data comes from files
 void TempInit_ReadDataRemelt(int layernumber, int id, int nx, int MyYSlices, int, int LocalActiveDomainSize,
-                             int LocalDomainSize, int MyYOffset, double &deltax, double deltat, double FreezingRange,
-                             ViewF3D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
-                             ViewI &MaxSolidificationEvents, ViewI &MeltTimeStep, ViewI &CritTimeStep,
-                             ViewF &UndercoolingChange, ViewF &UndercoolingCurrent, double XMin, double YMin,
+                             int LocalDomainSize, int MyYOffset, double &, double deltat, double FreezingRange,
+                             ViewF2D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
+                             ViewI &SolidificationEventOffset, ViewI &MaxSolidificationEvents, ViewI &MeltTimeStep,
+                             ViewI &CritTimeStep, ViewF &UndercoolingChange, ViewF &UndercoolingCurrent,
                              double *ZMinLayer, int LayerHeight, int nzActive, int ZBound_Low, int *FinishTimeStep,
-                             ViewI &LayerID, int *FirstValue, int *LastValue, std::vector<double> RawData,
+                             ViewI &LayerID, int *FirstValue, int *LastValue, const RawTemperatureData &RawData,
                              ViewI &SolidificationEventCounter, int TempFilesInSeries) {
 
     // Data was already read into the "RawData" temporary data structure
     // Determine which section of "RawData" is relevant for this layer of the overall domain
     int StartRange = FirstValue[layernumber];
     int EndRange = LastValue[layernumber];
+    int NumDataPoints = EndRange - StartRange;
+    if (id == 0)
+        std::cout << "Range of raw data for layer " << layernumber << " on rank 0 is " << StartRange << " to "
+                  << EndRange << std::endl;
+    MPI_Barrier(MPI_COMM_WORLD);
 
-    // Resize device views to have sizes compatible with the temporary host views
-    // Copy MaxSolidificationEvents back to the host as part of resizing LayerTimeTempHistory
+    // 1D cell coordinate on this MPI rank's domain for each of this layer's data points, along with their TM, TL, CR
+    // values, copied to the device
+    ViewI_H EventLocation_Host(Kokkos::ViewAllocateWithoutInitializing("EventLocation_H"), NumDataPoints);
+    ViewD_H TMelting_Host(Kokkos::ViewAllocateWithoutInitializing("TMelting_H"), NumDataPoints);
+    ViewD_H TLiquidus_Host(Kokkos::ViewAllocateWithoutInitializing("TLiquidus_H"), NumDataPoints);
+    ViewD_H CoolingRate_Host(Kokkos::ViewAllocateWithoutInitializing("CoolingRate_H"), NumDataPoints);
+    for (int n = 0; n < NumDataPoints; n++) {
+        int i = StartRange + n;
+        int XInt = getTempCoordX(i, RawData);
+        int YInt = getTempCoordY(i, RawData);
+        int ZInt = getTempCoordZ(i, RawData, LayerHeight, layernumber, ZMinLayer);
+        EventLocation_Host(n) = ZInt * nx * MyYSlices + XInt * MyYSlices + (YInt - MyYOffset);
+        TMelting_Host(n) = getTempCoordTM(i, RawData);
+        TLiquidus_Host(n) = getTempCoordTL(i, RawData);
+        CoolingRate_Host(n) = getTempCoordCR(i, RawData);
+    }
+    ViewI EventLocation = Kokkos::create_mirror_view_and_copy(device_memory_space(), EventLocation_Host);
+    ViewD TMelting = Kokkos::create_mirror_view_and_copy(device_memory_space(), TMelting_Host);
+    ViewD TLiquidus = Kokkos::create_mirror_view_and_copy(device_memory_space(), TLiquidus_Host);
+    ViewD CoolingRate = Kokkos::create_mirror_view_and_copy(device_memory_space(), CoolingRate_Host);
+
+    // Count the number of times each cell in layer "layernumber" will undergo melting/solidification, storing each
+    // data point's position among its cell's events
+    Kokkos::realloc(NumberOfSolidificationEvents, LocalActiveDomainSize);
+    Kokkos::deep_copy(NumberOfSolidificationEvents, 0);
+    ViewI EventPosition(Kokkos::ViewAllocateWithoutInitializing("EventPosition"), NumDataPoints);
+    Kokkos::parallel_for(
+        "CountSEvents", NumDataPoints, KOKKOS_LAMBDA(const int &n) {
+            EventPosition(n) = Kokkos::atomic_fetch_add(&NumberOfSolidificationEvents(EventLocation(n)), 1);
+        });
+
+    // Copy MaxSolidificationEvents back to the host to store the maximum number of times a cell in layer "layernumber"
+    // will undergo melting/solidification
     ViewI_H MaxSolidificationEvents_Host =
         Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
+    calcMaxSolidificationEventsR(id, layernumber, TempFilesInSeries, MaxSolidificationEvents_Host,
+                                 LocalActiveDomainSize, NumberOfSolidificationEvents);
+    MaxSolidificationEvents = Kokkos::create_mirror_view_and_copy(device_memory_space(), MaxSolidificationEvents_Host);
+
+    // Each cell's solidification events are stored consecutively in LayerTimeTempHistory, starting at the position
+    // given by SolidificationEventOffset. Group the data points by cell, using each data point's position among its
+    // cell's events
+    Kokkos::realloc(SolidificationEventOffset, LocalActiveDomainSize + 1);
+    int NumberOfEvents = calcSolidificationEventOffsets(LocalActiveDomainSize, NumberOfSolidificationEvents,
+                                                        SolidificationEventOffset);
+    ViewI EventDataPoint(Kokkos::ViewAllocateWithoutInitializing("EventDataPoint"), NumberOfEvents);
+    Kokkos::parallel_for(
+        "GroupSEvents", NumDataPoints, KOKKOS_LAMBDA(const int &n) {
+            EventDataPoint(SolidificationEventOffset(EventLocation(n)) + EventPosition(n)) = n;
+        });
+
+    // Estimate of the time step where the last possible solidification is expected to occur
+    double LargestTime = 0;
+    double LargestTime_Global = 0;
+    Kokkos::parallel_reduce(
+        "LargestSolidusTime", NumDataPoints,
+        KOKKOS_LAMBDA(const int &n, double &LocalLargestTime) {
+            double SolidusTime = TLiquidus(n) + FreezingRange / CoolingRate(n);
+            if (SolidusTime > LocalLargestTime)
+                LocalLargestTime = SolidusTime;
+        },
+        Kokkos::Max<double>(LargestTime));
+    LargestTime = std::max(LargestTime, 0.0);
+    MPI_Allreduce(&LargestTime, &LargestTime_Global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    if (id == 0)
+        std::cout << "Largest time globally for layer " << layernumber << " is " << LargestTime_Global << std::endl;
+    FinishTimeStep[layernumber] = round((LargestTime_Global) / deltat);
+    if (id == 0)
+        std::cout << " Layer " << layernumber << " FINISH TIME STEP IS " << FinishTimeStep[layernumber] << std::endl;
+    if (id == 0)
+        std::cout << "Layer " << layernumber << " temperatures read" << std::endl;
 
-    // Get the maximum number of times a cell in layer "layernumber" will undergo melting/solidification
-    // Store in the host view "MaxSolidificationEvents_Host"
-    calcMaxSolidificationEventsR(id, layernumber, TempFilesInSeries, MaxSolidificationEvents_Host, StartRange, EndRange,
-                                 RawData, XMin, YMin, deltax, ZMinLayer, LayerHeight, nx, MyYSlices, MyYOffset,
-                                 LocalActiveDomainSize);
-    // With MaxSolidificationEvents_Host(layernumber) known, can resize LayerTimeTempHistory
-    Kokkos::resize(LayerTimeTempHistory, LocalActiveDomainSize, MaxSolidificationEvents_Host(layernumber), 3);
-    Kokkos::resize(NumberOfSolidificationEvents, LocalActiveDomainSize);
-    Kokkos::resize(SolidificationEventCounter, LocalActiveDomainSize);
+    // Resize device views to have sizes compatible with this layer's data
+    Kokkos::realloc(LayerTimeTempHistory, NumberOfEvents, 3);
+    Kokkos::realloc(SolidificationEventCounter, LocalActiveDomainSize);
     if (layernumber == 0) {
         // Only needs to be resized during initialization of the first layer, as LocalDomainSize is constant while
         // LocalActiveDomainSize is not
         Kokkos::resize(MeltTimeStep, LocalDomainSize);
+        // First layer - all LayerID values are -1, to later be populated with other values
+        Kokkos::deep_copy(LayerID, -1);
     }
 
-    // These views are copied to the host, updated for layer "layernumber", and later copied back to the device
-    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
-    ViewI_H MeltTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep);
-    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
-    ViewF_H UndercoolingChange_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange);
+    // Store each cell's solidification events in LayerTimeTempHistory, remove double counted events, and initialize
+    // the cell's temperature fields using its first melt-solidification event
+    int GlobalOffset = ZBound_Low * nx * MyYSlices;
+    int AnomalousEvents = 0;
+    Kokkos::parallel_reduce(
+        "PlaceSEvents", LocalActiveDomainSize,
+        KOKKOS_LAMBDA(const int &D3D1ConvPosition, int &LocalAnomalousEvents) {
+            int FirstEvent = SolidificationEventOffset(D3D1ConvPosition);
+            int NumEvents = NumberOfSolidificationEvents(D3D1ConvPosition);
+            int LastEvent = FirstEvent + NumEvents;
+            // Sort this cell's data points back into the order they were read
+            for (int e = FirstEvent + 1; e < LastEvent; e++) {
+                int n = EventDataPoint(e);
+                int f = e - 1;
+                while ((f >= FirstEvent) && (EventDataPoint(f) > n)) {
+                    EventDataPoint(f + 1) = EventDataPoint(f);
+                    f--;
+                }
+                EventDataPoint(f + 1) = n;
+            }
+            // Store TM, TL, CR values for each solidification event in LayerTimeTempHistory
+            for (int e = FirstEvent; e < LastEvent; e++) {
+                int n = EventDataPoint(e);
+                LayerTimeTempHistory(e, 0) = round(TMelting(n) / deltat) + 1;
+                LayerTimeTempHistory(e, 1) = round(TLiquidus(n) / deltat) + 1;
+                LayerTimeTempHistory(e, 2) = fabs(CoolingRate(n)) * deltat;
+            }
+            // Reorder solidification events so that they are in order based on the melting time values (component 0)
+            for (int e = FirstEvent; e < LastEvent - 1; e++) {
+                for (int f = e + 1; f < LastEvent; f++) {
+                    if (LayerTimeTempHistory(e, 0) > LayerTimeTempHistory(f, 0)) {
+                        // Swap these two points - melting event "f" happens before event "e"
+                        for (int l = 0; l < 3; l++) {
+                            float OldVal = LayerTimeTempHistory(e, l);
+                            LayerTimeTempHistory(e, l) = LayerTimeTempHistory(f, l);
+                            LayerTimeTempHistory(f, l) = OldVal;
+                        }
+                    }
+                }
+            }
+            // If a cell melts twice before reaching the liquidus temperature, this is a double counted solidification
+            // event and should be removed. The unused space at the end of this cell's events is removed when the data
+            // is trimmed to the active region
+            for (int e = FirstEvent; e < FirstEvent + NumEvents - 1; e++) {
+                if (LayerTimeTempHistory(e + 1, 0) < LayerTimeTempHistory(e, 1)) {
+                    LocalAnomalousEvents++;
+                    // Keep whichever event has the larger liquidus time
+                    if (LayerTimeTempHistory(e + 1, 1) > LayerTimeTempHistory(e, 1)) {
+                        for (int l = 0; l < 3; l++)
+                            LayerTimeTempHistory(e, l) = LayerTimeTempHistory(e + 1, l);
+                    }
+                    // Reshuffle other solidification events over if needed
+                    for (int f = e + 1; f < FirstEvent + NumEvents - 1; f++) {
+                        for (int l = 0; l < 3; l++)
+                            LayerTimeTempHistory(f, l) = LayerTimeTempHistory(f + 1, l);
+                    }
+                    NumEvents--;
+                }
+            }
+            NumberOfSolidificationEvents(D3D1ConvPosition) = NumEvents;
+            // First melt-solidification event from LayerTimeTempHistory to happen is initialized
+            int GlobalD3D1ConvPosition = D3D1ConvPosition + GlobalOffset;
+            if ((NumEvents > 0) && (LayerTimeTempHistory(FirstEvent, 0) > 0)) {
+                // This cell undergoes solidification in layer "layernumber" at least once
+                LayerID(GlobalD3D1ConvPosition) = layernumber;
+                MeltTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(FirstEvent, 0));
+                CritTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(FirstEvent, 1));
+                UndercoolingChange(GlobalD3D1ConvPosition) = LayerTimeTempHistory(FirstEvent, 2);
+            }
+            else {
+                // This cell does not undergo solidification in layer "layernumber"
+                MeltTimeStep(GlobalD3D1ConvPosition) = 0;
+                CritTimeStep(GlobalD3D1ConvPosition) = 0;
+                UndercoolingChange(GlobalD3D1ConvPosition) = 0.0;
+            }
+        },
+        AnomalousEvents);
+    if (AnomalousEvents > 0)
+        std::cout << "Rank " << id << " removed " << AnomalousEvents
+                  << " anomalous solidification events (cells melting twice before reaching the liquidus) from layer "
+                  << layernumber << std::endl;
 
-    // These views are initialized to zeros on the host, filled with data, and then copied to the device for layer
-    // "layernumber"
-    ViewF3D_H LayerTimeTempHistory_Host("TimeTempHistory_H", LocalActiveDomainSize,
-                                        MaxSolidificationEvents_Host(layernumber), 3);
-    ViewI_H NumberOfSolidificationEvents_Host("NumSEvents_H", LocalActiveDomainSize);
+    // Initial undercooling of all cells is 0, solidification event counter is 0 at the start of each layer
+    Kokkos::deep_copy(UndercoolingCurrent, 0.0);
+    Kokkos::deep_copy(SolidificationEventCounter, 0);
 
-    // First layer - all LayerID values are -1, to later be populated with other values
-    if (layernumber == 0)
-        Kokkos::deep_copy(LayerID_Host, -1);
+    if (id == 0)
+        std::cout << "Layer " << layernumber << " temperature field is from Z = " << ZBound_Low << " through "
+                  << nzActive + ZBound_Low - 1 << " of the global domain" << std::endl;
+}
 
-    double LargestTime = 0;
-    double LargestTime_Global = 0;
+// Initialize temperature fields for this layer if remelting is considered, data comes from files, and the layer's
+// solidification events are streamed to the device during the layer (EventStream.WindowSize > 0). Each cell's events
+// are stored on the host in EventStream, with only the first used to initialize the temperature fields. Data points
+// are considered in order of melting time, so a temperature file sorted by melting time is used in the order it was
+// read. Otherwise, the layer's data points are sorted first
+void TempInit_ReadDataRemelt_Streamed(int layernumber, int id, int nx, int MyYSlices, int LocalActiveDomainSize,
+                                      int LocalDomainSize, int MyYOffset, double deltat, double FreezingRange,
+                                      ViewI &NumberOfSolidificationEvents, ViewI &MaxSolidificationEvents,
+                                      ViewI &MeltTimeStep, ViewI &CritTimeStep, ViewF &UndercoolingChange,
+                                      ViewF &UndercoolingCurrent, double *ZMinLayer, int LayerHeight, int nzActive,
+                                      int ZBound_Low, int *FinishTimeStep, ViewI &LayerID, int *FirstValue,
+                                      int *LastValue, const RawTemperatureData &RawData,
+                                      ViewI &SolidificationEventCounter, int TempFilesInSeries,
+                                      TemperatureEventStream &EventStream) {
+
+    // Data was already read into the "RawData" temporary data structure
+    // Determine which section of "RawData" is relevant for this layer of the overall domain
+    int StartRange = FirstValue[layernumber];
+    int EndRange = LastValue[layernumber];
+    int NumDataPoints = EndRange - StartRange;
     if (id == 0)
         std::cout << "Range of raw data for layer " << layernumber << " on rank 0 is " << StartRange << " to "
-                  << EndRange << std::endl;
+                  << EndRange << " (streaming solidification events " << EventStream.WindowSize
+                  << " time steps ahead)" << std::endl;
     MPI_Barrier(MPI_COMM_WORLD);
-    for (int i = StartRange; i < EndRange; i += 6) {
-
-        // Get the integer X, Y, Z coordinates associated with this data point, along with the associated TM, TL, CR
-        // values
-        int XInt = getTempCoordX(i, XMin, deltax, RawData);
-        int YInt = getTempCoordY(i, YMin, deltax, RawData);
-        int ZInt = getTempCoordZ(i, deltax, RawData, LayerHeight, layernumber, ZMinLayer);
-        double TMelting = getTempCoordTM(i, RawData);
-        double TLiquidus = getTempCoordTL(i, RawData);
-        double CoolingRate = getTempCoordCR(i, RawData);
-
-        // 1D cell coordinate on this MPI rank's domain
-        int D3D1ConvPosition = ZInt * nx * MyYSlices + XInt * MyYSlices + (YInt - MyYOffset);
-        // Store TM, TL, CR values for this solidification event in LayerTimeTempHistory
-        LayerTimeTempHistory_Host(D3D1ConvPosition, NumberOfSolidificationEvents_Host(D3D1ConvPosition), 0) =
-            round(TMelting / deltat) + 1;
-        LayerTimeTempHistory_Host(D3D1ConvPosition, NumberOfSolidificationEvents_Host(D3D1ConvPosition), 1) =
-            round(TLiquidus / deltat) + 1;
-        LayerTimeTempHistory_Host(D3D1ConvPosition, NumberOfSolidificationEvents_Host(D3D1ConvPosition), 2) =
-            std::abs(CoolingRate) * deltat;
-        // Increment number of solidification events for this cell
-        NumberOfSolidificationEvents_Host(D3D1ConvPosition)++;
-        // Estimate of the time step where the last possible solidification is expected to occur
-        double SolidusTime = TLiquidus + FreezingRange / CoolingRate;
+
+    // 1D cell coordinate on this MPI rank's domain for each of this layer's data points, along with their melting and
+    // liquidus time steps
+    std::vector<int> EventLocation(NumDataPoints);
+    std::vector<float> MeltTime(NumDataPoints), LiquidusTime(NumDataPoints);
+    for (int n = 0; n < NumDataPoints; n++) {
+        int i = StartRange + n;
+        int XInt = getTempCoordX(i, RawData);
+        int YInt = getTempCoordY(i, RawData);
+        int ZInt = getTempCoordZ(i, RawData, LayerHeight, layernumber, ZMinLayer);
+        EventLocation[n] = ZInt * nx * MyYSlices + XInt * MyYSlices + (YInt - MyYOffset);
+        MeltTime[n] = round(getTempCoordTM(i, RawData) / deltat) + 1;
+        LiquidusTime[n] = round(getTempCoordTL(i, RawData) / deltat) + 1;
+    }
+    std::vector<int> MeltOrder(NumDataPoints);
+    for (int n = 0; n < NumDataPoints; n++)
+        MeltOrder[n] = n;
+    if (!(std::is_sorted(MeltTime.begin(), MeltTime.end())))
+        std::stable_sort(MeltOrder.begin(), MeltOrder.end(),
+                         [&](const int &a, const int &b) { return (MeltTime[a] < MeltTime[b]); });
+
+    // Count the number of times each cell in layer "layernumber" will undergo melting/solidification, and determine
+    // which of each cell's events is updated by each data point. If a cell melts twice before reaching the liquidus,
+    // this is a double counted solidification event: the data point replaces the cell's last event if it has a larger
+    // liquidus time, and is otherwise discarded. The event following a removed event is always kept
+    ViewI_H NumberOfDataPoints_Host("NumDataPoints_H", LocalActiveDomainSize);
+    EventStream.NumberOfSolidificationEvents_Host = ViewI_H("NumSEvents_H", LocalActiveDomainSize);
+    std::vector<float> LastLiquidusTime(LocalActiveDomainSize);
+    std::vector<bool> CheckNextEvent(LocalActiveDomainSize, false);
+    std::vector<int> DataPointEvent(NumDataPoints, -1);
+    int AnomalousEvents = 0;
+    for (int n : MeltOrder) {
+        int D3D1ConvPosition = EventLocation[n];
+        NumberOfDataPoints_Host(D3D1ConvPosition)++;
+        int &NumEvents = EventStream.NumberOfSolidificationEvents_Host(D3D1ConvPosition);
+        if ((CheckNextEvent[D3D1ConvPosition]) && (MeltTime[n] < LastLiquidusTime[D3D1ConvPosition])) {
+            AnomalousEvents++;
+            if (LiquidusTime[n] > LastLiquidusTime[D3D1ConvPosition]) {
+                DataPointEvent[n] = NumEvents - 1;
+                LastLiquidusTime[D3D1ConvPosition] = LiquidusTime[n];
+            }
+            CheckNextEvent[D3D1ConvPosition] = false;
+        }
+        else {
+            DataPointEvent[n] = NumEvents;
+            NumEvents++;
+            LastLiquidusTime[D3D1ConvPosition] = LiquidusTime[n];
+            CheckNextEvent[D3D1ConvPosition] = true;
+        }
+    }
+    if (AnomalousEvents > 0)
+        std::cout << "Rank " << id << " removed " << AnomalousEvents
+                  << " anomalous solidification events (cells melting twice before reaching the liquidus) from layer "
+                  << layernumber << std::endl;
+
+    // The maximum number of times that a cell in layer "layernumber" will undergo melting/solidification is based on
+    // the number of data points for each cell, as without streaming
+    ViewI_H MaxSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
+    ViewI NumberOfDataPoints = Kokkos::create_mirror_view_and_copy(device_memory_space(), NumberOfDataPoints_Host);
+    calcMaxSolidificationEventsR(id, layernumber, TempFilesInSeries, MaxSolidificationEvents_Host,
+                                 LocalActiveDomainSize, NumberOfDataPoints);
+    MaxSolidificationEvents = Kokkos::create_mirror_view_and_copy(device_memory_space(), MaxSolidificationEvents_Host);
+
+    // Store each cell's solidification events consecutively in EventStream.LayerTimeTempHistory_Host, in order of
+    // melting time
+    EventStream.SolidificationEventOffset_Host =
+        ViewI_H(Kokkos::ViewAllocateWithoutInitializing("SEventOffset_H"), LocalActiveDomainSize + 1);
+    int NumberOfEvents =
+        calcSolidificationEventOffsets(LocalActiveDomainSize, EventStream.NumberOfSolidificationEvents_Host,
+                                       EventStream.SolidificationEventOffset_Host);
+    EventStream.LayerTimeTempHistory_Host =
+        ViewF2D_H(Kokkos::ViewAllocateWithoutInitializing("TimeTempHistory_H"), NumberOfEvents, 3);
+    double LargestTime = 0;
+    for (int n : MeltOrder) {
+        int i = StartRange + n;
+        double SolidusTime = getTempCoordTL(i, RawData) + FreezingRange / getTempCoordCR(i, RawData);
         if (SolidusTime > LargestTime)
             LargestTime = SolidusTime;
+        if (DataPointEvent[n] == -1)
+            continue;
+        int Event = EventStream.SolidificationEventOffset_Host(EventLocation[n]) + DataPointEvent[n];
+        EventStream.LayerTimeTempHistory_Host(Event, 0) = MeltTime[n];
+        EventStream.LayerTimeTempHistory_Host(Event, 1) = LiquidusTime[n];
+        EventStream.LayerTimeTempHistory_Host(Event, 2) = fabs(getTempCoordCR(i, RawData)) * deltat;
     }
+
+    // Estimate of the time step where the last possible solidification is expected to occur
+    double LargestTime_Global = 0;
     MPI_Allreduce(&LargestTime, &LargestTime_Global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
     if (id == 0)
         std::cout << "Largest time globally for layer " << layernumber << " is " << LargestTime_Global << std::endl;
@@ -1468,95 +1986,48 @@ void TempInit_ReadDataRemelt(int layernumber, int id, int nx, int MyYSlices, int
     if (id == 0)
         std::cout << "Layer " << layernumber << " temperatures read" << std::endl;
 
-    // Reorder solidification events in LayerTimeTempHistory(location,event number,component) so that they are in order
-    // based on the melting time values (component = 0)
-    for (int n = 0; n < LocalActiveDomainSize; n++) {
-        if (NumberOfSolidificationEvents_Host(n) > 0) {
-            for (int i = 0; i < NumberOfSolidificationEvents_Host(n) - 1; i++) {
-                for (int j = (i + 1); j < NumberOfSolidificationEvents_Host(n); j++) {
-                    if (LayerTimeTempHistory_Host(n, i, 0) > LayerTimeTempHistory_Host(n, j, 0)) {
-                        // Swap these two points - melting event "j" happens before event "i"
-                        float OldMeltVal = LayerTimeTempHistory_Host(n, i, 0);
-                        float OldLiqVal = LayerTimeTempHistory_Host(n, i, 1);
-                        float OldCRVal = LayerTimeTempHistory_Host(n, i, 2);
-                        LayerTimeTempHistory_Host(n, i, 0) = LayerTimeTempHistory_Host(n, j, 0);
-                        LayerTimeTempHistory_Host(n, i, 1) = LayerTimeTempHistory_Host(n, j, 1);
-                        LayerTimeTempHistory_Host(n, i, 2) = LayerTimeTempHistory_Host(n, j, 2);
-                        LayerTimeTempHistory_Host(n, j, 0) = OldMeltVal;
-                        LayerTimeTempHistory_Host(n, j, 1) = OldLiqVal;
-                        LayerTimeTempHistory_Host(n, j, 2) = OldCRVal;
-                    }
-                }
-            }
+    // Each cell's first melt-solidification event, copied to the device to initialize the cell's temperature fields
+    ViewF2D_H FirstEventData_Host("FirstEventData_H", LocalActiveDomainSize, 3);
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LocalActiveDomainSize; D3D1ConvPosition++) {
+        if (EventStream.NumberOfSolidificationEvents_Host(D3D1ConvPosition) > 0) {
+            int FirstEvent = EventStream.SolidificationEventOffset_Host(D3D1ConvPosition);
+            for (int l = 0; l < 3; l++)
+                FirstEventData_Host(D3D1ConvPosition, l) = EventStream.LayerTimeTempHistory_Host(FirstEvent, l);
         }
     }
-    // If a cell melts twice before reaching the liquidus temperature, this is a double counted solidification
-    // event and should be removed
-    for (int n = 0; n < LocalActiveDomainSize; n++) {
-        if (NumberOfSolidificationEvents_Host(n) > 1) {
-            for (int i = 0; i < NumberOfSolidificationEvents_Host(n) - 1; i++) {
-                if (LayerTimeTempHistory_Host(n, i + 1, 0) < LayerTimeTempHistory_Host(n, i, 1)) {
-                    std::cout << "Cell " << n << " removing anomalous event " << i + 1 << " out of "
-                              << NumberOfSolidificationEvents_Host(n) - 1 << std::endl;
-                    // Keep whichever event has the larger liquidus time
-                    if (LayerTimeTempHistory_Host(n, i + 1, 1) > LayerTimeTempHistory_Host(n, i, 1)) {
-                        LayerTimeTempHistory_Host(n, i, 0) = LayerTimeTempHistory_Host(n, i + 1, 0);
-                        LayerTimeTempHistory_Host(n, i, 1) = LayerTimeTempHistory_Host(n, i + 1, 1);
-                        LayerTimeTempHistory_Host(n, i, 2) = LayerTimeTempHistory_Host(n, i + 1, 2);
-                    }
-                    LayerTimeTempHistory_Host(n, i + 1, 0) = 0.0;
-                    LayerTimeTempHistory_Host(n, i + 1, 1) = 0.0;
-                    LayerTimeTempHistory_Host(n, i + 1, 2) = 0.0;
-                    // Reshuffle other solidification events over if needed
-                    for (int ii = (i + 1); ii < NumberOfSolidificationEvents_Host(n) - 1; ii++) {
-                        LayerTimeTempHistory_Host(n, ii, 0) = LayerTimeTempHistory_Host(n, ii + 1, 0);
-                        LayerTimeTempHistory_Host(n, ii, 1) = LayerTimeTempHistory_Host(n, ii + 1, 1);
-                        LayerTimeTempHistory_Host(n, ii, 2) = LayerTimeTempHistory_Host(n, ii + 1, 2);
-                    }
-                    NumberOfSolidificationEvents_Host(n)--;
-                }
-            }
-        }
+    ViewF2D FirstEventData = Kokkos::create_mirror_view_and_copy(device_memory_space(), FirstEventData_Host);
+    NumberOfSolidificationEvents =
+        Kokkos::create_mirror_view_and_copy(device_memory_space(), EventStream.NumberOfSolidificationEvents_Host);
+    Kokkos::realloc(SolidificationEventCounter, LocalActiveDomainSize);
+    if (layernumber == 0) {
+        // Only needs to be resized during initialization of the first layer, as LocalDomainSize is constant while
+        // LocalActiveDomainSize is not
+        Kokkos::resize(MeltTimeStep, LocalDomainSize);
+        // First layer - all LayerID values are -1, to later be populated with other values
+        Kokkos::deep_copy(LayerID, -1);
     }
-    // First melt-solidification event from LayerTimeTempHistory to happen is initialized
-    for (int k = 0; k < nzActive; k++) {
-        int GlobalZ = k + ZBound_Low;
-        for (int i = 0; i < nx; i++) {
-            for (int j = 0; j < MyYSlices; j++) {
-                int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
-                int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + i * MyYSlices + j;
-                if (LayerTimeTempHistory_Host(D3D1ConvPosition, 0, 0) > 0) {
-                    // This cell undergoes solidification in layer "layernumber" at least once
-                    LayerID_Host(GlobalD3D1ConvPosition) = layernumber;
-                    MeltTimeStep_Host(GlobalD3D1ConvPosition) =
-                        (int)(LayerTimeTempHistory_Host(D3D1ConvPosition, 0, 0));
-                    CritTimeStep_Host(GlobalD3D1ConvPosition) =
-                        (int)(LayerTimeTempHistory_Host(D3D1ConvPosition, 0, 1));
-                    UndercoolingChange_Host(GlobalD3D1ConvPosition) = LayerTimeTempHistory_Host(D3D1ConvPosition, 0, 2);
-                }
-                else {
-                    // This cell does not undergo solidification in layer "layernumber"
-                    MeltTimeStep_Host(GlobalD3D1ConvPosition) = 0;
-                    CritTimeStep_Host(GlobalD3D1ConvPosition) = 0;
-                    UndercoolingChange_Host(GlobalD3D1ConvPosition) = 0.0;
-                }
+    int GlobalOffset = ZBound_Low * nx * MyYSlices;
+    Kokkos::parallel_for(
+        "PlaceFirstSEvents", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+            int GlobalD3D1ConvPosition = D3D1ConvPosition + GlobalOffset;
+            if ((NumberOfSolidificationEvents(D3D1ConvPosition) > 0) && (FirstEventData(D3D1ConvPosition, 0) > 0)) {
+                // This cell undergoes solidification in layer "layernumber" at least once
+                LayerID(GlobalD3D1ConvPosition) = layernumber;
+                MeltTimeStep(GlobalD3D1ConvPosition) = (int)(FirstEventData(D3D1ConvPosition, 0));
+                CritTimeStep(GlobalD3D1ConvPosition) = (int)(FirstEventData(D3D1ConvPosition, 1));
+                UndercoolingChange(GlobalD3D1ConvPosition) = FirstEventData(D3D1ConvPosition, 2);
             }
-        }
-    }
+            else {
+                // This cell does not undergo solidification in layer "layernumber"
+                MeltTimeStep(GlobalD3D1ConvPosition) = 0;
+                CritTimeStep(GlobalD3D1ConvPosition) = 0;
+                UndercoolingChange(GlobalD3D1ConvPosition) = 0.0;
+            }
+        });
 
     // Initial undercooling of all cells is 0, solidification event counter is 0 at the start of each layer
     Kokkos::deep_copy(UndercoolingCurrent, 0.0);
-    Kokkos::deep_copy(SolidificationEventCounter, 0.0);
-
-    // Copy host view data back to device
-    MaxSolidificationEvents = Kokkos::create_mirror_view_and_copy(device_memory_space(), MaxSolidificationEvents_Host);
-    LayerID = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerID_Host);
-    MeltTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), MeltTimeStep_Host);
-    CritTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), CritTimeStep_Host);
-    UndercoolingChange = Kokkos::create_mirror_view_and_copy(device_memory_space(), UndercoolingChange_Host);
-    LayerTimeTempHistory = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerTimeTempHistory_Host);
-    NumberOfSolidificationEvents =
-        Kokkos::create_mirror_view_and_copy(device_memory_space(), NumberOfSolidificationEvents_Host);
+    Kokkos::deep_copy(SolidificationEventCounter, 0);
 
     if (id == 0)
         std::cout << "Layer " << layernumber << " temperature field is from Z = " << ZBound_Low << " through "
@@ -1608,35 +2079,13 @@ void SubstrateInit_ConstrainedGrowth(int id, double FractSurfaceSitesActive, int
                                      int np, Buffer2D BufferNorthSend, Buffer2D BufferSouthSend, int BufSizeX,
                                      bool AtNorthBoundary, bool AtSouthBoundary) {
 
-    // Calls to Xdist(gen) and Y dist(gen) return random locations for grain seeds
-    // Since X = 0 and X = nx-1 are the cell centers of the last cells in X, locations are evenly scattered between X =
-    // -0.49999 and X = nx - 0.5, as the cells have a half width of 0.5
-    std::mt19937_64 gen(RNGSeed);
-    std::uniform_real_distribution<double> Xdist(-0.49999, nx - 0.5);
-    std::uniform_real_distribution<double> Ydist(-0.49999, ny - 0.5);
-
     // Determine number of active cells from the fraction of sites active and the number of sites on the bottom domain
     // surface
     int SubstrateActCells = std::round(FractSurfaceSitesActive * nx * ny);
 
-    // On all ranks, generate active site locations - same list on every rank
-    // TODO: Generate random numbers on GPU, instead of using host view and copying over - ensure that locations are in
-    // the same order every time based on the RNGSeed
-    ViewI_H ActCellX_Host(Kokkos::ViewAllocateWithoutInitializing("ActCellX_Host"), SubstrateActCells);
-    ViewI_H ActCellY_Host(Kokkos::ViewAllocateWithoutInitializing("ActCellY_Host"), SubstrateActCells);
-
-    // Randomly locate substrate grain seeds for cells in the interior of this subdomain (at the k = 0 bottom surface)
-    for (int n = 0; n < SubstrateActCells; n++) {
-        double XLocation = Xdist(gen);
-        double YLocation = Ydist(gen);
-        // Randomly select integer coordinates between 0 and nx-1 or ny-1
-        ActCellX_Host(n) = round(XLocation);
-        ActCellY_Host(n) = round(YLocation);
-    }
-
-    // Copy views of substrate grain locations back to the device
-    ViewI ActCellX_Device = Kokkos::create_mirror_view_and_copy(device_memory_space(), ActCellX_Host);
-    ViewI ActCellY_Device = Kokkos::create_mirror_view_and_copy(device_memory_space(), ActCellY_Host);
+    // Each active cell's location is drawn from the substrate random number stream using its index - the same locations
+    // on every rank, regardless of the number of ranks
+    CounterRNG RNG(RNGSeed, SubstrateStream, 0);
 
     // Start with all cells as liquid prior to locating substrate grain seeds
     Kokkos::deep_copy(CellType, Liquid);
@@ -1644,13 +2093,15 @@ void SubstrateInit_ConstrainedGrowth(int id, double FractSurfaceSitesActive, int
     // Determine which grains/active cells belong to which MPI ranks
     Kokkos::parallel_for(
         "ConstrainedGrainInit", SubstrateActCells, KOKKOS_LAMBDA(const int &n) {
-            // What are the X and Y coordinates of this active cell relative to the X and Y bounds of this rank?
-            if ((ActCellY_Device(n) >= MyYOffset) && (ActCellY_Device(n) < MyYOffset + MyYSlices)) {
+            // Randomly select integer coordinates between 0 and nx-1 or ny-1 - the X coordinate is only needed if this
+            // active cell is within the Y bounds of this rank
+            int ActCellY = RNG.uniformInt(n, 1, ny);
+            if ((ActCellY >= MyYOffset) && (ActCellY < MyYOffset + MyYSlices)) {
                 // Convert X and Y coordinates to values relative to this MPI rank's grid (Z = 0 for these active cells,
                 // at bottom surface) GrainIDs come from the position on the list of substrate active cells to avoid
                 // reusing the same value
-                int GlobalX = ActCellX_Device(n);
-                int LocalY = ActCellY_Device(n) - MyYOffset;
+                int GlobalX = RNG.uniformInt(n, 0, nx);
+                int LocalY = ActCellY - MyYOffset;
                 int D3D1ConvPosition = GlobalX * MyYSlices + LocalY;
                 CellType(D3D1ConvPosition) = Active;
                 GrainID(D3D1ConvPosition) = n + 1; // assign GrainID > 0 to epitaxial seeds
@@ -1687,23 +2138,28 @@ void SubstrateInit_ConstrainedGrowth(int id, double FractSurfaceSitesActive, int
         std::cout << "Number of substrate active cells across all ranks: " << SubstrateActCells << std::endl;
 }
 
-// Initializes Grain ID values where the substrate comes from a file
-void SubstrateInit_FromFile(std::string SubstrateFileName, int nz, int nx, int MyYSlices, int MyYOffset, int id,
-                            ViewI &GrainID_Device, int nzActive, bool BaseplateThroughPowder) {
+// Check if the substrate data is in ASCII or binary format
+bool checkSubstrateFileFormat(std::string SubstrateFileName) {
+    bool BinaryInputData;
+    std::size_t found = SubstrateFileName.find(".casub");
+    if (found == std::string::npos)
+        BinaryInputData = false;
+    else
+        BinaryInputData = true;
+    return BinaryInputData;
+}
+
+// Read GrainID values for Z = 0 through BaseplateSizeZ - 1 and the Y coordinates on this rank from an ASCII substrate
+// file (a header with the Z, Y, and X dimensions, followed by one GrainID value per line, with X varying fastest and Z
+// slowest), storing them in SubstrateGrainIDs in the same order
+void readSubstrateFile_ASCII(std::string SubstrateFileName, int nx, int MyYSlices, int MyYOffset, int id,
+                             int BaseplateSizeZ, ViewI_H SubstrateGrainIDs) {
 
-    // Assign GrainID values to cells that are part of the substrate - read values from file and initialize using
-    // temporary host view
-    ViewI_H GrainID_Host(Kokkos::ViewAllocateWithoutInitializing("GrainID_Host"), nx * MyYSlices * nz);
     std::ifstream Substrate;
     Substrate.open(SubstrateFileName);
     int Substrate_LowY = MyYOffset;
     int Substrate_HighY = MyYOffset + MyYSlices;
     int nxS, nyS, nzS;
-    int BaseplateSizeZ; // in CA cells
-    if (BaseplateThroughPowder)
-        BaseplateSizeZ = nz; // baseplate microstructure used as entire domain's initial condition
-    else
-        BaseplateSizeZ = nzActive; // baseplate microstructure is layer 0's initial condition
     std::string s;
     getline(Substrate, s);
     std::size_t found = s.find("=");
@@ -1735,21 +2191,240 @@ void SubstrateInit_FromFile(std::string SubstrateFileName, int nz, int nx, int M
             for (int i = 0; i < nxS; i++) {
                 std::string GIDVal;
                 getline(Substrate, GIDVal);
-                if ((j >= Substrate_LowY) && (j < Substrate_HighY)) {
-                    int CAGridLocation;
-                    CAGridLocation = k * nx * MyYSlices + i * MyYSlices + (j - MyYOffset);
-                    GrainID_Host(CAGridLocation) = stoi(GIDVal, nullptr, 10);
-                }
+                if ((j >= Substrate_LowY) && (j < Substrate_HighY))
+                    SubstrateGrainIDs((k * MyYSlices + j - MyYOffset) * nx + i) = stoi(GIDVal, nullptr, 10);
             }
         }
     }
     Substrate.close();
-    // Copy GrainIDs read from file to device
-    GrainID_Device = Kokkos::create_mirror_view_and_copy(device_memory_space(), GrainID_Host);
+}
+
+// Read GrainID values for Z = 0 through BaseplateSizeZ - 1 and the Y coordinates on this rank from a binary substrate
+// file (the characters "ExaCASub", the Z, Y, and X dimensions, then the GrainID values with X varying fastest and Z
+// slowest, all as 32-bit integers in native byte order), storing them in SubstrateGrainIDs in the same order. All
+// ranks read their part of the file together using MPI-IO, without parsing the parts of the file for other ranks
+void readSubstrateFile_Binary(std::string SubstrateFileName, int nx, int ny, int MyYSlices, int MyYOffset,
+                              int BaseplateSizeZ, ViewI_H SubstrateGrainIDs) {
+
+    MPI_File Substrate;
+    if (MPI_File_open(MPI_COMM_WORLD, SubstrateFileName.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &Substrate) !=
+        MPI_SUCCESS)
+        throw std::runtime_error("Error: Could not open substrate file " + SubstrateFileName);
+    // Header (read by all ranks, so that all ranks agree on whether the file is usable)
+    char FileType[8];
+    int nzyxS[3];
+    MPI_File_read_at_all(Substrate, 0, FileType, 8, MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_read_at_all(Substrate, 8, nzyxS, 3, MPI_INT, MPI_STATUS_IGNORE);
+    if (std::string(FileType, 8) != "ExaCASub") {
+        MPI_File_close(&Substrate);
+        throw std::runtime_error("Error: " + SubstrateFileName + " is not a binary substrate file");
+    }
+    int nzS = nzyxS[0];
+    int nyS = nzyxS[1];
+    int nxS = nzyxS[2];
+    if ((nyS != ny) || (nxS != nx)) {
+        MPI_File_close(&Substrate);
+        throw std::runtime_error("Error: substrate data in the file " + SubstrateFileName + " spans " +
+                                 std::to_string(nxS) + " by " + std::to_string(nyS) +
+                                 " cells in X and Y, but the domain spans " + std::to_string(nx) + " by " +
+                                 std::to_string(ny) + " cells");
+    }
+    if (nzS < BaseplateSizeZ) {
+        // Do not allow simulation if there is inssufficient substrate data in the specified file
+        MPI_File_close(&Substrate);
+        std::string error = "Error: only " + std::to_string(nzS) +
+                            " layers of substrate data are present in the file " + SubstrateFileName + " ; at least " +
+                            std::to_string(BaseplateSizeZ) +
+                            " layers of substrate data are required to simulate the specified solidification problem";
+        throw std::runtime_error(error);
+    }
+
+    // Each rank's part of the file: the rows for its Y coordinates in each of the first BaseplateSizeZ planes
+    int FileSizes[3] = {nzS, nyS, nxS};
+    int RankSizes[3] = {BaseplateSizeZ, MyYSlices, nxS};
+    int RankStarts[3] = {0, MyYOffset, 0};
+    MPI_Datatype RankSubstrate;
+    MPI_Type_create_subarray(3, FileSizes, RankSizes, RankStarts, MPI_ORDER_C, MPI_INT, &RankSubstrate);
+    MPI_Type_commit(&RankSubstrate);
+    MPI_File_set_view(Substrate, 8 + 3 * sizeof(int), MPI_INT, RankSubstrate, "native", MPI_INFO_NULL);
+    MPI_File_read_all(Substrate, SubstrateGrainIDs.data(), BaseplateSizeZ * MyYSlices * nx, MPI_INT,
+                      MPI_STATUS_IGNORE);
+    MPI_Type_free(&RankSubstrate);
+    MPI_File_close(&Substrate);
+}
+
+// Initializes Grain ID values for the baseplate (or, if BaseplateThroughPowder is true, the whole domain) using
+// substrate data from a file, in either ASCII or binary (extension .casub) format. Assumes GrainID values were
+// initialized to zeros
+void SubstrateInit_FromFile(std::string SubstrateFileName, int nz, int nx, int ny, int MyYSlices, int MyYOffset, int id,
+                            ViewI GrainID, int nzActive, bool BaseplateThroughPowder) {
+
+    int BaseplateSizeZ; // in CA cells
+    if (BaseplateThroughPowder)
+        BaseplateSizeZ = nz; // baseplate microstructure used as entire domain's initial condition
+    else
+        BaseplateSizeZ = nzActive; // baseplate microstructure is layer 0's initial condition
+
+    // Read GrainID values for this rank's part of the baseplate from the file into a temporary host view, in the order
+    // they are stored in the file
+    ViewI_H SubstrateGrainIDs_Host(Kokkos::ViewAllocateWithoutInitializing("SubstrateGrainIDs_Host"),
+                                   BaseplateSizeZ * MyYSlices * nx);
+    if (checkSubstrateFileFormat(SubstrateFileName))
+        readSubstrateFile_Binary(SubstrateFileName, nx, ny, MyYSlices, MyYOffset, BaseplateSizeZ,
+                                 SubstrateGrainIDs_Host);
+    else
+        readSubstrateFile_ASCII(SubstrateFileName, nx, MyYSlices, MyYOffset, id, BaseplateSizeZ,
+                                SubstrateGrainIDs_Host);
+
+    // Copy GrainIDs read from file to device, and reorder them into the cells of the baseplate
+    ViewI SubstrateGrainIDs = Kokkos::create_mirror_view_and_copy(device_memory_space(), SubstrateGrainIDs_Host);
+    Kokkos::parallel_for(
+        "SubstrateInit",
+        Kokkos::MDRangePolicy<Kokkos::Rank<3, Kokkos::Iterate::Right, Kokkos::Iterate::Right>>(
+            {0, 0, 0}, {BaseplateSizeZ, nx, MyYSlices}),
+        KOKKOS_LAMBDA(const int k, const int i, const int j) {
+            GrainID(k * nx * MyYSlices + i * MyYSlices + j) = SubstrateGrainIDs((k * MyYSlices + j) * nx + i);
+        });
+    Kokkos::fence();
     if (id == 0)
         std::cout << "Substrate file read complete" << std::endl;
 }
 
+// Assigns each cell in Z = 0 through SizeZ - 1 the GrainID of the closest of NumberOfCenters grain centers (a Voronoi
+// tessellation), where CenterLocations are 1D coordinates (Z * nx * ny + X * ny + Y, relative to the whole domain) and
+// CenterGrainIDs the associated GrainID values. Cells equidistant from multiple centers are assigned the GrainID of
+// the center listed first. Assumes GrainID values in this region were initialized to zeros
+void assignVoronoiGrainIDs(int NumberOfCenters, ViewI CenterLocations, ViewI CenterGrainIDs, int nx, int ny, int SizeZ,
+                           int MyYSlices, int MyYOffset, ViewI GrainID) {
+
+    // First, assign cells that are associated with grain centers the appropriate non-zero GrainID values
+    Kokkos::parallel_for(
+        "BaseplateInit", NumberOfCenters, KOKKOS_LAMBDA(const int &n) {
+            int CenterLoc = CenterLocations(n);
+            // x, y, z associated with grain center "n", at 1D coordinate "CenterLoc"
+            int z_n = CenterLoc / (nx * ny);
+            int Rem = CenterLoc % (nx * ny);
+            int x_n = Rem / ny;
+            int y_n = Rem % ny;
+            if ((y_n >= MyYOffset) && (y_n < MyYOffset + MyYSlices)) {
+                // This grain is associated with a cell on this MPI rank
+                int CAGridLocation = z_n * nx * MyYSlices + x_n * MyYSlices + (y_n - MyYOffset);
+                GrainID(CAGridLocation) = CenterGrainIDs(n);
+            }
+        });
+
+    // Group the grain centers into cubic buckets of BucketSize cells per side, sized to hold about one center each, so
+    // that only the centers in buckets near each cell need to be checked: count the centers in each bucket (storing
+    // each center's position among them), then use the counts to find where each bucket's list of centers starts
+    double CellsPerCenter = static_cast<double>(nx) * static_cast<double>(ny) * SizeZ / NumberOfCenters;
+    int BucketSize = std::max(1, static_cast<int>(ceil(cbrt(CellsPerCenter))));
+    int NumBucketsX = (nx + BucketSize - 1) / BucketSize;
+    int NumBucketsY = (ny + BucketSize - 1) / BucketSize;
+    int NumBucketsZ = (SizeZ + BucketSize - 1) / BucketSize;
+    int NumBuckets = NumBucketsX * NumBucketsY * NumBucketsZ;
+    ViewI BucketCount("BucketCount", NumBuckets);
+    ViewI BucketStart(Kokkos::ViewAllocateWithoutInitializing("BucketStart"), NumBuckets);
+    ViewI BucketPosition(Kokkos::ViewAllocateWithoutInitializing("BucketPosition"), NumberOfCenters);
+    ViewI BucketCenters(Kokkos::ViewAllocateWithoutInitializing("BucketCenters"), NumberOfCenters);
+    Kokkos::parallel_for(
+        "CountBucketCenters", NumberOfCenters, KOKKOS_LAMBDA(const int &n) {
+            int CenterLoc = CenterLocations(n);
+            int z_n = CenterLoc / (nx * ny);
+            int Rem = CenterLoc % (nx * ny);
+            int x_n = Rem / ny;
+            int y_n = Rem % ny;
+            int Bucket = ((z_n / BucketSize) * NumBucketsX + x_n / BucketSize) * NumBucketsY + y_n / BucketSize;
+            BucketPosition(n) = Kokkos::atomic_fetch_add(&BucketCount(Bucket), 1);
+        });
+    Kokkos::parallel_scan(
+        "BucketStart", NumBuckets, KOKKOS_LAMBDA(const int &m, int &Update, const bool &final) {
+            if (final)
+                BucketStart(m) = Update;
+            Update += BucketCount(m);
+        });
+    Kokkos::parallel_for(
+        "GroupBucketCenters", NumberOfCenters, KOKKOS_LAMBDA(const int &n) {
+            int CenterLoc = CenterLocations(n);
+            int z_n = CenterLoc / (nx * ny);
+            int Rem = CenterLoc % (nx * ny);
+            int x_n = Rem / ny;
+            int y_n = Rem % ny;
+            int Bucket = ((z_n / BucketSize) * NumBucketsX + x_n / BucketSize) * NumBucketsY + y_n / BucketSize;
+            BucketCenters(BucketStart(Bucket) + BucketPosition(n)) = n;
+        });
+    int MaxShell = std::max(NumBucketsX, std::max(NumBucketsY, NumBucketsZ));
+
+    // For cells that are not associated with grain centers, assign them the GrainID of the nearest grain center.
+    // Buckets are checked in shells of increasing distance from the cell's bucket, stopping once every center outside
+    // of the shells checked so far must be farther away than the closest center found
+    Kokkos::parallel_for(
+        "BaseplateGen",
+        Kokkos::MDRangePolicy<Kokkos::Rank<3, Kokkos::Iterate::Right, Kokkos::Iterate::Right>>({0, 0, 0},
+                                                                                               {SizeZ, nx, MyYSlices}),
+        KOKKOS_LAMBDA(const int k, const int i, const int j) {
+            int CAGridLocation = k * nx * MyYSlices + i * MyYSlices + j;
+            if (GrainID(CAGridLocation) == 0) {
+                // This cell needs to be assigned a GrainID value
+                int BucketX = i / BucketSize;
+                int BucketY = (j + MyYOffset) / BucketSize;
+                int BucketZ = k / BucketSize;
+                float MinDistanceToThisGrain = nx * ny * SizeZ;
+                int MinDistanceToThisGrain_Center = NumberOfCenters;
+                for (int Shell = 0; Shell < MaxShell; Shell++) {
+                    // Range of buckets in this shell that are in the domain
+                    int BucketZ_Low = (BucketZ - Shell < 0) ? 0 : BucketZ - Shell;
+                    int BucketZ_High = (BucketZ + Shell >= NumBucketsZ) ? NumBucketsZ - 1 : BucketZ + Shell;
+                    int BucketX_Low = (BucketX - Shell < 0) ? 0 : BucketX - Shell;
+                    int BucketX_High = (BucketX + Shell >= NumBucketsX) ? NumBucketsX - 1 : BucketX + Shell;
+                    int BucketY_Low = (BucketY - Shell < 0) ? 0 : BucketY - Shell;
+                    int BucketY_High = (BucketY + Shell >= NumBucketsY) ? NumBucketsY - 1 : BucketY + Shell;
+                    for (int bz = BucketZ_Low; bz <= BucketZ_High; bz++) {
+                        for (int bx = BucketX_Low; bx <= BucketX_High; bx++) {
+                            for (int by = BucketY_Low; by <= BucketY_High; by++) {
+                                // Only check buckets on the surface of this shell, as the rest were already checked
+                                if ((abs(bz - BucketZ) != Shell) && (abs(bx - BucketX) != Shell) &&
+                                    (abs(by - BucketY) != Shell))
+                                    continue;
+                                int Bucket = (bz * NumBucketsX + bx) * NumBucketsY + by;
+                                int FirstCenter = BucketStart(Bucket);
+                                int LastCenter = FirstCenter + BucketCount(Bucket);
+                                for (int p = FirstCenter; p < LastCenter; p++) {
+                                    // Grain center at x_n, y_n, z_n - how far is the cell at i, j+MyYOffset, k?
+                                    int n = BucketCenters(p);
+                                    int z_n = CenterLocations(n) / (nx * ny);
+                                    int Rem = CenterLocations(n) % (nx * ny);
+                                    int x_n = Rem / ny;
+                                    int y_n = Rem % ny;
+                                    float DistanceToThisGrainX = i - x_n;
+                                    float DistanceToThisGrainY = (j + MyYOffset) - y_n;
+                                    float DistanceToThisGrainZ = k - z_n;
+                                    float DistanceToThisGrain = sqrtf(DistanceToThisGrainX * DistanceToThisGrainX +
+                                                                      DistanceToThisGrainY * DistanceToThisGrainY +
+                                                                      DistanceToThisGrainZ * DistanceToThisGrainZ);
+                                    // Of equally close centers, the one listed first is used
+                                    if ((DistanceToThisGrain < MinDistanceToThisGrain) ||
+                                        ((DistanceToThisGrain == MinDistanceToThisGrain) &&
+                                         (n < MinDistanceToThisGrain_Center))) {
+                                        // This is the closest grain center to cell at "CAGridLocation" - update values
+                                        MinDistanceToThisGrain = DistanceToThisGrain;
+                                        MinDistanceToThisGrain_Center = n;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    // Any center in a bucket outside of this shell is at least Shell * BucketSize + 1 cells away in X,
+                    // Y, or Z
+                    float OutsideDistance = Shell * BucketSize + 1;
+                    if (MinDistanceToThisGrain < sqrtf(OutsideDistance * OutsideDistance))
+                        break;
+                }
+                // GrainID associated with the closest grain center
+                GrainID(CAGridLocation) = CenterGrainIDs(MinDistanceToThisGrain_Center);
+            }
+        });
+}
+
 // Initializes Grain ID values where the baseplate is generated using an input grain spacing and a Voronoi Tessellation
 void BaseplateInit_FromGrainSpacing(float SubstrateGrainSpacing, int nx, int ny, double *ZMinLayer, double *ZMaxLayer,
                                     int MyYSlices, int MyYOffset, int id, double deltax, ViewI GrainID, double RNGSeed,
@@ -1762,7 +2437,7 @@ void BaseplateInit_FromGrainSpacing(float SubstrateGrainSpacing, int nx, int ny,
     else
         BaseplateSizeZ = round((ZMaxLayer[0] - ZMinLayer[0]) / deltax) +
                          1; // baseplate microstructure is layer 0's initial condition
-    std::mt19937_64 gen(RNGSeed);
+    CounterRNG RNG(RNGSeed, BaseplateStream, 0);
 
     // Based on the baseplate volume (convert to cubic microns to match units) and the substrate grain spacing,
     // determine the number of baseplate grains
@@ -1773,97 +2448,26 @@ void BaseplateInit_FromGrainSpacing(float SubstrateGrainSpacing, int nx, int ny,
     // Need at least 1 baseplate grain, cannot have more baseplate grains than cells in the baseplate
     NumberOfBaseplateGrains = std::max(NumberOfBaseplateGrains, 1);
     NumberOfBaseplateGrains = std::min(NumberOfBaseplateGrains, nx * ny * BaseplateSizeZ);
-    // TODO: Use device RNG to generate baseplate grain locations, instead of host with copy
-    // List of potential grain IDs (starting at 1) - index corresponds to the associated CA cell location
-    // Assign positive values for indices 0 through NumberOfBaseplateGrains-1, assign zeros to the remaining indices
-    std::vector<int> BaseplateGrainLocations(BaseplateVolume);
-    std::vector<int> BaseplateGrainIDs(BaseplateVolume);
-    for (int i = 0; i < BaseplateVolume; i++) {
-        BaseplateGrainLocations[i] = i;
-        if (i < NumberOfBaseplateGrains)
-            BaseplateGrainIDs[i] = i + 1;
-        else
-            BaseplateGrainIDs[i] = 0;
-    }
-    // Shuffle list of grain IDs
-    std::shuffle(BaseplateGrainIDs.begin(), BaseplateGrainIDs.end(), gen);
-
-    // Create views of baseplate grain IDs and locations - copying BaseplateGrainIDs and BaseplateGrainLocations values
-    // only for indices where BaseplateGrainIDs(i) != 0 (cells with BaseplateGrainIDs(i) = 0 were not assigned baseplate
-    // center locations)
-    ViewI_H BaseplateGrainLocations_Host(Kokkos::ViewAllocateWithoutInitializing("BaseplateGrainLocations_Host"),
+    // Baseplate grain centers are at the first NumberOfBaseplateGrains positions of a random permutation of the
+    // baseplate's cells, with GrainID values starting at 1
+    RandomPermutation BaseplatePermutation(RNG, BaseplateVolume);
+    ViewI BaseplateGrainLocations_Device(Kokkos::ViewAllocateWithoutInitializing("BaseplateGrainLocations"),
                                          NumberOfBaseplateGrains);
-    ViewI_H BaseplateGrainIDs_Host(Kokkos::ViewAllocateWithoutInitializing("BaseplateGrainIDs_Host"),
+    ViewI BaseplateGrainIDs_Device(Kokkos::ViewAllocateWithoutInitializing("BaseplateGrainIDs"),
                                    NumberOfBaseplateGrains);
-    int count = 0;
-    for (int i = 0; i < BaseplateVolume; i++) {
-        if (BaseplateGrainIDs[i] != 0) {
-            BaseplateGrainLocations_Host(count) = BaseplateGrainLocations[i];
-            BaseplateGrainIDs_Host(count) = BaseplateGrainIDs[i];
-            count++;
-        }
-    }
-
-    // Copy baseplate views to the device
-    ViewI BaseplateGrainIDs_Device = Kokkos::create_mirror_view_and_copy(device_memory_space(), BaseplateGrainIDs_Host);
-    ViewI BaseplateGrainLocations_Device =
-        Kokkos::create_mirror_view_and_copy(device_memory_space(), BaseplateGrainLocations_Host);
+    Kokkos::parallel_for(
+        "BaseplateGrainCenters", NumberOfBaseplateGrains, KOKKOS_LAMBDA(const int &n) {
+            BaseplateGrainLocations_Device(n) = BaseplatePermutation(n);
+            BaseplateGrainIDs_Device(n) = n + 1;
+        });
     if (id == 0) {
         std::cout << "Baseplate spanning domain coordinates Z = 0 through " << BaseplateSizeZ - 1 << std::endl;
         std::cout << "Number of baseplate grains: " << NumberOfBaseplateGrains << std::endl;
     }
 
-    // First, assign cells that are associated with grain centers the appropriate non-zero GrainID values (assumes
-    // GrainID values were initialized to zeros)
-    Kokkos::parallel_for(
-        "BaseplateInit", NumberOfBaseplateGrains, KOKKOS_LAMBDA(const int &n) {
-            int BaseplateGrainLoc = BaseplateGrainLocations_Device(n);
-            // x, y, z associated with baseplate grain "n", at 1D coordinate "BaseplateGrainLoc"
-            int z_n = BaseplateGrainLoc / (nx * ny);
-            int Rem = BaseplateGrainLoc % (nx * ny);
-            int x_n = Rem / ny;
-            int y_n = Rem % ny;
-            if ((y_n >= MyYOffset) && (y_n < MyYOffset + MyYSlices)) {
-                // This grain is associated with a cell on this MPI rank
-                int CAGridLocation = z_n * nx * MyYSlices + x_n * MyYSlices + (y_n - MyYOffset);
-                GrainID(CAGridLocation) = BaseplateGrainIDs_Device(n);
-            }
-        });
-    Kokkos::fence();
-    // For cells that are not associated with grain centers, assign them the GrainID of the nearest grain center
-    Kokkos::parallel_for(
-        "BaseplateGen",
-        Kokkos::MDRangePolicy<Kokkos::Rank<3, Kokkos::Iterate::Right, Kokkos::Iterate::Right>>(
-            {0, 0, 0}, {BaseplateSizeZ, nx, MyYSlices}),
-        KOKKOS_LAMBDA(const int k, const int i, const int j) {
-            int CAGridLocation = k * nx * MyYSlices + i * MyYSlices + j;
-            if (GrainID(CAGridLocation) == 0) {
-                // This cell needs to be assigned a GrainID value
-                // Check each possible baseplate grain center to find the closest one
-                float MinDistanceToThisGrain = nx * ny * BaseplateSizeZ;
-                int MinDistanceToThisGrain_GrainID = 0;
-                for (int n = 0; n < NumberOfBaseplateGrains; n++) {
-                    // Baseplate grain center at x_n, y_n, z_n - how far is the cell at i, j+MyYOffset, k?
-                    int z_n = BaseplateGrainLocations_Device(n) / (nx * ny);
-                    int Rem = BaseplateGrainLocations_Device(n) % (nx * ny);
-                    int x_n = Rem / ny;
-                    int y_n = Rem % ny;
-                    float DistanceToThisGrainX = i - x_n;
-                    float DistanceToThisGrainY = (j + MyYOffset) - y_n;
-                    float DistanceToThisGrainZ = k - z_n;
-                    float DistanceToThisGrain = sqrtf(DistanceToThisGrainX * DistanceToThisGrainX +
-                                                      DistanceToThisGrainY * DistanceToThisGrainY +
-                                                      DistanceToThisGrainZ * DistanceToThisGrainZ);
-                    if (DistanceToThisGrain < MinDistanceToThisGrain) {
-                        // This is the closest grain center to cell at "CAGridLocation" - update values
-                        MinDistanceToThisGrain = DistanceToThisGrain;
-                        MinDistanceToThisGrain_GrainID = BaseplateGrainIDs_Device(n);
-                    }
-                }
-                // GrainID associated with the closest baseplate grain center
-                GrainID(CAGridLocation) = MinDistanceToThisGrain_GrainID;
-            }
-        });
+    // Assign each baseplate cell the GrainID of the nearest grain center
+    assignVoronoiGrainIDs(NumberOfBaseplateGrains, BaseplateGrainLocations_Device, BaseplateGrainIDs_Device, nx, ny,
+                          BaseplateSizeZ, MyYSlices, MyYOffset, GrainID);
 
     NextLayer_FirstEpitaxialGrainID =
         NumberOfBaseplateGrains + 2; // avoid reusing GrainID in next layer's powder grain structure
@@ -1875,27 +2479,16 @@ void BaseplateInit_FromGrainSpacing(float SubstrateGrainSpacing, int nx, int ny,
 // the edges of partially melted powder particles)
 void PowderInit(int layernumber, int nx, int ny, int LayerHeight, double *ZMaxLayer, double ZMin, double deltax,
                 int MyYSlices, int MyYOffset, int id, ViewI GrainID, double RNGSeed,
-                int &NextLayer_FirstEpitaxialGrainID, double PowderActiveFraction) {
+                int &NextLayer_FirstEpitaxialGrainID, double PowderActiveFraction, int FrozenZ) {
 
-    // On all ranks, generate list of powder grain IDs (starting with NextLayer_FirstEpitaxialGrainID, and shuffle them
-    // so that their locations aren't sequential and depend on the RNGSeed (different for each layer)
-    std::mt19937_64 gen(RNGSeed + layernumber);
-    std::uniform_real_distribution<double> dis(0.0, 1.0);
-
-    // TODO: This should be performed on the device, rather than the host
+    // Powder grain IDs (starting with NextLayer_FirstEpitaxialGrainID) are assigned to the cells at the first
+    // PowderLayerAssignedCells positions of a random permutation of the powder layer's cells, so that their locations
+    // aren't sequential and depend on the RNGSeed (using a different stream for each layer)
+    CounterRNG RNG(RNGSeed, PowderStream, layernumber);
     int PowderLayerCells = nx * ny * LayerHeight;
     int PowderLayerAssignedCells = round(static_cast<double>(PowderLayerCells) * PowderActiveFraction);
-    std::vector<int> PowderGrainIDs(PowderLayerCells, 0);
-    for (int n = 0; n < PowderLayerAssignedCells; n++) {
-        PowderGrainIDs[n] = n + NextLayer_FirstEpitaxialGrainID; // assigned a nonzero GrainID
-    }
-    std::shuffle(PowderGrainIDs.begin(), PowderGrainIDs.end(), gen);
-    // Copy powder layer GrainIDs into a host view, then a device view
-    ViewI_H PowderGrainIDs_Host(Kokkos::ViewAllocateWithoutInitializing("PowderGrainIDs_Host"), PowderLayerCells);
-    for (int n = 0; n < PowderLayerCells; n++) {
-        PowderGrainIDs_Host(n) = PowderGrainIDs[n];
-    }
-    ViewI PowderGrainIDs_Device = Kokkos::create_mirror_view_and_copy(device_memory_space(), PowderGrainIDs_Host);
+    RandomPermutation PowderPermutation(RNG, PowderLayerCells);
+
     // Associate powder grain IDs with CA cells in the powder layer
     // Use bounds from temperature field for this layer to determine which cells are part of the powder
     int PowderTopZ = round((ZMaxLayer[layernumber] - ZMin) / deltax) + 1;
@@ -1905,23 +2498,25 @@ void PowderInit(int layernumber, int nx, int ny, int LayerHeight, double *ZMaxLa
         std::cout << "Initializing powder layer for Z = " << PowderBottomZ << " through " << PowderTopZ - 1 << " ("
                   << nx * ny * (PowderTopZ - PowderBottomZ) << " cells)" << std::endl;
 
-    int PowderStart = nx * ny * PowderBottomZ;
-    int PowderEnd = nx * ny * PowderTopZ;
     if (id == 0)
         std::cout << "Powder layer has " << PowderLayerAssignedCells
                   << " cells assigned new grain ID values, ranging from " << NextLayer_FirstEpitaxialGrainID
                   << " through " << NextLayer_FirstEpitaxialGrainID + PowderLayerAssignedCells - 1 << std::endl;
     Kokkos::parallel_for(
-        "PowderGrainInit", Kokkos::RangePolicy<>(PowderStart, PowderEnd), KOKKOS_LAMBDA(const int &n) {
-            int GlobalZ = n / (nx * ny);
-            int Rem = n % (nx * ny);
-            int GlobalX = Rem / ny;
-            int GlobalY = Rem % ny;
-            // Is this powder coordinate in X and Y in bounds for this rank? Is the grain id of this site unassigned
-            // (wasn't captured during solidification of the previous layer)?
-            int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + GlobalX * MyYSlices + (GlobalY - MyYOffset);
-            if ((GlobalY >= MyYOffset) && (GlobalY < MyYOffset + MyYSlices) && (GrainID(GlobalD3D1ConvPosition) == 0))
-                GrainID(GlobalD3D1ConvPosition) = PowderGrainIDs_Device(n - PowderStart);
+        "PowderGrainInit",
+        Kokkos::MDRangePolicy<Kokkos::Rank<3, Kokkos::Iterate::Right, Kokkos::Iterate::Right>>(
+            {PowderBottomZ, 0, 0}, {PowderTopZ, nx, MyYSlices}),
+        KOKKOS_LAMBDA(const int GlobalZ, const int GlobalX, const int RankY) {
+            // Is the grain id of this site unassigned (wasn't captured during solidification of the previous layer)?
+            // Cells below FrozenZ are not stored
+            int GlobalD3D1ConvPosition = (GlobalZ - FrozenZ) * nx * MyYSlices + GlobalX * MyYSlices + RankY;
+            if (GrainID(GlobalD3D1ConvPosition) == 0) {
+                // Position of this cell in the permutation of the powder layer's cells
+                int PowderLoc = (GlobalZ - PowderBottomZ) * nx * ny + GlobalX * ny + RankY + MyYOffset;
+                int PowderPosition = PowderPermutation(PowderLoc);
+                if (PowderPosition < PowderLayerAssignedCells)
+                    GrainID(GlobalD3D1ConvPosition) = PowderPosition + NextLayer_FirstEpitaxialGrainID;
+            }
         });
     Kokkos::fence();
 
@@ -1933,29 +2528,38 @@ void PowderInit(int layernumber, int nx, int ny, int LayerHeight, double *ZMaxLa
 }
 
 //*****************************************************************************/
-// Initializes cells at border of solid and liquid as active type - performed on device
+// Initializes cells at border of solid and liquid as active type - performed on device. Cell types are assigned based
+// on the temperature data for cells between global Z coordinates InitZ_Low and InitZ_High (inclusive), which is either
+// all cells at the start of the simulation, or (if temperature data is initialized one layer at a time) the cells
+// between the top of the previous layer and the top of this one
 void CellTypeInit_NoRemelt(int layernumber, int id, int np, int nx, int MyYSlices, int MyYOffset, int ZBound_Low,
-                           int nz, int LocalActiveDomainSize, int LocalDomainSize, ViewI CellType, ViewI CritTimeStep,
-                           NList NeighborX, NList NeighborY, NList NeighborZ, int NGrainOrientations,
-                           ViewF GrainUnitVector, ViewF DiagonalLength, ViewI GrainID, ViewF CritDiagonalLength,
-                           ViewF DOCenter, ViewI LayerID, Buffer2D BufferNorthSend, Buffer2D BufferSouthSend,
-                           int BufSizeX, bool AtNorthBoundary, bool AtSouthBoundary) {
+                           int XBound_Low, int nxActive, int YBound_Low, int nyActive, int nz,
+                           int LocalActiveDomainSize, int InitZ_Low, int InitZ_High, ViewI CellType,
+                           ViewI CritTimeStep, NList NeighborX, NList NeighborY, NList NeighborZ,
+                           int NGrainOrientations, ViewF GrainUnitVector, ViewF DiagonalLength, ViewI GrainID,
+                           ViewF CritDiagonalLength, ViewF DOCenter, ViewI LayerID, Buffer2D BufferNorthSend,
+                           Buffer2D BufferSouthSend, int BufSizeX, bool AtNorthBoundary, bool AtSouthBoundary) {
 
     // Start with all cells as solid for the first layer, with liquid cells where temperature data exists
-    if (layernumber == 0) {
+    if (layernumber == 0)
         Kokkos::deep_copy(CellType, Solid);
+    if (InitZ_High >= InitZ_Low) {
+        int InitOffset = InitZ_Low * nx * MyYSlices;
+        int InitSize = (InitZ_High - InitZ_Low + 1) * nx * MyYSlices;
         // This is done prior to initializing active cells, as active cells are initialized based on neighbor cell types
         Kokkos::parallel_for(
-            "CellTypeInitSolLiq", LocalDomainSize, KOKKOS_LAMBDA(const int &GlobalD3D1ConvPosition) {
+            "CellTypeInitSolLiq", InitSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+                int GlobalD3D1ConvPosition = D3D1ConvPosition + InitOffset;
                 if (CritTimeStep(GlobalD3D1ConvPosition) != 0)
                     CellType(GlobalD3D1ConvPosition) = Liquid;
             });
         Kokkos::fence();
         int ActCellCount = 0;
         Kokkos::parallel_reduce(
-            "CellTypeInitAct", LocalDomainSize,
-            KOKKOS_LAMBDA(const int &GlobalD3D1ConvPosition, int &ActCellCount) {
+            "CellTypeInitAct", InitSize,
+            KOKKOS_LAMBDA(const int &D3D1ConvPosition, int &ActCellCount) {
                 // Cells of interest for the CA
+                int GlobalD3D1ConvPosition = D3D1ConvPosition + InitOffset;
                 int GlobalZ = GlobalD3D1ConvPosition / (nx * MyYSlices);
                 int Rem = GlobalD3D1ConvPosition % (nx * MyYSlices);
                 int RankX = Rem / MyYSlices;
@@ -1976,7 +2580,10 @@ void CellTypeInit_NoRemelt(int layernumber, int id, int np, int nx, int MyYSlice
                             MyNeighborZ * nx * MyYSlices + MyNeighborX * MyYSlices + MyNeighborY;
                         if ((MyNeighborX >= 0) && (MyNeighborX < nx) && (MyNeighborY >= 0) &&
                             (MyNeighborY < MyYSlices) && (MyNeighborZ >= 0) && (MyNeighborZ < nz)) {
-                            if ((CellType(NeighborD3D1ConvPosition) == Solid) || (GlobalZ == 0)) {
+                            // Neighbors without temperature data were initialized as solid. Cells from previous
+                            // layers may have since solidified, so the temperature data is checked rather than the
+                            // cell type
+                            if ((CritTimeStep(NeighborD3D1ConvPosition) == 0) || (GlobalZ == 0)) {
                                 // This cell is at the interface - becomes active type
                                 CellType(GlobalD3D1ConvPosition) = Active;
                                 ActCellCount++;
@@ -1992,25 +2599,24 @@ void CellTypeInit_NoRemelt(int layernumber, int id, int np, int nx, int MyYSlice
         int TotalSubstrateActCells;
         MPI_Reduce(&ActCellCount, &TotalSubstrateActCells, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
         if (id == 0)
-            std::cout << "Number of initial substrate active cells across all ranks and all layers: "
-                      << TotalSubstrateActCells << std::endl;
+            std::cout << "Number of initial substrate active cells across all ranks for Z = " << InitZ_Low
+                      << " through " << InitZ_High << ": " << TotalSubstrateActCells << std::endl;
     }
 
     // Each layer, count number of active cells are at the solid-liquid boundary for this layer's portion of the domain
     Kokkos::parallel_for(
         "CellTypeInitAct", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
             // Cells of interest for the CA
-            int RankZ = D3D1ConvPosition / (nx * MyYSlices);
-            int Rem = D3D1ConvPosition % (nx * MyYSlices);
-            int GlobalX = Rem / MyYSlices;
-            int RankY = Rem % MyYSlices;
+            int RankZ = D3D1ConvPosition / (nxActive * nyActive);
+            int Rem = D3D1ConvPosition % (nxActive * nyActive);
+            int ActiveX = Rem / nyActive;
+            int GlobalX = ActiveX + XBound_Low;
+            int RankY = Rem % nyActive + YBound_Low;
             int GlobalZ = RankZ + ZBound_Low;
             int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + GlobalX * MyYSlices + RankY;
             if ((CellType(GlobalD3D1ConvPosition) == Active) && (LayerID(GlobalD3D1ConvPosition) == layernumber)) {
                 // This cell was marked as active previously - initialize active cell data structures
                 int GlobalY = RankY + MyYOffset;
-                int RankZ = GlobalZ - ZBound_Low;
-                int D3D1ConvPosition = RankZ * nx * MyYSlices + GlobalX * MyYSlices + RankY;
                 int MyGrainID = GrainID(GlobalD3D1ConvPosition);
                 // Initialize new octahedron
                 createNewOctahedron(D3D1ConvPosition, DiagonalLength, DOCenter, GlobalX, GlobalY, GlobalZ);
@@ -2033,7 +2639,7 @@ void CellTypeInit_NoRemelt(int layernumber, int id, int np, int nx, int MyYSlice
                     double GhostDOCZ = static_cast<double>(GlobalZ + 0.5);
                     double GhostDL = 0.01;
                     // Collect data for the ghost nodes, if necessary
-                    loadghostnodes(GhostGID, GhostDOCX, GhostDOCY, GhostDOCZ, GhostDL, BufSizeX, MyYSlices, GlobalX,
+                    loadghostnodes(GhostGID, GhostDOCX, GhostDOCY, GhostDOCZ, GhostDL, BufSizeX, MyYSlices, ActiveX,
                                    RankY, RankZ, AtNorthBoundary, AtSouthBoundary, BufferSouthSend, BufferNorthSend);
 
                 } // End if statement for serial/parallel code
@@ -2044,12 +2650,13 @@ void CellTypeInit_NoRemelt(int layernumber, int id, int np, int nx, int MyYSlice
 
 //*****************************************************************************/
 // Initializes cells for the current layer as either solid (don't resolidify) or tempsolid (will melt and resolidify)
-void CellTypeInit_Remelt(int nx, int MyYSlices, int LocalActiveDomainSize, ViewI CellType, ViewI CritTimeStep, int id,
+void CellTypeInit_Remelt(int nx, int MyYSlices, int nzActive, ViewI CellType, ViewI CritTimeStep, int id,
                          int ZBound_Low) {
 
+    // All cells within the layer's Z bounds are initialized, including those outside of the active region X/Y bounds
     int MeltPoolCellCount;
     Kokkos::parallel_reduce(
-        "CellTypeInitSolidRM", LocalActiveDomainSize,
+        "CellTypeInitSolidRM", nx * MyYSlices * nzActive,
         KOKKOS_LAMBDA(const int &D3D1ConvPosition, int &local_count) {
             int GlobalD3D1ConvPosition = D3D1ConvPosition + ZBound_Low * nx * MyYSlices;
             if (CritTimeStep(GlobalD3D1ConvPosition) != 0) {
@@ -2069,114 +2676,118 @@ void CellTypeInit_Remelt(int nx, int MyYSlices, int LocalActiveDomainSize, ViewI
 
 //*****************************************************************************/
 // Determine which nuclei are located on a given MPI rank, and may possibly occur during simulation
-// Place the appropriate nuclei data into the structures NucleiLocation, NucleationTimes, and NucleiGrainID
+// For each of the layer's potential nucleation events, NucleiLocation_AllNuclei is set to the location of the
+// associated cell (or -1 if the event cannot occur on this rank) and NucleationTimes_AllNuclei to the time step at
+// which it may occur
 // Case without remelting (each cell can only have 1 nuclei max, each cell solidifies at most, one time)
-void placeNucleiData_NoRemelt(int Nuclei_ThisLayerSingle, ViewI_H NucleiX, ViewI_H NucleiY, ViewI_H NucleiZ,
-                              int MyYOffset, int nx, int MyYSlices, bool AtNorthBoundary, bool AtSouthBoundary,
-                              int ZBound_Low, ViewI_H CellType_Host, ViewI_H LayerID_Host, ViewI_H CritTimeStep_Host,
-                              ViewF_H UndercoolingChange_Host, int layernumber,
-                              std::vector<int> NucleiGrainID_WholeDomain_V,
-                              std::vector<double> NucleiUndercooling_WholeDomain_V,
-                              std::vector<int> &NucleiGrainID_MyRank_V, std::vector<int> &NucleiLocation_MyRank_V,
-                              std::vector<int> &NucleationTimes_MyRank_V, int &PossibleNuclei_ThisRankThisLayer) {
-
-    for (int NEvent = 0; NEvent < Nuclei_ThisLayerSingle; NEvent++) {
-        if (((NucleiY(NEvent) > MyYOffset) || (AtSouthBoundary)) &&
-            ((NucleiY(NEvent) < MyYOffset + MyYSlices - 1) || (AtNorthBoundary))) {
-            // Convert 3D location (using global X and Y coordinates) into a 1D location (using local X and Y
-            // coordinates) for the possible nucleation event, relative to the bottom of the overall domain
-            int NucleiLocation_AllLayers = (NucleiZ(NEvent) + ZBound_Low) * nx * MyYSlices +
-                                           NucleiX(NEvent) * MyYSlices + (NucleiY(NEvent) - MyYOffset);
-            // Nucleus place criteria - cell is initially liquid, associated with the current layer of the problem
-            if ((CellType_Host(NucleiLocation_AllLayers) == Liquid) &&
-                (LayerID_Host(NucleiLocation_AllLayers) == layernumber)) {
-                // Nucleation event is possible - cell is liquid and associated with this layer of the
-                // multilayer problem - Add nuclei location and undercooling to the list for this rank
-                NucleiLocation_MyRank_V[PossibleNuclei_ThisRankThisLayer] = NucleiLocation_AllLayers;
-                int TimeToNucUnd =
-                    CritTimeStep_Host(NucleiLocation_AllLayers) +
-                    round(NucleiUndercooling_WholeDomain_V[NEvent] / UndercoolingChange_Host(NucleiLocation_AllLayers));
-                NucleationTimes_MyRank_V[PossibleNuclei_ThisRankThisLayer] =
-                    std::max(CritTimeStep_Host(NucleiLocation_AllLayers), TimeToNucUnd);
-                // Assign this cell the potential nucleated grain ID
-                NucleiGrainID_MyRank_V[PossibleNuclei_ThisRankThisLayer] = NucleiGrainID_WholeDomain_V[NEvent];
-                // Increment counter on this MPI rank
-                PossibleNuclei_ThisRankThisLayer++;
+void placeNucleiData_NoRemelt(const NucleiSampler &Sampler, int Nuclei_ThisLayer, int MyYOffset, int nx,
+                              int MyYSlices, bool AtNorthBoundary, bool AtSouthBoundary, int ZBound_Low,
+                              int layernumber, ViewI CellType, ViewI LayerID, ViewI CritTimeStep,
+                              ViewF UndercoolingChange, ViewI NucleiLocation_AllNuclei,
+                              ViewI NucleationTimes_AllNuclei) {
+
+    Kokkos::parallel_for(
+        "PlaceNuclei", Nuclei_ThisLayer, KOKKOS_LAMBDA(const int NEvent) {
+            NucleiLocation_AllNuclei(NEvent) = -1;
+            // Don't put nuclei in "ghost" cells - those nucleation events occur on other ranks. The rest of the event
+            // is only drawn if it is on this rank
+            int NucleusY = Sampler.getNucleusY(NEvent);
+            if (((NucleusY > MyYOffset) || (AtSouthBoundary)) &&
+                ((NucleusY < MyYOffset + MyYSlices - 1) || (AtNorthBoundary))) {
+                int NucleusX, NucleusZ;
+                double NucleusUndercooling;
+                Sampler.getNucleus(NEvent, NucleusX, NucleusY, NucleusZ, NucleusUndercooling);
+                // Convert 3D location (using global X and Y coordinates) into a 1D location (using local X and Y
+                // coordinates) for the possible nucleation event, relative to the bottom of the overall domain
+                int NucleiLocation_AllLayers =
+                    (NucleusZ + ZBound_Low) * nx * MyYSlices + NucleusX * MyYSlices + (NucleusY - MyYOffset);
+                // Nucleus place criteria - cell is initially liquid, associated with the current layer of the problem
+                if ((CellType(NucleiLocation_AllLayers) == Liquid) &&
+                    (LayerID(NucleiLocation_AllLayers) == layernumber)) {
+                    int CritTimeStep_ThisCell = CritTimeStep(NucleiLocation_AllLayers);
+                    int TimeToNucUnd = CritTimeStep_ThisCell +
+                                       round(NucleusUndercooling / UndercoolingChange(NucleiLocation_AllLayers));
+                    NucleiLocation_AllNuclei(NEvent) = NucleiLocation_AllLayers;
+                    NucleationTimes_AllNuclei(NEvent) =
+                        (TimeToNucUnd > CritTimeStep_ThisCell) ? TimeToNucUnd : CritTimeStep_ThisCell;
+                }
             }
-        }
-    }
+        });
 }
 
-// Determine which nuclei are located on a given MPI rank, and may possibly occur during simulation
-// Place the appropriate nuclei data into the structures NucleiLocation, NucleationTimes, and NucleiGrainID
-// Case with remelting (each cell can solidify multiple times, can be the home of multiple nucleation events)
-void placeNucleiData_Remelt(int NucleiMultiplier, int Nuclei_ThisLayerSingle, ViewI_H NucleiX, ViewI_H NucleiY,
-                            ViewI_H NucleiZ, int MyYOffset, int nx, int MyYSlices, bool AtNorthBoundary,
-                            bool AtSouthBoundary, int ZBound_Low, ViewI_H NumberOfSolidificationEvents_Host,
-                            ViewF3D_H LayerTimeTempHistory_Host, std::vector<int> NucleiGrainID_WholeDomain_V,
-                            std::vector<double> NucleiUndercooling_WholeDomain_V,
-                            std::vector<int> &NucleiGrainID_MyRank_V, std::vector<int> &NucleiLocation_MyRank_V,
-                            std::vector<int> &NucleationTimes_MyRank_V, int &PossibleNuclei_ThisRankThisLayer) {
-
-    for (int meltevent = 0; meltevent < NucleiMultiplier; meltevent++) {
-        for (int n = 0; n < Nuclei_ThisLayerSingle; n++) {
-            int NEvent = meltevent * Nuclei_ThisLayerSingle + n;
-            if (((NucleiY(NEvent) > MyYOffset) || (AtSouthBoundary)) &&
-                ((NucleiY(NEvent) < MyYOffset + MyYSlices - 1) || (AtNorthBoundary))) {
-                // Convert 3D location (using global X and Y coordinates) into a 1D location (using local X and Y
-                // coordinates) for the possible nucleation event, both as relative to the bottom of this layer as well
-                // as relative to the bottom of the overall domain
-                int NucleiLocation_ThisLayer =
-                    NucleiZ(NEvent) * nx * MyYSlices + NucleiX(NEvent) * MyYSlices + (NucleiY(NEvent) - MyYOffset);
-                int NucleiLocation_AllLayers = (NucleiZ(NEvent) + ZBound_Low) * nx * MyYSlices +
-                                               NucleiX(NEvent) * MyYSlices + (NucleiY(NEvent) - MyYOffset);
-                // Criteria for placing a nucleus - whether or not this nuclei is associated with a solidification event
-                if (meltevent < NumberOfSolidificationEvents_Host(NucleiLocation_ThisLayer)) {
-                    // Nucleation event is possible - cell undergoes solidification at least once, this nucleation
-                    // event is associated with one of the time periods during which the associated cell undergoes
-                    // solidification
-                    NucleiLocation_MyRank_V[PossibleNuclei_ThisRankThisLayer] = NucleiLocation_AllLayers;
-
-                    int CritTimeStep_ThisEvent = LayerTimeTempHistory_Host(NucleiLocation_ThisLayer, meltevent, 1);
-                    float UndercoolingChange_ThisEvent =
-                        LayerTimeTempHistory_Host(NucleiLocation_ThisLayer, meltevent, 2);
-                    int TimeToNucUnd = CritTimeStep_ThisEvent +
-                                       round(NucleiUndercooling_WholeDomain_V[NEvent] / UndercoolingChange_ThisEvent);
-                    NucleationTimes_MyRank_V[PossibleNuclei_ThisRankThisLayer] =
-                        std::max(CritTimeStep_ThisEvent, TimeToNucUnd);
-                    // Assign this cell the potential nucleated grain ID
-                    NucleiGrainID_MyRank_V[PossibleNuclei_ThisRankThisLayer] = NucleiGrainID_WholeDomain_V[NEvent];
-                    // Increment counter on this MPI rank
-                    PossibleNuclei_ThisRankThisLayer++;
+// Keep the potential nucleation events that may occur on this rank, in order of event index, assigning each its grain
+// ID. Returns the number of events kept
+int compactNucleiData(int Nuclei_ThisLayer, int Nuclei_PreviousLayers, ViewI NucleiLocation_AllNuclei,
+                      ViewI NucleationTimes_AllNuclei, ViewI &NucleiLocation, ViewI &NucleationTimes,
+                      ViewI &NucleiGrainID) {
+
+    int PossibleNuclei_ThisRankThisLayer = 0;
+    Kokkos::parallel_reduce(
+        "CountNuclei", Nuclei_ThisLayer,
+        KOKKOS_LAMBDA(const int NEvent, int &local_count) {
+            if (NucleiLocation_AllNuclei(NEvent) != -1)
+                local_count++;
+        },
+        PossibleNuclei_ThisRankThisLayer);
+    Kokkos::realloc(NucleiLocation, PossibleNuclei_ThisRankThisLayer);
+    Kokkos::realloc(NucleationTimes, PossibleNuclei_ThisRankThisLayer);
+    Kokkos::realloc(NucleiGrainID, PossibleNuclei_ThisRankThisLayer);
+    Kokkos::parallel_scan(
+        "CompactNuclei", Nuclei_ThisLayer, KOKKOS_LAMBDA(const int NEvent, int &update, const bool final) {
+            if (NucleiLocation_AllNuclei(NEvent) != -1) {
+                if (final) {
+                    NucleiLocation(update) = NucleiLocation_AllNuclei(NEvent);
+                    NucleationTimes(update) = NucleationTimes_AllNuclei(NEvent);
+                    // Negative values used for nucleated grains, avoiding grain ID 0 and grain IDs from previous
+                    // layers
+                    NucleiGrainID(update) = -(Nuclei_PreviousLayers + NEvent + 1);
                 }
+                update++;
             }
-        }
-    }
+        });
+    return PossibleNuclei_ThisRankThisLayer;
+}
+
+// Sort nucleation events from low to high by the time step at which they may occur, keeping the time steps paired with
+// the corresponding locations and grain IDs
+void sortNucleiData(int PossibleNuclei_ThisRankThisLayer, ViewI NucleiLocation, ViewI NucleationTimes,
+                    ViewI NucleiGrainID) {
+
+    if (PossibleNuclei_ThisRankThisLayer < 2)
+        return;
+    Kokkos::MinMaxScalar<int> NucleationTimeRange;
+    Kokkos::parallel_reduce(
+        "NucleationTimeRange", PossibleNuclei_ThisRankThisLayer,
+        KOKKOS_LAMBDA(const int n, Kokkos::MinMaxScalar<int> &local_range) {
+            if (NucleationTimes(n) < local_range.min_val)
+                local_range.min_val = NucleationTimes(n);
+            if (NucleationTimes(n) > local_range.max_val)
+                local_range.max_val = NucleationTimes(n);
+        },
+        Kokkos::MinMax<int>(NucleationTimeRange));
+    // Nothing to sort if all events occur at the same time step
+    if (NucleationTimeRange.min_val == NucleationTimeRange.max_val)
+        return;
+    using BinOp = Kokkos::BinOp1D<ViewI>;
+    BinOp Binning(PossibleNuclei_ThisRankThisLayer / 2, NucleationTimeRange.min_val, NucleationTimeRange.max_val);
+    // Events sharing a bin are sorted within it, as a bin can span multiple time steps
+    Kokkos::BinSort<ViewI, BinOp> Sorter(NucleationTimes, Binning, true);
+    Sorter.create_permute_vector();
+    Sorter.sort(NucleiLocation);
+    Sorter.sort(NucleiGrainID);
+    Sorter.sort(NucleationTimes);
 }
 
 // Initialize nucleation site locations, GrainID values, and time at which nucleation events will potentially occur
 // Modified to include multiple possible nucleation events in cells that melt and solidify multiple times
 void NucleiInit(int layernumber, double RNGSeed, int MyYSlices, int MyYOffset, int nx, int ny, int nzActive,
-                int ZBound_Low, int id, double NMax, double dTN, double dTsigma, double deltax, ViewI &NucleiLocation,
-                ViewI_H &NucleationTimes_Host, ViewI &NucleiGrainID, ViewI CellType, ViewI CritTimeStep,
-                ViewF UndercoolingChange, ViewI LayerID, int &PossibleNuclei_ThisRankThisLayer, int &Nuclei_WholeDomain,
-                bool AtNorthBoundary, bool AtSouthBoundary, bool RemeltingYN, int &NucleationCounter,
-                ViewI &MaxSolidificationEvents, ViewI NumberOfSolidificationEvents, ViewF3D LayerTimeTempHistory) {
-
-    // TODO: convert this subroutine into kokkos kernels, rather than copying data back to the host, and nucleation data
-    // back to the device again. This is currently performed on the device due to heavy usage of standard library
-    // algorithm functions
-    // Copy temperature data into temporary host views for this subroutine
-    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
-    ViewI_H CellType_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CellType);
-    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
-    ViewF_H UndercoolingChange_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange);
-    ViewI_H MaxSolidificationEvents_Host =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
-    ViewI_H NumberOfSolidificationEvents_Host =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NumberOfSolidificationEvents);
-    ViewF3D_H LayerTimeTempHistory_Host =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory);
+                int ZBound_Low, int XBound_Low, int nxActive, int YBound_Low, int nyActive, int id, double NMax,
+                double dTN, double dTsigma, double deltax, ViewI &NucleiLocation, ViewI_H &NucleationTimes_Host,
+                ViewI &NucleiGrainID, ViewI CellType, ViewI CritTimeStep, ViewF UndercoolingChange, ViewI LayerID,
+                int &PossibleNuclei_ThisRankThisLayer, int &Nuclei_WholeDomain, bool AtNorthBoundary,
+                bool AtSouthBoundary, bool RemeltingYN, int &NucleationCounter, ViewI &MaxSolidificationEvents,
+                ViewI NumberOfSolidificationEvents, ViewI SolidificationEventOffset, ViewF2D LayerTimeTempHistory,
+                const TemperatureEventStream &EventStream) {
 
     // Three counters tracked here:
     // Nuclei_WholeDomain - tracks all nuclei (regardless of whether an event would be possible based on the layer ID
@@ -2187,83 +2798,74 @@ void NucleiInit(int layernumber, double RNGSeed, int MyYSlices, int MyYOffset, i
     // matches this layer number). Starts at 0 each layer PossibleNuclei_AllRanksThisLayer - the subset of
     // Nuclei_ThisLayer that may possibly occur in the layer (nuclei locations are associated with a liquid cell with a
     // layer ID that matches this layer number). Starts at 0 each layer
-    PossibleNuclei_ThisRankThisLayer = 0;
     if (layernumber == 0)
         Nuclei_WholeDomain = 0;
 
     // Probability that a given liquid site will be a potential nucleus location
     double BulkProb = NMax * deltax * deltax * deltax;
 
-    // Use new RNG seed for each layer
-    std::mt19937_64 generator(RNGSeed + layernumber);
-    // Uniform distribution for nuclei location assignment
-    std::uniform_real_distribution<double> Xdist(-0.49999, nx - 0.5);
-    std::uniform_real_distribution<double> Ydist(-0.49999, ny - 0.5);
-    std::uniform_real_distribution<double> Zdist(-0.49999, nzActive - 0.5);
-    // Gaussian distribution of nucleation undercooling
-    std::normal_distribution<double> Gdistribution(dTN, dTsigma);
-
     // Max number of nucleated grains in this layer
     int Nuclei_ThisLayerSingle = BulkProb * (nx * ny * nzActive); // equivalent to Nuclei_ThisLayer if no remelting
     // Multiplier for the number of nucleation events per layer, based on the number of solidification events
     int NucleiMultiplier;
-    if (RemeltingYN)
+    if (RemeltingYN) {
+        ViewI_H MaxSolidificationEvents_Host =
+            Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
         NucleiMultiplier = MaxSolidificationEvents_Host(layernumber);
+    }
     else
         NucleiMultiplier = 1;
     int Nuclei_ThisLayer = Nuclei_ThisLayerSingle * NucleiMultiplier;
-    // Temporary vectors for storing nucleated grain IDs and undercooling values
-    // Nuclei Grain ID are assigned to avoid reusing values from previous layers
-    std::vector<int> NucleiGrainID_WholeDomain_V(Nuclei_ThisLayer);
-    std::vector<double> NucleiUndercooling_WholeDomain_V(Nuclei_ThisLayer);
-    // Views for storing potential nucleated grain coordinates
-    ViewI_H NucleiX(Kokkos::ViewAllocateWithoutInitializing("NucleiX"), Nuclei_ThisLayer);
-    ViewI_H NucleiY(Kokkos::ViewAllocateWithoutInitializing("NucleiY"), Nuclei_ThisLayer);
-    ViewI_H NucleiZ(Kokkos::ViewAllocateWithoutInitializing("NucleiZ"), Nuclei_ThisLayer);
-    for (int meltevent = 0; meltevent < NucleiMultiplier; meltevent++) {
-        for (int n = 0; n < Nuclei_ThisLayerSingle; n++) {
-            int NEvent = meltevent * Nuclei_ThisLayerSingle + n;
-            // Generate possible nuclei locations
-            double NucleiX_unrounded = Xdist(generator);
-            double NucleiY_unrounded = Ydist(generator);
-            double NucleiZ_unrounded = Zdist(generator);
-            // Round these coordinates so they're associated with a specific cell on the grid
-            NucleiX(NEvent) = std::round(NucleiX_unrounded);
-            NucleiY(NEvent) = std::round(NucleiY_unrounded);
-            NucleiZ(NEvent) = std::round(NucleiZ_unrounded);
-            // Assign each nuclei a Grain ID (negative values used for nucleated grains) and an undercooling
-            NucleiGrainID_WholeDomain_V[NEvent] = -(Nuclei_WholeDomain + NEvent + 1); // avoid using grain ID 0
-            NucleiUndercooling_WholeDomain_V[NEvent] = Gdistribution(generator);
-        }
-    }
-    // Shuffle these vectors to make sure the same grain IDs and undercooling don't end up in the same spots each layer
-    std::shuffle(NucleiGrainID_WholeDomain_V.begin(), NucleiGrainID_WholeDomain_V.end(), generator);
-    std::shuffle(NucleiUndercooling_WholeDomain_V.begin(), NucleiUndercooling_WholeDomain_V.end(), generator);
     if ((id == 0) && (Nuclei_ThisLayer > 0))
         std::cout << "Range of Grain IDs from which layer " << layernumber
                   << " nucleation events were selected: " << Nuclei_WholeDomain + 1 << " through "
                   << Nuclei_WholeDomain + Nuclei_ThisLayer << std::endl;
-    // Update number of nuclei counter for whole domain based on the number of nuclei in this layer
-    Nuclei_WholeDomain += Nuclei_ThisLayer;
+
+    // Use a new random number stream for each layer. Each potential nucleation event is drawn independently of the
+    // others, so the same events are drawn on all MPI ranks
+    NucleiSampler Sampler(RNGSeed, layernumber, nx, ny, nzActive, dTN, dTsigma);
 
     // Loop through nuclei for this layer - each MPI rank storing the nucleation events that are possible (i.e,
     // nucleation event is associated with a CA cell on that MPI rank's subdomain, the cell is liquid type, and the cell
-    // is associated with the current layer of the multilayer problem) Don't put nuclei in "ghost" cells - those
-    // nucleation events occur on other ranks and the existing halo exchange functionality will handle this
-    std::vector<int> NucleiGrainID_MyRank_V(Nuclei_ThisLayer), NucleiLocation_MyRank_V(Nuclei_ThisLayer),
-        NucleationTimes_MyRank_V(Nuclei_ThisLayer);
-    if (RemeltingYN)
-        placeNucleiData_Remelt(NucleiMultiplier, Nuclei_ThisLayerSingle, NucleiX, NucleiY, NucleiZ, MyYOffset, nx,
-                               MyYSlices, AtNorthBoundary, AtSouthBoundary, ZBound_Low,
-                               NumberOfSolidificationEvents_Host, LayerTimeTempHistory_Host,
-                               NucleiGrainID_WholeDomain_V, NucleiUndercooling_WholeDomain_V, NucleiGrainID_MyRank_V,
-                               NucleiLocation_MyRank_V, NucleationTimes_MyRank_V, PossibleNuclei_ThisRankThisLayer);
+    // is associated with the current layer of the multilayer problem)
+    ViewI NucleiLocation_AllNuclei(Kokkos::ViewAllocateWithoutInitializing("NucleiLocation_AllNuclei"),
+                                   Nuclei_ThisLayer);
+    ViewI NucleationTimes_AllNuclei(Kokkos::ViewAllocateWithoutInitializing("NucleationTimes_AllNuclei"),
+                                    Nuclei_ThisLayer);
+    if ((RemeltingYN) && (EventStream.streaming())) {
+        // If solidification events are streamed, all of the layer's events are only stored on the host
+        ViewI_H NucleiLocation_AllNuclei_Host = Kokkos::create_mirror_view(NucleiLocation_AllNuclei);
+        ViewI_H NucleationTimes_AllNuclei_Host = Kokkos::create_mirror_view(NucleationTimes_AllNuclei);
+        placeNucleiData_Remelt<Kokkos::DefaultHostExecutionSpace>(
+            Sampler, Nuclei_ThisLayerSingle, Nuclei_ThisLayer, MyYOffset, nx, MyYSlices, AtNorthBoundary,
+            AtSouthBoundary, ZBound_Low, XBound_Low, nxActive, YBound_Low, nyActive,
+            EventStream.NumberOfSolidificationEvents_Host, EventStream.SolidificationEventOffset_Host,
+            EventStream.LayerTimeTempHistory_Host, NucleiLocation_AllNuclei_Host, NucleationTimes_AllNuclei_Host);
+        Kokkos::deep_copy(NucleiLocation_AllNuclei, NucleiLocation_AllNuclei_Host);
+        Kokkos::deep_copy(NucleationTimes_AllNuclei, NucleationTimes_AllNuclei_Host);
+    }
+    else if (RemeltingYN)
+        placeNucleiData_Remelt<exe_space>(Sampler, Nuclei_ThisLayerSingle, Nuclei_ThisLayer, MyYOffset, nx,
+                                          MyYSlices, AtNorthBoundary, AtSouthBoundary, ZBound_Low, XBound_Low,
+                                          nxActive, YBound_Low, nyActive, NumberOfSolidificationEvents,
+                                          SolidificationEventOffset, LayerTimeTempHistory, NucleiLocation_AllNuclei,
+                                          NucleationTimes_AllNuclei);
     else
-        placeNucleiData_NoRemelt(Nuclei_ThisLayerSingle, NucleiX, NucleiY, NucleiZ, MyYOffset, nx, MyYSlices,
-                                 AtNorthBoundary, AtSouthBoundary, ZBound_Low, CellType_Host, LayerID_Host,
-                                 CritTimeStep_Host, UndercoolingChange_Host, layernumber, NucleiGrainID_WholeDomain_V,
-                                 NucleiUndercooling_WholeDomain_V, NucleiGrainID_MyRank_V, NucleiLocation_MyRank_V,
-                                 NucleationTimes_MyRank_V, PossibleNuclei_ThisRankThisLayer);
+        placeNucleiData_NoRemelt(Sampler, Nuclei_ThisLayer, MyYOffset, nx, MyYSlices, AtNorthBoundary,
+                                 AtSouthBoundary, ZBound_Low, layernumber, CellType, LayerID, CritTimeStep,
+                                 UndercoolingChange, NucleiLocation_AllNuclei, NucleationTimes_AllNuclei);
+
+    // Keep the nucleation events that are possible on this rank, and sort them by the time step at which they may occur
+    ViewI NucleationTimes;
+    PossibleNuclei_ThisRankThisLayer =
+        compactNucleiData(Nuclei_ThisLayer, Nuclei_WholeDomain, NucleiLocation_AllNuclei, NucleationTimes_AllNuclei,
+                          NucleiLocation, NucleationTimes, NucleiGrainID);
+    sortNucleiData(PossibleNuclei_ThisRankThisLayer, NucleiLocation, NucleationTimes, NucleiGrainID);
+    // NucleationTimes are stored using a host view that is passed to Nucleation subroutine
+    NucleationTimes_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NucleationTimes);
+
+    // Update number of nuclei counter for whole domain based on the number of nuclei in this layer
+    Nuclei_WholeDomain += Nuclei_ThisLayer;
 
     // How many nucleation events are actually possible (associated with a cell in this layer that will undergo
     // solidification)?
@@ -2274,44 +2876,6 @@ void NucleiInit(int layernumber, double RNGSeed, int MyYSlices, int MyYOffset, i
         std::cout << "Number of potential nucleation events in layer " << layernumber << " : "
                   << PossibleNuclei_AllRanksThisLayer << std::endl;
 
-    // Now that the number of nucleation events on each rank is known, resize these vectors
-    NucleiLocation_MyRank_V.resize(PossibleNuclei_ThisRankThisLayer);
-    NucleiGrainID_MyRank_V.resize(PossibleNuclei_ThisRankThisLayer);
-    NucleationTimes_MyRank_V.resize(PossibleNuclei_ThisRankThisLayer);
-
-    // Sort the list of time steps at which nucleation occurs, keeping the time steps paired with the corresponding
-    // locations for nucleation events and grain IDs
-    std::vector<std::tuple<int, int, int>> NucleationTimeLocID;
-    NucleationTimeLocID.reserve(PossibleNuclei_ThisRankThisLayer);
-    for (int n = 0; n < PossibleNuclei_ThisRankThisLayer; n++) {
-        NucleationTimeLocID.push_back(
-            std::make_tuple(NucleationTimes_MyRank_V[n], NucleiLocation_MyRank_V[n], NucleiGrainID_MyRank_V[n]));
-    }
-    // Sorting from low to high
-    std::sort(NucleationTimeLocID.begin(), NucleationTimeLocID.end());
-
-    // With PossibleNuclei_ThisRankThisLayer now known, resize views appropriately
-    // Resize nucleation views now that PossibleNuclei_ThisRank is known for all MPI ranks
-    Kokkos::resize(NucleationTimes_Host, PossibleNuclei_ThisRankThisLayer);
-    Kokkos::resize(NucleiLocation, PossibleNuclei_ThisRankThisLayer);
-    Kokkos::resize(NucleiGrainID, PossibleNuclei_ThisRankThisLayer);
-
-    // Create temporary view to store nucleation locations, grain ID data initialized on the host
-    // NucleationTimes_H are stored using a host view that is passed to Nucleation subroutine and later used - don't
-    // need a temporary host view
-    ViewI_H NucleiLocation_Host(Kokkos::ViewAllocateWithoutInitializing("NucleiLocation_Host"),
-                                PossibleNuclei_ThisRankThisLayer);
-    ViewI_H NucleiGrainID_Host(Kokkos::ViewAllocateWithoutInitializing("NucleiGrainID_Host"),
-                               PossibleNuclei_ThisRankThisLayer);
-    for (int n = 0; n < PossibleNuclei_ThisRankThisLayer; n++) {
-        NucleationTimes_Host(n) = std::get<0>(NucleationTimeLocID[n]);
-        NucleiLocation_Host(n) = std::get<1>(NucleationTimeLocID[n]);
-        NucleiGrainID_Host(n) = std::get<2>(NucleationTimeLocID[n]);
-    }
-    // Copy nucleation data to the device
-    NucleiLocation = Kokkos::create_mirror_view_and_copy(device_memory_space(), NucleiLocation_Host);
-    NucleiGrainID = Kokkos::create_mirror_view_and_copy(device_memory_space(), NucleiGrainID_Host);
-
     // Initialize counter for the layer to 0
     NucleationCounter = 0;
 
@@ -6,13 +6,58 @@
 #ifndef EXACA_INIT_HPP
 #define EXACA_INIT_HPP
 
+#include "CArandom.hpp"
+#include "CAtempcoupling.hpp"
+#include "CAtempdata.hpp"
+#include "CAtempprovider.hpp"
+#include "CAtempstream.hpp"
 #include "CAtypes.hpp"
 
 #include <Kokkos_Core.hpp>
 
+#include "mpi.h"
+
+#include <algorithm>
 #include <string>
 #include <vector>
 
+// Potential nucleation events for a layer, each drawn from the layer's nuclei random number stream using the event
+// index, so that a given event has the same location and undercooling on every MPI rank regardless of the order in
+// which events are drawn
+struct NucleiSampler {
+    CounterRNG RNG;
+    int nx = 0;
+    int ny = 0;
+    int nzActive = 0;
+    double dTN = 0.0;
+    double dTsigma = 0.0;
+
+    NucleiSampler() = default;
+    NucleiSampler(double RNGSeed, int layernumber, int nx_, int ny_, int nzActive_, double dTN_, double dTsigma_)
+        : RNG(RNGSeed, NucleiStream, layernumber)
+        , nx(nx_)
+        , ny(ny_)
+        , nzActive(nzActive_)
+        , dTN(dTN_)
+        , dTsigma(dTsigma_) {}
+
+    // Y coordinate (relative to the whole domain) of potential nucleation event NEvent, which can be drawn on its own
+    // to find which MPI rank the event is on
+    KOKKOS_INLINE_FUNCTION int getNucleusY(int NEvent) const { return RNG.uniformInt(NEvent, 1, ny); }
+
+    // Location (X and Y relative to the whole domain, Z relative to the bottom of the layer) and nucleation
+    // undercooling of potential nucleation event NEvent
+    KOKKOS_INLINE_FUNCTION void getNucleus(int NEvent, int &NucleusX, int &NucleusY, int &NucleusZ,
+                                           double &NucleusUndercooling) const {
+        // Uniform distribution for nuclei location assignment
+        NucleusX = RNG.uniformInt(NEvent, 0, nx);
+        NucleusY = getNucleusY(NEvent);
+        NucleusZ = RNG.uniformInt(NEvent, 2, nzActive);
+        // Gaussian distribution of nucleation undercooling
+        NucleusUndercooling = RNG.normal(NEvent, 3, dTN, dTsigma);
+    }
+};
+
 void InputReadFromFile(int id, std::string InputFile, std::string &SimulationType, double &deltax, double &NMax,
                        double &dTN, double &dTsigma, std::string &OutputFile, std::string &GrainOrientationFile,
                        int &TempFilesInSeries, std::vector<std::string> &temp_paths, double &HT_deltax,
@@ -24,116 +69,401 @@ void InputReadFromFile(int id, std::string InputFile, std::string &SimulationTyp
                        int &NSpotsY, int &SpotOffset, int &SpotRadius, bool &PrintTimeSeries, int &TimeSeriesInc,
                        bool &PrintIdleTimeSeriesFrames, bool &PrintDefaultRVE, double &RNGSeed,
                        bool &BaseplateThroughPowder, double &PowderActiveFraction, int &RVESize,
-                       bool &LayerwiseTempRead, bool &PrintBinary);
+                       bool &LayerwiseTempRead, bool &PrintBinary, bool &FreezeSolidifiedCells,
+                       bool &RunLengthEncodeFrozen, int &TempReaderRanks, int &TempReuseMemory, int &TempEventWindow,
+                       RosenthalRasterProvider &Raster, const TemperatureCoupling &Coupling = TemperatureCoupling());
 void checkPowderOverflow(int nx, int ny, int LayerHeight, int NumberOfLayers, bool BaseplateThroughPowder,
                          double PowderDensity);
 void NeighborListInit(NList &NeighborX, NList &NeighborY, NList &NeighborZ);
-void FindXYZBounds(std::string SimulationType, int id, double &deltax, int &nx, int &ny, int &nz,
+bool checkTemperatureFileFormat(std::string tempfile_thislayer);
+void readTemperatureFile(std::string tempfile_thislayer, double HT_deltax, int LowerYBound, int UpperYBound,
+                         RawTemperatureData &RawData, bool HostParallel = true);
+void FindXYZBounds(std::string SimulationType, int id, int np, double &deltax, int &nx, int &ny, int &nz,
                    std::vector<std::string> &temp_paths, double &XMin, double &XMax, double &YMin, double &YMax,
                    double &ZMin, double &ZMax, int &LayerHeight, int NumberOfLayers, int TempFilesInSeries,
-                   double *ZMinLayer, double *ZMaxLayer, int SpotRadius);
+                   double *ZMinLayer, double *ZMaxLayer, int SpotRadius,
+                   const TemperatureCoupling &Coupling = TemperatureCoupling());
 void DomainDecomposition(int id, int np, int &MyYSlices, int &MyYOffset, int &NeighborRank_North,
                          int &NeighborRank_South, int &nx, int &ny, int &nz, long int &LocalDomainSize,
                          bool &AtNorthBoundary, bool &AtSouthBoundary);
-void ReadTemperatureData(int id, double &deltax, double HT_deltax, int &HTtoCAratio, int MyYSlices, int MyYOffset,
-                         double YMin, std::vector<std::string> &temp_paths, int NumberOfLayers, int TempFilesInSeries,
-                         unsigned int &NumberOfTemperatureDataPoints, std::vector<double> &RawData, int *FirstValue,
-                         int *LastValue, bool LayerwiseTempRead, int layernumber);
+void exchangeTemperatureData(int np, std::vector<std::vector<double>> &RankData, RawTemperatureData &RawData);
+void scatterTemperatureData(int id, int np, int NumReaderRanks, std::string tempfile_thislayer,
+                            std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds, RawTemperatureData &RawData,
+                            bool BinaryInputData);
+void scatterCoupledTemperatureData(int np, const TemperatureCoupling &Coupling, std::string tempfile_thislayer,
+                                   std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds,
+                                   RawTemperatureData &RawData);
+void calcTemperatureYBounds(int HTtoCAratio, int MyYSlices, int MyYOffset, int &LowerYBound, int &UpperYBound);
+void ReadTemperatureData(int id, int np, double &deltax, double HT_deltax, int &HTtoCAratio, int MyYSlices,
+                         int MyYOffset, double XMin, double YMin, double ZMin, std::vector<std::string> &temp_paths,
+                         int NumberOfLayers, int TempFilesInSeries, RawTemperatureData &RawData, int *FirstValue,
+                         int *LastValue, bool LayerwiseTempRead, int layernumber, int TempReaderRanks,
+                         const TemperatureCoupling &Coupling = TemperatureCoupling());
 int calcZBound_Low(std::string SimulationType, int LayerHeight, int layernumber, double *ZMinLayer, double ZMin,
                    double deltax);
 int calcZBound_High(std::string SimulationType, int SpotRadius, int LayerHeight, int layernumber, double ZMin,
                     double deltax, int nz, double *ZMaxLayer);
+int calcFrozenZ(std::string SimulationType, int SpotRadius, int LayerHeight, int layernumber, int NumberOfLayers,
+                double ZMin, double deltax, int nz, double *ZMinLayer, double *ZMaxLayer);
 int calcnzActive(int ZBound_Low, int ZBound_High, int id, int layernumber);
 int calcLocalActiveDomainSize(int nx, int MyYSlices, int nzActive);
+void calcActiveRegionBounds(std::string SimulationType, int id, int layernumber, int nx, int MyYSlices, int nzActive,
+                            int ZBound_Low, ViewI CritTimeStep, int &XBound_Low, int &nxActive, int &YBound_Low,
+                            int &nyActive);
+void TrimEventDataToActiveRegion(int nx, int MyYSlices, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                                 int nyActive, ViewF2D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
+                                 ViewI &SolidificationEventOffset, ViewI &SolidificationEventCounter);
 void TempInit_DirSolidification(double G, double R, int id, int &nx, int &MyYSlices, double deltax, double deltat,
                                 int nz, int LocalDomainSize, ViewI &CritTimeStep, ViewF &UndercoolingChange,
                                 ViewI &LayerID);
-int calcMaxSolidificationEventsSpot(int nx, int MyYSlices, int NumberOfSpots, int NSpotsX, int SpotRadius,
-                                    int SpotOffset, int MyYOffset);
+int calcSolidificationEventOffsets(int LocalActiveDomainSize, ViewI_H NumberOfSolidificationEvents_Host,
+                                   ViewI_H SolidificationEventOffset_Host);
+int calcSolidificationEventOffsets(int LocalActiveDomainSize, ViewI NumberOfSolidificationEvents,
+                                   ViewI SolidificationEventOffset);
 void OrientationInit(int id, int &NGrainOrientations, ViewF &ReadOrientationData, std::string GrainOrientationFile,
                      int ValsPerLine = 9);
 void TempInit_SpotRemelt(int layernumber, double G, double R, std::string, int id, int &nx, int &MyYSlices,
                          int &MyYOffset, double deltax, double deltat, int ZBound_Low, int nz,
                          int LocalActiveDomainSize, int LocalDomainSize, ViewI &CritTimeStep, ViewF &UndercoolingChange,
                          ViewF &UndercoolingCurrent, int LayerHeight, double FreezingRange, ViewI &LayerID, int NSpotsX,
-                         int NSpotsY, int SpotRadius, int SpotOffset, ViewF3D &LayerTimeTempHistory,
-                         ViewI &NumberOfSolidificationEvents, ViewI &MeltTimeStep, ViewI &MaxSolidificationEvents,
-                         ViewI &SolidificationEventCounter);
+                         int NSpotsY, int SpotRadius, int SpotOffset, ViewF2D &LayerTimeTempHistory,
+                         ViewI &NumberOfSolidificationEvents, ViewI &SolidificationEventOffset, ViewI &MeltTimeStep,
+                         ViewI &MaxSolidificationEvents, ViewI &SolidificationEventCounter);
 void TempInit_SpotNoRemelt(double G, double R, std::string SimulationType, int id, int &nx, int &MyYSlices,
                            int &MyYOffset, double deltax, double deltat, int nz, int LocalDomainSize,
                            ViewI &CritTimeStep, ViewF &UndercoolingChange, int LayerHeight, int NumberOfLayers,
                            double FreezingRange, ViewI &LayerID, int NSpotsX, int NSpotsY, int SpotRadius,
                            int SpotOffset);
-int getTempCoordX(int i, double XMin, double deltax, const std::vector<double> &RawData);
-int getTempCoordY(int i, double YMin, double deltax, const std::vector<double> &RawData);
-int getTempCoordZ(int i, double deltax, const std::vector<double> &RawData, int LayerHeight, int LayerCounter,
-                  double *ZMinLayer);
-double getTempCoordTM(int i, const std::vector<double> &RawData);
-double getTempCoordTL(int i, const std::vector<double> &RawData);
-double getTempCoordCR(int i, const std::vector<double> &RawData);
+void TempInit_RasterNoRemelt(const RosenthalRasterProvider &Raster, int id, int nx, int MyYSlices, int MyYOffset,
+                             int LocalDomainSize, ViewI &CritTimeStep, ViewF &UndercoolingChange, int LayerHeight,
+                             int NumberOfLayers, ViewI &LayerID);
+void TempInit_RasterRemelt(const RosenthalRasterProvider &Raster, int layernumber, int id, int nx, int MyYSlices,
+                           int MyYOffset, int ZBound_Low, int LocalActiveDomainSize, int LocalDomainSize,
+                           ViewI &CritTimeStep, ViewF &UndercoolingChange, ViewF &UndercoolingCurrent, ViewI &LayerID,
+                           ViewF2D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
+                           ViewI &SolidificationEventOffset, ViewI &MeltTimeStep, ViewI &MaxSolidificationEvents,
+                           ViewI &SolidificationEventCounter);
+int getTempCoordX(int i, const RawTemperatureData &RawData);
+int getTempCoordY(int i, const RawTemperatureData &RawData);
+int getTempCoordZ(int i, const RawTemperatureData &RawData, int LayerHeight, int LayerCounter, double *ZMinLayer);
+double getTempCoordTM(int i, const RawTemperatureData &RawData);
+double getTempCoordTL(int i, const RawTemperatureData &RawData);
+double getTempCoordCR(int i, const RawTemperatureData &RawData);
+// Interpolate the value at location k, i, j of a layer's temperature grid (nzT by nx by nyT, with Y varying fastest)
+// from the values at the surrounding heat transport grid points, which are spaced HTtoCAratio apart. If any of these
+// points has no data (a value of 0 or less), the value at k, i, j is returned unchanged
+KOKKOS_INLINE_FUNCTION double interpolateTempData(ViewD TempGridData, int k, int i, int j, int nzT, int nx, int nyT,
+                                                  int HTtoCAratio) {
+    if (HTtoCAratio == 1)
+        return TempGridData((k * nx + i) * nyT + j);
+    int LowZ = k - (k % HTtoCAratio);
+    int HighZ = LowZ + HTtoCAratio;
+    double FHighZ = (double)(k - LowZ) / (double)(HTtoCAratio);
+    double FLowZ = 1.0 - FHighZ;
+    if (HighZ > nzT - 1)
+        HighZ = LowZ;
+    int LowX = i - (i % HTtoCAratio);
+    int HighX = LowX + HTtoCAratio;
+    double FHighX = (double)(i - LowX) / (double)(HTtoCAratio);
+    double FLowX = 1.0 - FHighX;
+    if (HighX >= nx)
+        HighX = LowX;
+    int LowY = j - (j % HTtoCAratio);
+    int HighY = LowY + HTtoCAratio;
+    double FHighY = (float)(j - LowY) / (float)(HTtoCAratio);
+    double FLowY = 1.0 - FHighY;
+    if (HighY > nyT - 1)
+        HighY = LowY;
+    double Pt1 = TempGridData((LowZ * nx + LowX) * nyT + LowY);
+    double Pt2 = TempGridData((LowZ * nx + HighX) * nyT + LowY);
+    double Pt12 = FLowX * Pt1 + FHighX * Pt2;
+    double Pt3 = TempGridData((LowZ * nx + LowX) * nyT + HighY);
+    double Pt4 = TempGridData((LowZ * nx + HighX) * nyT + HighY);
+    double Pt34 = FLowX * Pt3 + FHighX * Pt4;
+    double Pt1234 = Pt12 * FLowY + Pt34 * FHighY;
+    double Pt5 = TempGridData((HighZ * nx + LowX) * nyT + LowY);
+    double Pt6 = TempGridData((HighZ * nx + HighX) * nyT + LowY);
+    double Pt56 = FLowX * Pt5 + FHighX * Pt6;
+    double Pt7 = TempGridData((HighZ * nx + LowX) * nyT + HighY);
+    double Pt8 = TempGridData((HighZ * nx + HighX) * nyT + HighY);
+    double Pt78 = FLowX * Pt7 + FHighX * Pt8;
+    double Pt5678 = Pt56 * FLowY + Pt78 * FHighY;
+    if ((Pt1 > 0) && (Pt2 > 0) && (Pt3 > 0) && (Pt4 > 0) && (Pt5 > 0) && (Pt6 > 0) && (Pt7 > 0) && (Pt8 > 0))
+        return Pt1234 * FLowZ + Pt5678 * FHighZ;
+    else
+        return TempGridData((k * nx + i) * nyT + j);
+}
+void placeLayerTempData_NoRemelt(int LayerCounter, int id, int nx, int MyYSlices, int MyYOffset, double deltax,
+                                 int HTtoCAratio, double deltat, double ZMin, double *ZMinLayer, double *ZMaxLayer,
+                                 int LayerHeight, int *FinishTimeStep, double FreezingRange, int *FirstValue,
+                                 int *LastValue, const RawTemperatureData &RawData, int ny, int InitZ_Low,
+                                 int InitZ_High, int FrozenZ, ViewI CritTimeStep, ViewF UndercoolingChange,
+                                 ViewI LayerID);
 void TempInit_ReadDataNoRemelt(int id, int &nx, int &MyYSlices, int &MyYOffset, double deltax, int HTtoCAratio,
                                double deltat, int nz, int LocalDomainSize, ViewI &CritTimeStep,
-                               ViewF &UndercoolingChange, double XMin, double YMin, double ZMin, double *ZMinLayer,
-                               double *ZMaxLayer, int LayerHeight, int NumberOfLayers, int *FinishTimeStep,
-                               double FreezingRange, ViewI &LayerID, int *FirstValue, int *LastValue,
-                               std::vector<double> RawData, int ny);
+                               ViewF &UndercoolingChange, double ZMin, double *ZMinLayer, double *ZMaxLayer,
+                               int LayerHeight, int NumberOfLayers, int *FinishTimeStep, double FreezingRange,
+                               ViewI &LayerID, int *FirstValue, int *LastValue, const RawTemperatureData &RawData,
+                               int ny);
+void TempInit_ReadDataNoRemelt_Layer(int layernumber, int id, int nx, int MyYSlices, int MyYOffset, double deltax,
+                                     int HTtoCAratio, double deltat, int nz, ViewI CritTimeStep,
+                                     ViewF UndercoolingChange, ViewI LayerID, double ZMin, double *ZMinLayer,
+                                     double *ZMaxLayer, int LayerHeight, int NumberOfLayers, int *FinishTimeStep,
+                                     double FreezingRange, int *FirstValue, int *LastValue,
+                                     const RawTemperatureData &RawData, int ny, int InitZ_Low, int InitZ_High,
+                                     int FrozenZ);
 void calcMaxSolidificationEventsR(int id, int layernumber, int TempFilesInSeries, ViewI_H MaxSolidificationEvents_Host,
-                                  int StartRange, int EndRange, std::vector<double> RawData, double XMin, double YMin,
-                                  double deltax, double *ZMinLayer, int LayerHeight, int nx, int MyYSlices,
-                                  int MyYOffset, int LocalActiveDomainSize);
+                                  int LocalActiveDomainSize, ViewI NumberOfSolidificationEvents);
 void TempInit_ReadDataRemelt(int layernumber, int id, int nx, int MyYSlices, int nz, int LocalActiveDomainSize,
                              int LocalDomainSize, int MyYOffset, double &deltax, double deltat, double FreezingRange,
-                             ViewF3D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
-                             ViewI &MaxSolidificationEvents, ViewI &MeltTimeStep, ViewI &CritTimeStep,
-                             ViewF &UndercoolingChange, ViewF &UndercoolingCurrent, double XMin, double YMin,
+                             ViewF2D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
+                             ViewI &SolidificationEventOffset, ViewI &MaxSolidificationEvents, ViewI &MeltTimeStep,
+                             ViewI &CritTimeStep, ViewF &UndercoolingChange, ViewF &UndercoolingCurrent,
                              double *ZMinLayer, int LayerHeight, int nzActive, int ZBound_Low, int *FinishTimeStep,
-                             ViewI &LayerID, int *FirstValue, int *LastValue, std::vector<double> RawData,
+                             ViewI &LayerID, int *FirstValue, int *LastValue, const RawTemperatureData &RawData,
                              ViewI &SolidificationEventCounter, int TempFilesInSeries);
+void TempInit_ReadDataRemelt_Streamed(int layernumber, int id, int nx, int MyYSlices, int LocalActiveDomainSize,
+                                      int LocalDomainSize, int MyYOffset, double deltat, double FreezingRange,
+                                      ViewI &NumberOfSolidificationEvents, ViewI &MaxSolidificationEvents,
+                                      ViewI &MeltTimeStep, ViewI &CritTimeStep, ViewF &UndercoolingChange,
+                                      ViewF &UndercoolingCurrent, double *ZMinLayer, int LayerHeight, int nzActive,
+                                      int ZBound_Low, int *FinishTimeStep, ViewI &LayerID, int *FirstValue,
+                                      int *LastValue, const RawTemperatureData &RawData,
+                                      ViewI &SolidificationEventCounter, int TempFilesInSeries,
+                                      TemperatureEventStream &EventStream);
 void SubstrateInit_ConstrainedGrowth(int id, double FractSurfaceSitesActive, int MyYSlices, int nx, int ny,
                                      int MyYOffset, NList NeighborX, NList NeighborY, NList NeighborZ,
                                      ViewF GrainUnitVector, int NGrainOrientations, ViewI CellType, ViewI GrainID,
                                      ViewF DiagonalLength, ViewF DOCenter, ViewF CritDiagonalLength, double RNGSeed,
                                      int np, Buffer2D BufferNorthSend, Buffer2D BufferSouthSend, int BufSizeX,
                                      bool AtNorthBoundary, bool AtSouthBoundary);
-void SubstrateInit_FromFile(std::string SubstrateFileName, int nz, int nx, int MyYSlices, int MyYOffset, int pid,
-                            ViewI &GrainID, int nzActive, bool BaseplateThroughPowder);
+bool checkSubstrateFileFormat(std::string SubstrateFileName);
+void readSubstrateFile_ASCII(std::string SubstrateFileName, int nx, int MyYSlices, int MyYOffset, int id,
+                             int BaseplateSizeZ, ViewI_H SubstrateGrainIDs);
+void readSubstrateFile_Binary(std::string SubstrateFileName, int nx, int ny, int MyYSlices, int MyYOffset,
+                              int BaseplateSizeZ, ViewI_H SubstrateGrainIDs);
+void SubstrateInit_FromFile(std::string SubstrateFileName, int nz, int nx, int ny, int MyYSlices, int MyYOffset, int id,
+                            ViewI GrainID, int nzActive, bool BaseplateThroughPowder);
+void assignVoronoiGrainIDs(int NumberOfCenters, ViewI CenterLocations, ViewI CenterGrainIDs, int nx, int ny, int SizeZ,
+                           int MyYSlices, int MyYOffset, ViewI GrainID);
 void BaseplateInit_FromGrainSpacing(float SubstrateGrainSpacing, int nx, int ny, double *ZMinLayer, double *ZMaxLayer,
                                     int MyYSlices, int MyYOffset, int id, double deltax, ViewI GrainID, double RNGSeed,
                                     int &NextLayer_FirstEpitaxialGrainID, int nz, double BaseplateThroughPowder);
 void PowderInit(int layernumber, int nx, int ny, int LayerHeight, double *ZMaxLayer, double ZMin, double deltax,
                 int MyYSlices, int MyYOffset, int id, ViewI GrainID, double RNGSeed,
-                int &NextLayer_FirstEpitaxialGrainID, double PowderActiveFraction);
-void CellTypeInit_Remelt(int nx, int MyYSlices, int LocalActiveDomainSize, ViewI CellType, ViewI CritTimeStep, int id,
+                int &NextLayer_FirstEpitaxialGrainID, double PowderActiveFraction, int FrozenZ);
+void CellTypeInit_Remelt(int nx, int MyYSlices, int nzActive, ViewI CellType, ViewI CritTimeStep, int id,
                          int ZBound_Low);
 void CellTypeInit_NoRemelt(int layernumber, int id, int np, int nx, int MyYSlices, int MyYOffset, int ZBound_Low,
-                           int nz, int LocalActiveDomainSize, int LocalDomainSize, ViewI CellType, ViewI CritTimeStep,
-                           NList NeighborX, NList NeighborY, NList NeighborZ, int NGrainOrientations,
-                           ViewF GrainUnitVector, ViewF DiagonalLength, ViewI GrainID, ViewF CritDiagonalLength,
-                           ViewF DOCenter, ViewI LayerID, Buffer2D BufferNorthSend, Buffer2D BufferSouthSend,
-                           int BufSizeX, bool AtNorthBoundary, bool AtSouthBoundary);
+                           int XBound_Low, int nxActive, int YBound_Low, int nyActive, int nz,
+                           int LocalActiveDomainSize, int InitZ_Low, int InitZ_High, ViewI CellType,
+                           ViewI CritTimeStep, NList NeighborX, NList NeighborY, NList NeighborZ,
+                           int NGrainOrientations, ViewF GrainUnitVector, ViewF DiagonalLength, ViewI GrainID,
+                           ViewF CritDiagonalLength, ViewF DOCenter, ViewI LayerID, Buffer2D BufferNorthSend,
+                           Buffer2D BufferSouthSend, int BufSizeX, bool AtNorthBoundary, bool AtSouthBoundary);
 void NucleiInit(int layernumber, double RNGSeed, int MyYSlices, int MyYOffset, int nx, int ny, int nzActive,
-                int ZBound_Low, int id, double NMax, double dTN, double dTsigma, double deltax, ViewI &NucleiLocation,
-                ViewI_H &NucleationTimes_Host, ViewI &NucleiGrainID, ViewI CellType, ViewI CritTimeStep,
-                ViewF UndercoolingChange, ViewI LayerID, int &PossibleNuclei_ThisRankThisLayer, int &Nuclei_WholeDomain,
-                bool AtNorthBoundary, bool AtSouthBoundary, bool RemeltingYN, int &NucleationCounter,
-                ViewI &MaxSolidificationEvents, ViewI NumberOfSolidificationEvents, ViewF3D LayerTimeTempHistory);
-void placeNucleiData_NoRemelt(int Nuclei_ThisLayerSingle, ViewI_H NucleiX, ViewI_H NucleiY, ViewI_H NucleiZ,
-                              int MyYOffset, int nx, int MyYSlices, bool AtNorthBoundary, bool AtSouthBoundary,
-                              int ZBound_Low, ViewI_H CellType_Host, ViewI_H LayerID_Host, ViewI_H CritTimeStep_Host,
-                              ViewF_H UndercoolingChange_Host, int layernumber,
-                              std::vector<int> NucleiGrainID_WholeDomain_V,
-                              std::vector<double> NucleiUndercooling_WholeDomain_V,
-                              std::vector<int> &NucleiGrainID_MyRank_V, std::vector<int> &NucleiLocation_MyRank_V,
-                              std::vector<int> &NucleationTimes_MyRank_V, int &PossibleNuclei_ThisRankThisLayer);
-void placeNucleiData_Remelt(int NucleiMultiplier, int Nuclei_ThisLayerSingle, ViewI_H NucleiX, ViewI_H NucleiY,
-                            ViewI_H NucleiZ, int MyYOffset, int nx, int MyYSlices, bool AtNorthBoundary,
-                            bool AtSouthBoundary, int ZBound_Low, ViewI_H NumberOfSolidificationEvents_Host,
-                            ViewF3D_H LayerTimeTempHistory_Host, std::vector<int> NucleiGrainID_WholeDomain_V,
-                            std::vector<double> NucleiUndercooling_WholeDomain_V,
-                            std::vector<int> &NucleiGrainID_MyRank_V, std::vector<int> &NucleiLocation_MyRank_V,
-                            std::vector<int> &NucleationTimes_MyRank_V, int &PossibleNuclei_ThisRankThisLayer);
+                int ZBound_Low, int XBound_Low, int nxActive, int YBound_Low, int nyActive, int id, double NMax,
+                double dTN, double dTsigma, double deltax, ViewI &NucleiLocation, ViewI_H &NucleationTimes_Host,
+                ViewI &NucleiGrainID, ViewI CellType, ViewI CritTimeStep, ViewF UndercoolingChange, ViewI LayerID,
+                int &PossibleNuclei_ThisRankThisLayer, int &Nuclei_WholeDomain, bool AtNorthBoundary,
+                bool AtSouthBoundary, bool RemeltingYN, int &NucleationCounter, ViewI &MaxSolidificationEvents,
+                ViewI NumberOfSolidificationEvents, ViewI SolidificationEventOffset, ViewF2D LayerTimeTempHistory,
+                const TemperatureEventStream &EventStream = TemperatureEventStream());
+void placeNucleiData_NoRemelt(const NucleiSampler &Sampler, int Nuclei_ThisLayer, int MyYOffset, int nx,
+                              int MyYSlices, bool AtNorthBoundary, bool AtSouthBoundary, int ZBound_Low,
+                              int layernumber, ViewI CellType, ViewI LayerID, ViewI CritTimeStep,
+                              ViewF UndercoolingChange, ViewI NucleiLocation_AllNuclei,
+                              ViewI NucleationTimes_AllNuclei);
+int compactNucleiData(int Nuclei_ThisLayer, int Nuclei_PreviousLayers, ViewI NucleiLocation_AllNuclei,
+                      ViewI NucleationTimes_AllNuclei, ViewI &NucleiLocation, ViewI &NucleationTimes,
+                      ViewI &NucleiGrainID);
+void sortNucleiData(int PossibleNuclei_ThisRankThisLayer, ViewI NucleiLocation, ViewI NucleationTimes,
+                    ViewI NucleiGrainID);
 void ZeroResetViews(int LocalActiveDomainSize, int BufSizeX, int BufSizeZ, ViewF &DiagonalLength,
                     ViewF &CritDiagonalLength, ViewF &DOCenter, Buffer2D &BufferNorthSend, Buffer2D &BufferSouthSend,
                     Buffer2D &BufferNorthRecv, Buffer2D &BufferSouthRecv, ViewI &SteeringVector);
 
+
+//*****************************************************************************/
+// Initialize temperature data for all cells from an analytic temperature provider (done during simulation
+// initialization, no remelting), for NumberOfLayers layers offset by LayerHeight cells, each spanning nzLayer cells in
+// Z. Each cell keeps the last time it goes below the liquidus during the last layer that melts it, and cells that never
+// melt have a LayerID of -1
+template <typename TemperatureProvider>
+void TempInit_ProviderNoRemelt(const TemperatureProvider &Provider, int nx, int MyYSlices, int MyYOffset,
+                               int LocalDomainSize, int NumberOfLayers, int LayerHeight, int nzLayer,
+                               ViewI &CritTimeStep, ViewF &UndercoolingChange, ViewI &LayerID) {
+
+    Kokkos::realloc(CritTimeStep, LocalDomainSize);
+    Kokkos::realloc(UndercoolingChange, LocalDomainSize);
+    Kokkos::realloc(LayerID, LocalDomainSize);
+    Kokkos::parallel_for(
+        "ProviderTempInit", LocalDomainSize, KOKKOS_LAMBDA(const int &GlobalD3D1ConvPosition) {
+            int GlobalZ = GlobalD3D1ConvPosition / (nx * MyYSlices);
+            int Rem = GlobalD3D1ConvPosition % (nx * MyYSlices);
+            int RankX = Rem / MyYSlices;
+            int GlobalY = Rem % MyYSlices + MyYOffset;
+            int CellLayerID = -1;
+            int MeltTimeStep = 0;
+            int CellCritTimeStep = 0;
+            float CellUndercoolingChange = 0.0;
+            // Later layers overwrite the data from earlier ones, so the layers are checked starting from the last
+            for (int layernumber = NumberOfLayers - 1; layernumber >= 0; layernumber--) {
+                int LayerZ = GlobalZ - LayerHeight * layernumber;
+                if ((LayerZ < 0) || (LayerZ >= nzLayer))
+                    continue;
+                int NumEvents = Provider.numEvents(RankX, GlobalY, LayerZ);
+                if (NumEvents > 0) {
+                    Provider.getEvent(RankX, GlobalY, LayerZ, NumEvents - 1, MeltTimeStep, CellCritTimeStep,
+                                      CellUndercoolingChange);
+                    CellLayerID = layernumber;
+                    break;
+                }
+            }
+            CritTimeStep(GlobalD3D1ConvPosition) = CellCritTimeStep;
+            UndercoolingChange(GlobalD3D1ConvPosition) = CellUndercoolingChange;
+            LayerID(GlobalD3D1ConvPosition) = CellLayerID;
+        });
+}
+
+// Initialize temperature data for layer "layernumber" from an analytic temperature provider (done at the start of
+// each layer, with remelting), for the LocalActiveDomainSize cells starting at Z = ZBound_Low. Returns the maximum
+// number of times a cell in the layer will solidify, on any rank
+template <typename TemperatureProvider>
+int TempInit_ProviderRemelt(const TemperatureProvider &Provider, int layernumber, int nx, int MyYSlices,
+                            int MyYOffset, int ZBound_Low, int LocalActiveDomainSize, int LocalDomainSize,
+                            ViewI &CritTimeStep, ViewF &UndercoolingChange, ViewF &UndercoolingCurrent,
+                            ViewI &LayerID, ViewF2D &LayerTimeTempHistory, ViewI &NumberOfSolidificationEvents,
+                            ViewI &SolidificationEventOffset, ViewI &MeltTimeStep, ViewI &MaxSolidificationEvents,
+                            ViewI &SolidificationEventCounter) {
+
+    if (layernumber == 0) {
+        // Only needs to be resized during initialization of the first layer, as LocalDomainSize is constant while
+        // LocalActiveDomainSize is not
+        Kokkos::resize(MeltTimeStep, LocalDomainSize);
+        // First layer - all LayerID values are -1, to later be populated with other values
+        Kokkos::deep_copy(LayerID, -1);
+    }
+
+    // Count the number of times each cell in layer "layernumber" will undergo melting/solidification
+    Kokkos::realloc(NumberOfSolidificationEvents, LocalActiveDomainSize);
+    int MaxEvents_ThisRank = 0;
+    Kokkos::parallel_reduce(
+        "ProviderCountSEvents", LocalActiveDomainSize,
+        KOKKOS_LAMBDA(const int &D3D1ConvPosition, int &LocalMaxEvents) {
+            int RankZ = D3D1ConvPosition / (nx * MyYSlices);
+            int Rem = D3D1ConvPosition % (nx * MyYSlices);
+            int NumEvents = Provider.numEvents(Rem / MyYSlices, Rem % MyYSlices + MyYOffset, RankZ);
+            NumberOfSolidificationEvents(D3D1ConvPosition) = NumEvents;
+            if (NumEvents > LocalMaxEvents)
+                LocalMaxEvents = NumEvents;
+        },
+        Kokkos::Max<int>(MaxEvents_ThisRank));
+    MaxEvents_ThisRank = std::max(MaxEvents_ThisRank, 0);
+    int MaxEvents;
+    MPI_Allreduce(&MaxEvents_ThisRank, &MaxEvents, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    Kokkos::deep_copy(Kokkos::subview(MaxSolidificationEvents, layernumber), MaxEvents);
+
+    // Each cell's solidification events are stored consecutively in LayerTimeTempHistory, starting at the position
+    // given by SolidificationEventOffset, and the cell's temperature fields are initialized using its first event
+    Kokkos::realloc(SolidificationEventOffset, LocalActiveDomainSize + 1);
+    int NumberOfEvents = calcSolidificationEventOffsets(LocalActiveDomainSize, NumberOfSolidificationEvents,
+                                                        SolidificationEventOffset);
+    Kokkos::realloc(LayerTimeTempHistory, NumberOfEvents, 3);
+    int GlobalOffset = ZBound_Low * nx * MyYSlices;
+    Kokkos::parallel_for(
+        "ProviderPlaceSEvents", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+            int RankZ = D3D1ConvPosition / (nx * MyYSlices);
+            int Rem = D3D1ConvPosition % (nx * MyYSlices);
+            int RankX = Rem / MyYSlices;
+            int GlobalY = Rem % MyYSlices + MyYOffset;
+            int GlobalD3D1ConvPosition = D3D1ConvPosition + GlobalOffset;
+            int FirstEvent = SolidificationEventOffset(D3D1ConvPosition);
+            int NumEvents = NumberOfSolidificationEvents(D3D1ConvPosition);
+            for (int n = 0; n < NumEvents; n++) {
+                int EventMeltTimeStep = 0;
+                int EventCritTimeStep = 0;
+                float EventUndercoolingChange = 0.0;
+                Provider.getEvent(RankX, GlobalY, RankZ, n, EventMeltTimeStep, EventCritTimeStep,
+                                  EventUndercoolingChange);
+                LayerTimeTempHistory(FirstEvent + n, 0) = EventMeltTimeStep;
+                LayerTimeTempHistory(FirstEvent + n, 1) = EventCritTimeStep;
+                LayerTimeTempHistory(FirstEvent + n, 2) = EventUndercoolingChange;
+            }
+            if (NumEvents > 0) {
+                MeltTimeStep(GlobalD3D1ConvPosition) = LayerTimeTempHistory(FirstEvent, 0);
+                CritTimeStep(GlobalD3D1ConvPosition) = LayerTimeTempHistory(FirstEvent, 1);
+                UndercoolingChange(GlobalD3D1ConvPosition) = LayerTimeTempHistory(FirstEvent, 2);
+                LayerID(GlobalD3D1ConvPosition) = layernumber;
+            }
+            else {
+                MeltTimeStep(GlobalD3D1ConvPosition) = 0;
+                CritTimeStep(GlobalD3D1ConvPosition) = 0;
+                UndercoolingChange(GlobalD3D1ConvPosition) = 0.0;
+            }
+        });
+
+    // Initial undercooling of all cells is 0, solidification event counter is 0 at the start of each layer
+    Kokkos::deep_copy(UndercoolingCurrent, 0.0);
+    Kokkos::realloc(SolidificationEventCounter, LocalActiveDomainSize);
+    Kokkos::deep_copy(SolidificationEventCounter, 0);
+    return MaxEvents;
+}
+
+//*****************************************************************************/
+// Determine which nuclei are located on a given MPI rank, and may possibly occur during simulation
+// For each of the layer's potential nucleation events, NucleiLocation_AllNuclei is set to the location of the
+// associated cell (or -1 if the event cannot occur on this rank) and NucleationTimes_AllNuclei to the time step at
+// which it may occur
+// Case with remelting (each cell can solidify multiple times, can be the home of multiple nucleation events). Events
+// are read from views in ExecutionSpace's memory space, as streamed solidification events are only all stored on the
+// host
+template <typename ExecutionSpace, typename ViewIType, typename ViewF2DType>
+void placeNucleiData_Remelt(const NucleiSampler &Sampler, int Nuclei_ThisLayerSingle, int Nuclei_ThisLayer,
+                            int MyYOffset, int nx, int MyYSlices, bool AtNorthBoundary, bool AtSouthBoundary,
+                            int ZBound_Low, int XBound_Low, int nxActive, int YBound_Low, int nyActive,
+                            ViewIType NumberOfSolidificationEvents, ViewIType SolidificationEventOffset,
+                            ViewF2DType LayerTimeTempHistory, ViewIType NucleiLocation_AllNuclei,
+                            ViewIType NucleationTimes_AllNuclei) {
+
+    Kokkos::parallel_for(
+        "PlaceNuclei_Remelt", Kokkos::RangePolicy<ExecutionSpace>(0, Nuclei_ThisLayer),
+        KOKKOS_LAMBDA(const int NEvent) {
+            // Each group of Nuclei_ThisLayerSingle events is associated with one solidification event per cell
+            int meltevent = NEvent / Nuclei_ThisLayerSingle;
+            NucleiLocation_AllNuclei(NEvent) = -1;
+            // Don't put nuclei in "ghost" cells - those nucleation events occur on other ranks. The rest of the event
+            // is only drawn if it is on this rank
+            int NucleusY = Sampler.getNucleusY(NEvent);
+            if (((NucleusY > MyYOffset) || (AtSouthBoundary)) &&
+                ((NucleusY < MyYOffset + MyYSlices - 1) || (AtNorthBoundary))) {
+                int NucleusX, NucleusZ;
+                double NucleusUndercooling;
+                Sampler.getNucleus(NEvent, NucleusX, NucleusY, NucleusZ, NucleusUndercooling);
+                // Cells outside of the active region never solidify this layer
+                int ActiveX = NucleusX - XBound_Low;
+                int ActiveY = NucleusY - MyYOffset - YBound_Low;
+                if ((ActiveX >= 0) && (ActiveX < nxActive) && (ActiveY >= 0) && (ActiveY < nyActive)) {
+                    // Convert 3D location (using global X and Y coordinates) into a 1D location for the possible
+                    // nucleation event, both as relative to the active region of this layer as well as relative to the
+                    // bottom of the overall domain
+                    int NucleiLocation_ThisLayer = NucleusZ * nxActive * nyActive + ActiveX * nyActive + ActiveY;
+                    // Criteria for placing a nucleus - whether or not this nuclei is associated with a solidification
+                    // event
+                    if (meltevent < NumberOfSolidificationEvents(NucleiLocation_ThisLayer)) {
+                        int ThisEvent = SolidificationEventOffset(NucleiLocation_ThisLayer) + meltevent;
+                        int CritTimeStep_ThisEvent = LayerTimeTempHistory(ThisEvent, 1);
+                        float UndercoolingChange_ThisEvent = LayerTimeTempHistory(ThisEvent, 2);
+                        int TimeToNucUnd =
+                            CritTimeStep_ThisEvent + round(NucleusUndercooling / UndercoolingChange_ThisEvent);
+                        NucleiLocation_AllNuclei(NEvent) =
+                            (NucleusZ + ZBound_Low) * nx * MyYSlices + NucleusX * MyYSlices + (NucleusY - MyYOffset);
+                        NucleationTimes_AllNuclei(NEvent) =
+                            (TimeToNucUnd > CritTimeStep_ThisEvent) ? TimeToNucUnd : CritTimeStep_ThisEvent;
+                    }
+                }
+            }
+        });
+}
+
 #endif
@@ -11,12 +11,25 @@
 #include "mpi.h"
 
 #include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <regex>
 
+#include <fcntl.h>
+#include <locale.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // Functions that are used to simplify the parsing of input files, either by ExaCA or related utilities
 
 //*****************************************************************************/
@@ -220,7 +233,8 @@ void checkFileNotEmpty(std::string testfilename) {
 
 void parseTInstuctionsFile(int id, const std::string TFieldInstructions, int &TempFilesInSeries, int &NumberOfLayers,
                            int &LayerHeight, double deltax, double &HT_deltax, std::vector<std::string> &temp_paths,
-                           bool &RemeltingYN, bool &LayerwiseTempRead) {
+                           bool &RemeltingYN, bool &LayerwiseTempRead, int &TempReaderRanks, int &TempReuseMemory,
+                           int &TempEventWindow) {
 
     std::ifstream TemperatureData;
     // Check that file exists and contains data
@@ -238,6 +252,9 @@ void parseTInstuctionsFile(int id, const std::string TFieldInstructions, int &Te
     std::vector<std::string> OptionalTemperatureInputs = {
         "Discard temperature data and reread temperature files after each layer",
         "Heat transport data mesh size",
+        "Number of MPI ranks reading temperature data",
+        "Memory for reusing temperature data",
+        "Time steps per window of streamed solidification events",
     };
     int NumRequiredTemperatureInputs = RequiredTemperatureInputs.size();
     int NumOptionalTemperatureInputs = OptionalTemperatureInputs.size();
@@ -279,14 +296,38 @@ void parseTInstuctionsFile(int id, const std::string TFieldInstructions, int &Te
         HT_deltax = deltax;
     else
         HT_deltax = getInputDouble(OptionalTemperatureInputsRead[1], -6);
-
-    if ((!(RemeltingYN)) && (LayerwiseTempRead)) {
-        if (id == 0)
-            std::cout << "Warning: ability to read temperature files one at a time during initialization of "
-                         "new layers is only supported for simulations with remelting"
-                      << std::endl;
-        LayerwiseTempRead = false;
+    // If this input was not given, default to each rank reading the temperature files and keeping its own data
+    if (OptionalTemperatureInputsRead[2].empty())
+        TempReaderRanks = 0;
+    else {
+        TempReaderRanks = getInputInt(OptionalTemperatureInputsRead[2]);
+        if (TempReaderRanks < 0)
+            throw std::runtime_error("Error: Number of MPI ranks reading temperature data must be 0 or larger");
+    }
+    // If this input was not given, default to rereading temperature files for each layer that uses them
+    if (OptionalTemperatureInputsRead[3].empty())
+        TempReuseMemory = 0;
+    else {
+        TempReuseMemory = getInputInt(OptionalTemperatureInputsRead[3]);
+        if (TempReuseMemory < 0)
+            throw std::runtime_error("Error: Memory for reusing temperature data must be 0 or larger");
+    }
+    // If this input was not given, default to loading all of a layer's solidification events before the layer starts
+    if (OptionalTemperatureInputsRead[4].empty())
+        TempEventWindow = 0;
+    else {
+        TempEventWindow = getInputInt(OptionalTemperatureInputsRead[4]);
+        if (TempEventWindow < 0)
+            throw std::runtime_error("Error: Time steps per window of streamed solidification events must be 0 or "
+                                     "larger");
     }
+
+    if ((!(RemeltingYN)) && (LayerwiseTempRead) && (id == 0))
+        std::cout << "Note: without remelting, temperature files are all read during initialization, but temperature "
+                     "fields will only be initialized for each layer's cells once that layer starts"
+                  << std::endl;
+    if ((!(RemeltingYN)) && (TempEventWindow > 0) && (id == 0))
+        std::cout << "Note: solidification events are only streamed for simulations with remelting" << std::endl;
     // Read second part of file to get the paths/names of the temperature data files used
     TempFilesInSeries = 0;
     while (TemperatureData.is_open()) {
@@ -320,156 +361,346 @@ std::string parseCoordinatePair(std::string line, int val) {
     return SplitStr;
 }
 
-// Read x, y, z coordinates in tempfile_thislayer (temperature file in either an ASCII or binary format) and return the
-// min and max values
-std::array<double, 6> parseTemperatureCoordinateMinMax(std::string tempfile_thislayer, bool BinaryInputData) {
-
-    std::array<double, 6> XYZMinMax;
-    std::ifstream TemperatureFilestream;
-    TemperatureFilestream.open(tempfile_thislayer);
+// Position TemperatureFilestream (opened in binary mode) at the first data point in part "Part" of "NumParts" roughly
+// equal parts of a temperature file, returning the position in bytes at which the part ends. For ASCII files, the file
+// is split by byte range and each part holds the lines that start within its range; the header line, which is checked
+// for the required column names, is not part of any range. For binary files, each part holds a range of the 6 value
+// data points
+long int seekTemperatureFilePart(std::ifstream &TemperatureFilestream, bool BinaryInputData, int Part, int NumParts) {
+
+    TemperatureFilestream.seekg(0, std::ios::end);
+    long int FileSize = TemperatureFilestream.tellg();
+    TemperatureFilestream.seekg(0, std::ios::beg);
+    long int PartStart, PartEnd;
+    if (BinaryInputData) {
+        long int DataPointSize = 6 * sizeof(double);
+        long int NumDataPoints = FileSize / DataPointSize;
+        PartStart = DataPointSize * (NumDataPoints * Part / NumParts);
+        PartEnd = DataPointSize * (NumDataPoints * (Part + 1) / NumParts);
+        TemperatureFilestream.seekg(PartStart, std::ios::beg);
+    }
+    else {
+        PartStart = FileSize * Part / NumParts;
+        PartEnd = FileSize * (Part + 1) / NumParts;
+        std::string ReadLine;
+        if (Part == 0) {
+            // Read the header line data
+            // Make sure the first line contains all required column names: x, y, z, tm, tl, cr
+            getline(TemperatureFilestream, ReadLine);
+            checkForHeaderValues(ReadLine);
+        }
+        else if (PartStart < PartEnd) {
+            // Skip the remainder of the line that starts before this part's byte range, if any
+            TemperatureFilestream.seekg(PartStart - 1, std::ios::beg);
+            if (TemperatureFilestream.get() != '\n')
+                getline(TemperatureFilestream, ReadLine);
+        }
+        else
+            TemperatureFilestream.seekg(PartEnd, std::ios::beg);
+    }
+    return PartEnd;
+}
 
-    if (!(BinaryInputData)) {
-        // Read the header line data
-        // Make sure the first line contains all required column names: x, y, z, tm, tl, cr
-        std::string HeaderLine;
-        getline(TemperatureFilestream, HeaderLine);
-        checkForHeaderValues(HeaderLine);
+// Parse the x, y, z, tm, tl, cr values from a line of an ASCII temperature file, LineStart through LineEnd - 1 (not
+// including the newline), into XYZTemperaturePoint. The line must be followed by a newline or a null character. Values
+// are separated by commas, and only whitespace may follow the last value. Returns an error message, or an empty string
+// if the line was parsed
+std::string parseTemperatureDataLine(const char *LineStart, const char *LineEnd,
+                                     std::array<double, 6> &XYZTemperaturePoint) {
+
+    // Make sure the right number of values are present on the line
+    int NumValues = std::count(LineStart, LineEnd, ',') + 1;
+    if (NumValues != 6)
+        return "Error: Expected 6 values while reading file; but " + std::to_string(NumValues) + " were found";
+    // Values are parsed using the "C" locale, created once, so that the decimal separator is always '.' regardless of
+    // the global locale
+    static const locale_t TemperatureDataLocale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+    const char *ValueStart = LineStart;
+    for (int component = 0; component < 6; component++) {
+        char *ValueEnd;
+        XYZTemperaturePoint[component] = strtod_l(ValueStart, &ValueEnd, TemperatureDataLocale);
+        // A value should have been read, without skipping past the end of the line
+        bool ValidValue = (ValueEnd != ValueStart) && (ValueEnd <= LineEnd);
+        while ((ValueEnd < LineEnd) && (std::isspace(static_cast<unsigned char>(*ValueEnd))))
+            ValueEnd++;
+        // Each value but the last should be followed by a comma, and the last by the end of the line
+        if (component < 5)
+            ValidValue = ValidValue && (ValueEnd < LineEnd) && (*ValueEnd == ',');
+        else
+            ValidValue = ValidValue && (ValueEnd == LineEnd);
+        if (!(ValidValue))
+            return "Error: Could not parse temperature data line " + std::string(LineStart, LineEnd);
+        ValueStart = ValueEnd + 1;
     }
+    return "";
+}
+
+// Read the next data point (x, y, z, tm, tl, cr values) from TemperatureFilestream into XYZTemperaturePoint, returning
+// the number of bytes read or 0 if no data was left
+long int readTemperatureDataPoint(std::ifstream &TemperatureFilestream, bool BinaryInputData,
+                                  std::array<double, 6> &XYZTemperaturePoint) {
 
-    // Units are assumed to be in meters, meters, seconds, seconds, and K/second
-    int XYZPointCount_Estimate = 1000000;
-    std::vector<double> XCoordinates(XYZPointCount_Estimate), YCoordinates(XYZPointCount_Estimate),
-        ZCoordinates(XYZPointCount_Estimate);
-    long unsigned int XYZPointCounter = 0;
     if (BinaryInputData) {
-        while (!TemperatureFilestream.eof()) {
-            // Get x from the binary string, or, if no data is left, exit the file read
-            double XValue = ReadBinaryData<double>(TemperatureFilestream);
-            if (!(TemperatureFilestream))
-                break;
-            // Store the x value that was read, and parse the y and z values
-            XCoordinates[XYZPointCounter] = XValue;
-            YCoordinates[XYZPointCounter] = ReadBinaryData<double>(TemperatureFilestream);
-            ZCoordinates[XYZPointCounter] = ReadBinaryData<double>(TemperatureFilestream);
-            // Ignore the tm, tl, cr values associated with this x, y, z
-            unsigned char temp[3 * sizeof(double)];
-            TemperatureFilestream.read(reinterpret_cast<char *>(temp), 3 * sizeof(double));
-            XYZPointCounter++;
-            if (XYZPointCounter == XCoordinates.size()) {
-                XCoordinates.resize(XYZPointCounter + XYZPointCount_Estimate);
-                YCoordinates.resize(XYZPointCounter + XYZPointCount_Estimate);
-                ZCoordinates.resize(XYZPointCounter + XYZPointCount_Estimate);
-            }
-        }
+        for (int component = 0; component < 6; component++)
+            XYZTemperaturePoint[component] = ReadBinaryData<double>(TemperatureFilestream);
+        // If no data was extracted from the stream, the end of the file was reached
+        if (!(TemperatureFilestream))
+            return 0;
+        return 6 * sizeof(double);
     }
     else {
-        while (!TemperatureFilestream.eof()) {
-            std::vector<std::string> ParsedLine(3); // Get x, y, z - ignore tm, tl, cr
-            std::string ReadLine;
-            if (!getline(TemperatureFilestream, ReadLine))
-                break;
-            splitString(ReadLine, ParsedLine, 6);
-            // Only get x, y, and z values from ParsedLine
-            XCoordinates[XYZPointCounter] = getInputDouble(ParsedLine[0]);
-            YCoordinates[XYZPointCounter] = getInputDouble(ParsedLine[1]);
-            ZCoordinates[XYZPointCounter] = getInputDouble(ParsedLine[2]);
-            XYZPointCounter++;
-            if (XYZPointCounter == XCoordinates.size()) {
-                XCoordinates.resize(XYZPointCounter + XYZPointCount_Estimate);
-                YCoordinates.resize(XYZPointCounter + XYZPointCount_Estimate);
-                ZCoordinates.resize(XYZPointCounter + XYZPointCount_Estimate);
-            }
-        }
+        // Each line has an x, y, z, tm, tl, cr
+        std::string ReadLine;
+        if (!getline(TemperatureFilestream, ReadLine))
+            return 0;
+        std::string LineError =
+            parseTemperatureDataLine(ReadLine.c_str(), ReadLine.c_str() + ReadLine.size(), XYZTemperaturePoint);
+        if (!(LineError.empty()))
+            throw std::runtime_error(LineError);
+        return ReadLine.size() + 1;
     }
+}
 
-    XCoordinates.resize(XYZPointCounter);
-    YCoordinates.resize(XYZPointCounter);
-    ZCoordinates.resize(XYZPointCounter);
-    TemperatureFilestream.close();
+// Read x, y, z coordinates in part "Part" of "NumParts" roughly equal parts of tempfile_thislayer (temperature file in
+// either an ASCII or binary format) and return the min and max values. Parts without any data points return the
+// largest double value for the minimums and the lowest double value for the maximums. Coordinates are not stored, only
+// the running min and max values
+std::array<double, 6> parseTemperatureCoordinateMinMax(std::string tempfile_thislayer, bool BinaryInputData, int Part,
+                                                       int NumParts) {
 
-    // Min/max x, y, and z coordinates from this layer's data
-    XYZMinMax[0] = *min_element(XCoordinates.begin(), XCoordinates.end());
-    XYZMinMax[1] = *max_element(XCoordinates.begin(), XCoordinates.end());
-    XYZMinMax[2] = *min_element(YCoordinates.begin(), YCoordinates.end());
-    XYZMinMax[3] = *max_element(YCoordinates.begin(), YCoordinates.end());
-    XYZMinMax[4] = *min_element(ZCoordinates.begin(), ZCoordinates.end());
-    XYZMinMax[5] = *max_element(ZCoordinates.begin(), ZCoordinates.end());
+    std::array<double, 6> XYZMinMax;
+    for (int n = 0; n < 3; n++) {
+        XYZMinMax[2 * n] = std::numeric_limits<double>::max();
+        XYZMinMax[2 * n + 1] = std::numeric_limits<double>::lowest();
+    }
+    std::ifstream TemperatureFilestream;
+    TemperatureFilestream.open(tempfile_thislayer, std::ios::in | std::ios::binary);
+    long int PartEnd = seekTemperatureFilePart(TemperatureFilestream, BinaryInputData, Part, NumParts);
+    long int DataPointStart = TemperatureFilestream.tellg();
+
+    // Units are assumed to be in meters, meters, seconds, seconds, and K/second
+    std::array<double, 6> XYZTemperaturePoint;
+    while ((DataPointStart >= 0) && (DataPointStart < PartEnd)) {
+        long int DataPointSize = readTemperatureDataPoint(TemperatureFilestream, BinaryInputData, XYZTemperaturePoint);
+        if (DataPointSize == 0)
+            break;
+        DataPointStart += DataPointSize;
+        // Only the x, y, and z values are used, tm, tl, cr are ignored
+        for (int n = 0; n < 3; n++) {
+            if (XYZTemperaturePoint[n] < XYZMinMax[2 * n])
+                XYZMinMax[2 * n] = XYZTemperaturePoint[n];
+            if (XYZTemperaturePoint[n] > XYZMinMax[2 * n + 1])
+                XYZMinMax[2 * n + 1] = XYZTemperaturePoint[n];
+        }
+    }
+    TemperatureFilestream.close();
     return XYZMinMax;
 }
 
-// Read and parse the temperature file (double precision values in a comma-separated, ASCII format with a header line -
-// or a binary string of double precision values), storing the x, y, z, tm, tl, cr values in the RawData vector. Each
-// rank only contains the points corresponding to cells within the associated Y bounds. NumberOfTemperatureDataPoints is
-// incremented on each rank as data is added to RawData
-void parseTemperatureData(std::string tempfile_thislayer, double YMin, double deltax, int LowerYBound, int UpperYBound,
-                          std::vector<double> &RawData, unsigned int &NumberOfTemperatureDataPoints,
-                          bool BinaryInputData) {
+// Read part "Part" of "NumParts" roughly equal parts of tempfile_thislayer (temperature file in either an ASCII or
+// binary format), appending the x, y, z, tm, tl, cr values for each data point to RankData[Rank] for each MPI rank
+// whose Y bounds (LowerYBounds[Rank] through UpperYBounds[Rank], in increasing order with rank) contain the point
+void parseTemperatureDataByRank(std::string tempfile_thislayer, double YMin, double deltax,
+                                std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds,
+                                std::vector<std::vector<double>> &RankData, bool BinaryInputData, int Part,
+                                int NumParts) {
 
+    int np = LowerYBounds.size();
     std::ifstream TemperatureFilestream;
-    TemperatureFilestream.open(tempfile_thislayer);
-    if (BinaryInputData) {
-        while (!TemperatureFilestream.eof()) {
-            double XTemperaturePoint = ReadBinaryData<double>(TemperatureFilestream);
-            double YTemperaturePoint = ReadBinaryData<double>(TemperatureFilestream);
-            // If no data was extracted from the stream, the end of the file was reached
-            if (!(TemperatureFilestream))
-                break;
-            // Check the y value from ParsedLine, to check if this point is stored on this rank
-            // Check the CA grid positions of the data point to see which rank(s) should store it
-            int YInt = round((YTemperaturePoint - YMin) / deltax);
-            if ((YInt >= LowerYBound) && (YInt <= UpperYBound)) {
-                // This data point is inside the bounds of interest for this MPI rank
-                // Store the x and y values in RawData
-                RawData[NumberOfTemperatureDataPoints] = XTemperaturePoint;
-                NumberOfTemperatureDataPoints++;
-                RawData[NumberOfTemperatureDataPoints] = YTemperaturePoint;
-                NumberOfTemperatureDataPoints++;
-                // Parse the remaining 4 components (z, tm, tl, cr) from the line and store in RawData
-                for (int component = 2; component < 6; component++) {
-                    RawData[NumberOfTemperatureDataPoints] = ReadBinaryData<double>(TemperatureFilestream);
-                    NumberOfTemperatureDataPoints++;
-                }
-                // Adjust size of RawData if it is near full
-                if (NumberOfTemperatureDataPoints >= RawData.size() - 6) {
-                    int OldSize = RawData.size();
-                    RawData.resize(OldSize + 1000000);
-                }
-            }
-            else {
-                // This data point is inside the bounds of interest for this MPI rank
-                // ignore the z, tm, tl, cr values associated with it
-                unsigned char temp[4 * sizeof(double)];
-                TemperatureFilestream.read(reinterpret_cast<char *>(temp), 4 * sizeof(double));
-            }
+    TemperatureFilestream.open(tempfile_thislayer, std::ios::in | std::ios::binary);
+    long int PartEnd = seekTemperatureFilePart(TemperatureFilestream, BinaryInputData, Part, NumParts);
+    long int DataPointStart = TemperatureFilestream.tellg();
+
+    std::array<double, 6> XYZTemperaturePoint;
+    while ((DataPointStart >= 0) && (DataPointStart < PartEnd)) {
+        long int DataPointSize = readTemperatureDataPoint(TemperatureFilestream, BinaryInputData, XYZTemperaturePoint);
+        if (DataPointSize == 0)
+            break;
+        DataPointStart += DataPointSize;
+        // Check the CA grid positions of the data point to see which rank(s) should store it: the first rank whose
+        // upper Y bound is at or above the point, and any following ranks whose Y bounds overlap with it
+        int YInt = round((XYZTemperaturePoint[1] - YMin) / deltax);
+        int Rank = std::lower_bound(UpperYBounds.begin(), UpperYBounds.end(), YInt) - UpperYBounds.begin();
+        while ((Rank < np) && (LowerYBounds[Rank] <= YInt)) {
+            RankData[Rank].insert(RankData[Rank].end(), XYZTemperaturePoint.begin(), XYZTemperaturePoint.end());
+            Rank++;
         }
     }
-    else {
-        std::string DummyLine;
-        // ignore header line
-        getline(TemperatureFilestream, DummyLine);
-        while (!TemperatureFilestream.eof()) {
-            std::vector<std::string> ParsedLine(6); // Each line has an x, y, z, tm, tl, cr
-            std::string ReadLine;
-            if (!getline(TemperatureFilestream, ReadLine))
-                break;
-            splitString(ReadLine, ParsedLine, 6);
-            // Check the y value from ParsedLine, to check if this point is stored on this rank
-            double YTemperaturePoint = getInputDouble(ParsedLine[1]);
-            // Check the CA grid positions of the data point to see which rank(s) should store it
-            int YInt = round((YTemperaturePoint - YMin) / deltax);
-            if ((YInt >= LowerYBound) && (YInt <= UpperYBound)) {
-                // This data point is inside the bounds of interest for this MPI rank: Store the x, z, tm, tl, and cr
-                // vals inside of RawData, incrementing with each value added
-                for (int component = 0; component < 6; component++) {
-                    RawData[NumberOfTemperatureDataPoints] = getInputDouble(ParsedLine[component]);
-                    NumberOfTemperatureDataPoints++;
-                }
-                // Adjust size of RawData if it is near full
-                if (NumberOfTemperatureDataPoints >= RawData.size() - 6) {
-                    int OldSize = RawData.size();
-                    RawData.resize(OldSize + 1000000);
-                }
-            }
+    TemperatureFilestream.close();
+}
+
+// Map the temperature file tempfile_thislayer into memory for reading, returning a pointer to the start of the file
+// (or nullptr if the file is empty) and the file size in bytes as MappedSize. The mapping should be released with
+// munmap(MappedFile, MappedSize)
+void *mapTemperatureFile(std::string tempfile_thislayer, long int &MappedSize) {
+
+    int FileDescriptor = open(tempfile_thislayer.c_str(), O_RDONLY);
+    if (FileDescriptor == -1)
+        throw std::runtime_error("Error: Could not open temperature file " + tempfile_thislayer);
+    struct stat FileStats;
+    if (fstat(FileDescriptor, &FileStats) == -1) {
+        close(FileDescriptor);
+        throw std::runtime_error("Error: Could not get the size of temperature file " + tempfile_thislayer);
+    }
+    MappedSize = FileStats.st_size;
+    if (MappedSize == 0) {
+        close(FileDescriptor);
+        return nullptr;
+    }
+    void *MappedFile = mmap(nullptr, MappedSize, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+    close(FileDescriptor);
+    if (MappedFile == MAP_FAILED)
+        throw std::runtime_error("Error: Could not map temperature file " + tempfile_thislayer + " into memory");
+    madvise(MappedFile, MappedSize, MADV_SEQUENTIAL);
+    return MappedFile;
+}
+
+// Add the data points FirstDataPoint through LastDataPoint - 1 in TemperatureData (x, y, z, tm, tl, cr values for each)
+// that are within the Y bounds to RawData. Data points are checked against the Y bounds in blocks, and only the points
+// within the bounds are added to RawData
+void filterTemperatureDataPoints(const double *TemperatureData, long int FirstDataPoint, long int LastDataPoint,
+                                 int LowerYBound, int UpperYBound, RawTemperatureData &RawData) {
+
+    double YMin = RawData.YMin;
+    double deltax = RawData.deltax;
+    // A point's Y coordinate on the CA grid, round((y - YMin) / deltax), is within LowerYBound-UpperYBound if the
+    // unrounded value is within LowerYBound - 0.5 through UpperYBound + 0.5. Since round() rounds halfway cases away
+    // from zero, whether these limits are themselves in bounds depends on the sign of the bound
+    double YLowerLimit = LowerYBound - 0.5;
+    double YUpperLimit = UpperYBound + 0.5;
+    bool LowerLimitInBounds = (LowerYBound > 0);
+    bool UpperLimitInBounds = (UpperYBound < 0);
+    const unsigned int BlockSize = 1024;
+    unsigned char InYBounds[BlockSize];
+    for (long int BlockStart = FirstDataPoint; BlockStart < LastDataPoint; BlockStart += BlockSize) {
+        long int BlockEnd = std::min(BlockStart + BlockSize, LastDataPoint);
+        // Check all points in the block against the Y bounds without branching
+        for (long int DataPoint = BlockStart; DataPoint < BlockEnd; DataPoint++) {
+            double YUnrounded = (TemperatureData[6 * DataPoint + 1] - YMin) / deltax;
+            bool AboveLower = (YUnrounded > YLowerLimit) | (LowerLimitInBounds & (YUnrounded == YLowerLimit));
+            bool BelowUpper = (YUnrounded < YUpperLimit) | (UpperLimitInBounds & (YUnrounded == YUpperLimit));
+            InYBounds[DataPoint - BlockStart] = AboveLower & BelowUpper;
+        }
+        // Add the points inside the bounds of interest for this MPI rank to RawData
+        for (long int DataPoint = BlockStart; DataPoint < BlockEnd; DataPoint++) {
+            if (InYBounds[DataPoint - BlockStart])
+                RawData.addPoint(TemperatureData + 6 * DataPoint);
         }
     }
 }
+
+// Parse a binary temperature file (a string of double precision x, y, z, tm, tl, cr values) mapped into memory, adding
+// the points within the Y bounds to RawData
+void parseTemperatureData_Mapped(std::string tempfile_thislayer, int LowerYBound, int UpperYBound,
+                                 RawTemperatureData &RawData) {
+
+    long int MappedSize;
+    void *MappedFile = mapTemperatureFile(tempfile_thislayer, MappedSize);
+    if (MappedFile == nullptr)
+        return;
+    if (MappedSize % (6 * sizeof(double)) != 0) {
+        munmap(MappedFile, MappedSize);
+        throw std::runtime_error("Error: Incomplete temperature data point in binary temperature file " +
+                                 tempfile_thislayer);
+    }
+    long int NumDataPoints = MappedSize / (6 * sizeof(double));
+    // The mapping is page-aligned, so the values can be read in place
+    const double *TemperatureData = static_cast<const double *>(MappedFile);
+    filterTemperatureDataPoints(TemperatureData, 0, NumDataPoints, LowerYBound, UpperYBound, RawData);
+    munmap(MappedFile, MappedSize);
+}
+
+// Parse the lines of an ASCII temperature file that start within Text[ChunkStart] through Text[ChunkEnd - 1], adding
+// the points within the Y bounds to ChunkData. Returns an error message, or an empty string if all lines were parsed
+std::string parseTemperatureDataChunk(const char *Text, long int TextSize, long int ChunkStart, long int ChunkEnd,
+                                      int LowerYBound, int UpperYBound, RawTemperatureData &ChunkData) {
+
+    // Start from the first line beginning within this chunk
+    long int LineStart = ChunkStart;
+    if (LineStart > 0) {
+        while ((LineStart < ChunkEnd) && (Text[LineStart - 1] != '\n'))
+            LineStart++;
+    }
+    std::array<double, 6> XYZTemperaturePoint;
+    std::string LastLine;
+    while (LineStart < ChunkEnd) {
+        const char *Line = Text + LineStart;
+        const char *LineEnd = static_cast<const char *>(memchr(Line, '\n', TextSize - LineStart));
+        if (LineEnd == nullptr) {
+            // The last line of the file isn't followed by a newline, and is copied so that the values can be parsed
+            // without reading past the end of the text
+            LastLine.assign(Line, TextSize - LineStart);
+            Line = LastLine.c_str();
+            LineEnd = Line + LastLine.size();
+            LineStart = TextSize;
+        }
+        else
+            LineStart = LineEnd - Text + 1;
+        std::string LineError = parseTemperatureDataLine(Line, LineEnd, XYZTemperaturePoint);
+        if (!(LineError.empty()))
+            return LineError;
+        // Check the CA grid positions of the data point to see if this rank should store it
+        int YInt = round((XYZTemperaturePoint[1] - ChunkData.YMin) / ChunkData.deltax);
+        if ((YInt >= LowerYBound) && (YInt <= UpperYBound))
+            ChunkData.addPoint(XYZTemperaturePoint.data());
+    }
+    return "";
+}
+
+// Parse an ASCII temperature file (comma-separated x, y, z, tm, tl, cr values following a header line), adding the
+// points within the Y bounds to RawData. The file is split into chunks parsed in parallel on the host (unless
+// HostParallel is false, for calls made outside of the main thread), and the data from each chunk is then added to
+// RawData in file order
+void parseTemperatureData_Chunked(std::string tempfile_thislayer, int LowerYBound, int UpperYBound,
+                                  RawTemperatureData &RawData, bool HostParallel) {
+
+    long int MappedSize;
+    void *MappedFile = mapTemperatureFile(tempfile_thislayer, MappedSize);
+    if (MappedFile == nullptr)
+        return;
+    const char *Text = static_cast<const char *>(MappedFile);
+    // Ignore header line
+    const char *HeaderEnd = static_cast<const char *>(memchr(Text, '\n', MappedSize));
+    long int DataStart = (HeaderEnd == nullptr) ? MappedSize : HeaderEnd - Text + 1;
+    long int DataSize = MappedSize - DataStart;
+
+    // Use one chunk per host thread, if Kokkos is available
+    int NumChunks = 1;
+    if ((HostParallel) && (Kokkos::is_initialized()))
+        NumChunks = Kokkos::DefaultHostExecutionSpace().concurrency();
+    // Each chunk's data is stored on the same CA grid as RawData
+    RawTemperatureData EmptyChunkData(RawData.XMin, RawData.YMin, RawData.ZMin, RawData.deltax);
+    std::vector<RawTemperatureData> ChunkData(NumChunks, EmptyChunkData);
+    std::vector<std::string> ChunkErrors(NumChunks);
+    auto parseChunk = [&](const int Chunk) {
+        long int ChunkStart = DataStart + DataSize * Chunk / NumChunks;
+        long int ChunkEnd = DataStart + DataSize * (Chunk + 1) / NumChunks;
+        ChunkErrors[Chunk] = parseTemperatureDataChunk(Text, MappedSize, ChunkStart, ChunkEnd, LowerYBound,
+                                                       UpperYBound, ChunkData[Chunk]);
+    };
+    if (NumChunks > 1)
+        Kokkos::parallel_for("ParseTemperatureData",
+                             Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, NumChunks), parseChunk);
+    else
+        parseChunk(0);
+    munmap(MappedFile, MappedSize);
+
+    for (int Chunk = 0; Chunk < NumChunks; Chunk++) {
+        if (!(ChunkErrors[Chunk].empty()))
+            throw std::runtime_error(ChunkErrors[Chunk]);
+        RawData.append(ChunkData[Chunk]);
+        ChunkData[Chunk].clear();
+    }
+}
+
+// Read and parse the temperature file (double precision values in a comma-separated, ASCII format with a header line -
+// or a binary string of double precision values), adding the x, y, z, tm, tl, cr values to RawData. Each rank only
+// contains the points corresponding to cells within the associated Y bounds
+void parseTemperatureData(std::string tempfile_thislayer, int LowerYBound, int UpperYBound, RawTemperatureData &RawData,
+                          bool BinaryInputData, bool HostParallel) {
+
+    if (BinaryInputData)
+        parseTemperatureData_Mapped(tempfile_thislayer, LowerYBound, UpperYBound, RawData);
+    else
+        parseTemperatureData_Chunked(tempfile_thislayer, LowerYBound, UpperYBound, RawData, HostParallel);
+}
@@ -6,6 +6,7 @@
 #ifndef EXACA_PARSE_HPP
 #define EXACA_PARSE_HPP
 
+#include "CAtempdata.hpp"
 #include "CAtypes.hpp"
 
 #include <fstream>
@@ -28,7 +29,8 @@ void checkForHeaderValues(std::string header_line);
 void getTemperatureDataPoint(std::string s, std::vector<double> &XYZTemperaturePoint);
 void parseTInstuctionsFile(int id, const std::string TFieldInstructions, int &TempFilesInSeries, int &NumberOfLayers,
                            int &LayerHeight, double deltax, double &HT_deltax, std::vector<std::string> &temp_paths,
-                           bool &RemeltingYN, bool &LayerwiseTempRead);
+                           bool &RemeltingYN, bool &LayerwiseTempRead, int &TempReaderRanks, int &TempReuseMemory,
+                           int &TempEventWindow);
 bool checkFileExists(const std::string path, const int id, const bool error = true);
 std::string checkFileInstalled(const std::string name, const int id);
 void checkFileNotEmpty(std::string testfilename);
@@ -63,9 +65,27 @@ ReadType ParseASCIIData(std::istringstream &ss) {
     ss >> readValue;
     return readValue;
 }
-std::array<double, 6> parseTemperatureCoordinateMinMax(std::string tempfile_thislayer, bool BinaryInputData);
-void parseTemperatureData(std::string tempfile_thislayer, double YMin, double deltax, int LowerYBound, int UpperYBound,
-                          std::vector<double> &RawData, unsigned int &NumberOfTemperatureDataPoints,
-                          bool BinaryInputData);
+std::string parseTemperatureDataLine(const char *LineStart, const char *LineEnd,
+                                     std::array<double, 6> &XYZTemperaturePoint);
+long int seekTemperatureFilePart(std::ifstream &TemperatureFilestream, bool BinaryInputData, int Part, int NumParts);
+long int readTemperatureDataPoint(std::ifstream &TemperatureFilestream, bool BinaryInputData,
+                                  std::array<double, 6> &XYZTemperaturePoint);
+std::array<double, 6> parseTemperatureCoordinateMinMax(std::string tempfile_thislayer, bool BinaryInputData,
+                                                       int Part = 0, int NumParts = 1);
+void *mapTemperatureFile(std::string tempfile_thislayer, long int &MappedSize);
+void filterTemperatureDataPoints(const double *TemperatureData, long int FirstDataPoint, long int LastDataPoint,
+                                 int LowerYBound, int UpperYBound, RawTemperatureData &RawData);
+void parseTemperatureData_Mapped(std::string tempfile_thislayer, int LowerYBound, int UpperYBound,
+                                 RawTemperatureData &RawData);
+std::string parseTemperatureDataChunk(const char *Text, long int TextSize, long int ChunkStart, long int ChunkEnd,
+                                      int LowerYBound, int UpperYBound, RawTemperatureData &ChunkData);
+void parseTemperatureData_Chunked(std::string tempfile_thislayer, int LowerYBound, int UpperYBound,
+                                  RawTemperatureData &RawData, bool HostParallel = true);
+void parseTemperatureData(std::string tempfile_thislayer, int LowerYBound, int UpperYBound, RawTemperatureData &RawData,
+                          bool BinaryInputData, bool HostParallel = true);
+void parseTemperatureDataByRank(std::string tempfile_thislayer, double YMin, double deltax,
+                                std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds,
+                                std::vector<std::vector<double>> &RankData, bool BinaryInputData, int Part,
+                                int NumParts);
 
 #endif
@@ -584,11 +584,12 @@ void PrintExaCALog(int id, int np, std::string InputFile, std::string Simulation
                    double deltat, int NumberOfLayers, int LayerHeight, std::string SubstrateFileName,
                    double SubstrateGrainSpacing, bool SubstrateFile, double G, double R, int nx, int ny, int nz,
                    double FractSurfaceSitesActive, std::string PathToOutput, int NSpotsX, int NSpotsY, int SpotOffset,
-                   int SpotRadius, std::string BaseFileName, double InitTime, double RunTime, double OutTime, int cycle,
-                   double InitMaxTime, double InitMinTime, double NuclMaxTime, double NuclMinTime,
-                   double CreateSVMinTime, double CreateSVMaxTime, double CaptureMaxTime, double CaptureMinTime,
-                   double GhostMaxTime, double GhostMinTime, double OutMaxTime, double OutMinTime, double XMin,
-                   double XMax, double YMin, double YMax, double ZMin, double ZMax) {
+                   int SpotRadius, RosenthalRasterProvider Raster, std::string BaseFileName, double InitTime,
+                   double RunTime, double OutTime, int cycle, double InitMaxTime, double InitMinTime,
+                   double NuclMaxTime, double NuclMinTime, double CreateSVMinTime, double CreateSVMaxTime,
+                   double CaptureMaxTime, double CaptureMinTime, double GhostMaxTime, double GhostMinTime,
+                   double OutMaxTime, double OutMinTime, double XMin, double XMax, double YMin, double YMax,
+                   double ZMin, double ZMax) {
 
     int *YSlices = new int[np];
     int *YOffset = new int[np];
@@ -647,6 +648,9 @@ void PrintExaCALog(int id, int np, std::string InputFile, std::string Simulation
                 ExaCALog << "Offset between spots (in microns): " << SpotOffset << std::endl;
                 ExaCALog << "Radii of spots (in microns): " << SpotRadius << std::endl;
             }
+            else if (SimulationType == "L") {
+                ExaCALog << Raster.print() << std::endl;
+            }
             else if (SimulationType == "R") {
                 ExaCALog << "The temperature file(s) repeated in the simulation were: ";
                 for (int i = 0; i < TempFilesInSeries - 1; i++) {
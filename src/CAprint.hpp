@@ -8,6 +8,7 @@
 
 #include "CAinterfacialresponse.hpp"
 #include "CAparsefiles.hpp"
+#include "CAtempprovider.hpp"
 #include "CAtypes.hpp"
 
 #include <Kokkos_Core.hpp>
@@ -42,11 +43,12 @@ void PrintExaCALog(int id, int np, std::string InputFile, std::string Simulation
                    double deltat, int NumberOfLayers, int LayerHeight, std::string SubstrateFileName,
                    double SubstrateGrainSpacing, bool SubstrateFile, double G, double R, int nx, int ny, int nz,
                    double FractSurfaceSitesActive, std::string PathToOutput, int NSpotsX, int NSpotsY, int SpotOffset,
-                   int SpotRadius, std::string BaseFileName, double InitTime, double RunTime, double OutTime, int cycle,
-                   double InitMaxTime, double InitMinTime, double NuclMaxTime, double NuclMinTime,
-                   double CreateSVMinTime, double CreateSVMaxTime, double CaptureMaxTime, double CaptureMinTime,
-                   double GhostMaxTime, double GhostMinTime, double OutMaxTime, double OutMinTime, double XMin,
-                   double XMax, double YMin, double YMax, double ZMin, double ZMax);
+                   int SpotRadius, RosenthalRasterProvider Raster, std::string BaseFileName, double InitTime,
+                   double RunTime, double OutTime, int cycle, double InitMaxTime, double InitMinTime,
+                   double NuclMaxTime, double NuclMinTime, double CreateSVMinTime, double CreateSVMaxTime,
+                   double CaptureMaxTime, double CaptureMinTime, double GhostMaxTime, double GhostMinTime,
+                   double OutMaxTime, double OutMinTime, double XMin, double XMax, double YMin, double YMax,
+                   double ZMin, double ZMax);
 void PrintCAFields(int nx, int ny, int nz, ViewI3D_H GrainID_WholeDomain, ViewI3D_H LayerID_WholeDomain,
                    ViewI3D_H CritTimeStep_WholeDomain, ViewI3D_H CellType_WholeDomain,
                    ViewF3D_H UndercoolingChange_WholeDomain, ViewF3D_H UndercoolingCurrent_WholeDomain,
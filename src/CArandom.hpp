@@ -0,0 +1,123 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_RANDOM_HPP
+#define EXACA_RANDOM_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+// Random number streams - each use of random numbers draws from its own stream, so that streams with the same RNG
+// seed and stream index are unrelated
+enum RandomStreams { NucleiStream = 1, SubstrateStream = 2, BaseplateStream = 3, PowderStream = 4 };
+
+// Counter-based random number generator (Philox-4x32-10). Rather than advancing a state, each draw is computed from
+// the key (the RNG seed) and a counter (the stream, the index of the sample being drawn, and the draw number within
+// that sample), so samples can be drawn in any order, on any MPI rank or thread, and give the same values
+struct CounterRNG {
+    uint32_t Key0 = 0;
+    uint32_t Key1 = 0;
+    uint32_t Stream = 0;
+
+    CounterRNG() = default;
+    // StreamIndex distinguishes multiple streams of the same type, such as one per layer
+    CounterRNG(double RNGSeed, int StreamType, int StreamIndex) {
+        uint64_t Seed = RNGSeed;
+        Key0 = static_cast<uint32_t>(Seed);
+        Key1 = static_cast<uint32_t>(Seed >> 32);
+        Stream = (static_cast<uint32_t>(StreamType) << 24) + static_cast<uint32_t>(StreamIndex);
+    }
+
+    // Apply the 10 Philox rounds to Words (the counter), giving 4 random 32-bit words
+    KOKKOS_INLINE_FUNCTION static void philox(uint32_t Words[4], uint32_t Key0_, uint32_t Key1_) {
+        for (int Round = 0; Round < 10; Round++) {
+            if (Round > 0) {
+                Key0_ += 0x9E3779B9U;
+                Key1_ += 0xBB67AE85U;
+            }
+            uint64_t Product0 = static_cast<uint64_t>(0xD2511F53U) * Words[0];
+            uint64_t Product1 = static_cast<uint64_t>(0xCD9E8D57U) * Words[2];
+            uint32_t Word1 = Words[1];
+            uint32_t Word3 = Words[3];
+            Words[0] = static_cast<uint32_t>(Product1 >> 32) ^ Word1 ^ Key0_;
+            Words[1] = static_cast<uint32_t>(Product1);
+            Words[2] = static_cast<uint32_t>(Product0 >> 32) ^ Word3 ^ Key1_;
+            Words[3] = static_cast<uint32_t>(Product0);
+        }
+    }
+
+    // 4 random 32-bit words for draw number Draw of sample Index
+    KOKKOS_INLINE_FUNCTION void getWords(int64_t Index, int Draw, uint32_t Words[4]) const {
+        Words[0] = static_cast<uint32_t>(Index);
+        Words[1] = static_cast<uint32_t>(static_cast<uint64_t>(Index) >> 32);
+        Words[2] = static_cast<uint32_t>(Draw);
+        Words[3] = Stream;
+        philox(Words, Key0, Key1);
+    }
+
+    // Random integer from 0 through N - 1. Uses only integer arithmetic, so the result is the same on any backend
+    KOKKOS_INLINE_FUNCTION int uniformInt(int64_t Index, int Draw, int N) const {
+        uint32_t Words[4];
+        getWords(Index, Draw, Words);
+        return static_cast<int>((static_cast<uint64_t>(Words[0]) * static_cast<uint64_t>(N)) >> 32);
+    }
+
+    // Random double in [0, 1), with 53 random bits
+    KOKKOS_INLINE_FUNCTION double uniform(int64_t Index, int Draw) const {
+        uint32_t Words[4];
+        getWords(Index, Draw, Words);
+        return ((Words[0] >> 5) * 67108864.0 + (Words[1] >> 6)) / 9007199254740992.0;
+    }
+
+    // Random double from a normal distribution (Box-Muller transform of two uniform values)
+    KOKKOS_INLINE_FUNCTION double normal(int64_t Index, int Draw, double Mean, double StdDev) const {
+        uint32_t Words[4];
+        getWords(Index, Draw, Words);
+        // U1 is in (0, 1], so that its log is finite
+        double U1 = ((Words[0] >> 5) * 67108864.0 + (Words[1] >> 6) + 1.0) / 9007199254740992.0;
+        double U2 = ((Words[2] >> 5) * 67108864.0 + (Words[3] >> 6)) / 9007199254740992.0;
+        return Mean + StdDev * sqrt(-2.0 * log(U1)) * cos(2.0 * M_PI * U2);
+    }
+};
+
+// Random permutation of the integers 0 through N - 1, where the value at any position can be found on its own. Uses a
+// 4-round Feistel network (with RNG draws as the round functions) on the smallest range of 2^(2 * HalfBits) integers
+// containing 0 through N - 1, reapplied to values outside of 0 through N - 1 until one is inside
+struct RandomPermutation {
+    CounterRNG RNG;
+    int64_t N = 1;
+    int HalfBits = 0;
+
+    RandomPermutation() = default;
+    RandomPermutation(const CounterRNG &RNG_, int64_t N_)
+        : RNG(RNG_)
+        , N(N_) {
+        while ((static_cast<int64_t>(1) << (2 * HalfBits)) < N)
+            HalfBits++;
+    }
+
+    // Value at position Index (from 0 through N - 1)
+    KOKKOS_INLINE_FUNCTION int64_t operator()(int64_t Index) const {
+        uint64_t Mask = (static_cast<uint64_t>(1) << HalfBits) - 1;
+        uint64_t Value = static_cast<uint64_t>(Index);
+        do {
+            uint64_t Left = Value >> HalfBits;
+            uint64_t Right = Value & Mask;
+            for (int Round = 0; Round < 4; Round++) {
+                uint32_t Words[4];
+                RNG.getWords(static_cast<int64_t>(Right), Round, Words);
+                uint64_t NewRight = (Left ^ Words[0]) & Mask;
+                Left = Right;
+                Right = NewRight;
+            }
+            Value = (Left << HalfBits) | Right;
+        } while (Value >= static_cast<uint64_t>(N));
+        return static_cast<int64_t>(Value);
+    }
+};
+
+#endif
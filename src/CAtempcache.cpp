@@ -0,0 +1,230 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include "CAtempcache.hpp"
+#include "CAinitialize.hpp"
+#include "CAparsefiles.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <sys/mman.h>
+
+// Identifies a file as an ExaCA temperature cache, and the version of the format
+const char TemperatureCacheMagic[8] = {'E', 'x', 'a', 'C', 'A', 'T', 'C', '2'};
+// Size of the header in bytes: identifier, source hash, number of data points and Y slices, XYZ bounds, HT_deltax
+const long int TemperatureCacheHeaderSize = 8 + 3 * 8 + 7 * 8;
+
+//*****************************************************************************/
+// Check if the temperature data is a temperature cache file
+bool checkTemperatureCacheFormat(std::string tempfile_thislayer) {
+    std::string Extension = ".catcache";
+    return ((tempfile_thislayer.size() > Extension.size()) &&
+            (tempfile_thislayer.compare(tempfile_thislayer.size() - Extension.size(), Extension.size(), Extension) ==
+             0));
+}
+
+// Name of the temperature cache file for a temperature file: the same path, with the extension replaced by .catcache
+std::string getTemperatureCacheName(std::string tempfile_thislayer) {
+    std::size_t ExtensionStart = tempfile_thislayer.find_last_of('.');
+    std::size_t PathEnd = tempfile_thislayer.find_last_of('/');
+    if ((ExtensionStart == std::string::npos) || ((PathEnd != std::string::npos) && (ExtensionStart < PathEnd)))
+        return tempfile_thislayer + ".catcache";
+    return tempfile_thislayer.substr(0, ExtensionStart) + ".catcache";
+}
+
+// 64-bit FNV-1a hash of the contents of a temperature file
+std::uint64_t hashTemperatureFile(std::string tempfile_thislayer) {
+
+    std::uint64_t Hash = 14695981039346656037ULL;
+    long int MappedSize;
+    void *MappedFile = mapTemperatureFile(tempfile_thislayer, MappedSize);
+    if (MappedFile == nullptr)
+        return Hash;
+    const unsigned char *FileBytes = static_cast<const unsigned char *>(MappedFile);
+    for (long int n = 0; n < MappedSize; n++) {
+        Hash ^= FileBytes[n];
+        Hash *= 1099511628211ULL;
+    }
+    munmap(MappedFile, MappedSize);
+    return Hash;
+}
+
+// Read the header of a temperature cache file from FileBytes
+TemperatureCacheHeader parseTemperatureCacheHeader(const char *FileBytes, std::string cachefile) {
+
+    if (std::memcmp(FileBytes, TemperatureCacheMagic, 8) != 0)
+        throw std::runtime_error("Error: " + cachefile + " is not an ExaCA temperature cache file");
+    TemperatureCacheHeader Header;
+    std::memcpy(&Header.SourceHash, FileBytes + 8, 8);
+    std::memcpy(&Header.NumDataPoints, FileBytes + 16, 8);
+    std::memcpy(&Header.NumYSlices, FileBytes + 24, 8);
+    std::memcpy(Header.XYZMinMax.data(), FileBytes + 32, 6 * sizeof(double));
+    std::memcpy(&Header.HT_deltax, FileBytes + 80, sizeof(double));
+    return Header;
+}
+
+// Read the header of the temperature cache file cachefile
+TemperatureCacheHeader readTemperatureCacheHeader(std::string cachefile) {
+
+    std::ifstream CacheFilestream;
+    CacheFilestream.open(cachefile, std::ios::in | std::ios::binary);
+    if (!(CacheFilestream.is_open()))
+        throw std::runtime_error("Error: Could not open temperature cache file " + cachefile);
+    char HeaderBytes[TemperatureCacheHeaderSize];
+    CacheFilestream.read(HeaderBytes, TemperatureCacheHeaderSize);
+    if (!(CacheFilestream))
+        throw std::runtime_error("Error: " + cachefile + " is not an ExaCA temperature cache file");
+    CacheFilestream.close();
+    return parseTemperatureCacheHeader(HeaderBytes, cachefile);
+}
+
+// Check if the temperature cache file cachefile exists and was written with the given heat transport data mesh size
+// from a temperature file with hash SourceHash, in which case it can be reused
+bool checkTemperatureCacheCurrent(std::string cachefile, std::uint64_t SourceHash, double HT_deltax) {
+
+    std::ifstream CacheFilestream;
+    CacheFilestream.open(cachefile, std::ios::in | std::ios::binary);
+    if (!(CacheFilestream.is_open()))
+        return false;
+    char HeaderBytes[TemperatureCacheHeaderSize];
+    CacheFilestream.read(HeaderBytes, TemperatureCacheHeaderSize);
+    if ((!(CacheFilestream)) || (std::memcmp(HeaderBytes, TemperatureCacheMagic, 8) != 0))
+        return false;
+    CacheFilestream.close();
+    TemperatureCacheHeader Header = parseTemperatureCacheHeader(HeaderBytes, cachefile);
+    return ((Header.SourceHash == SourceHash) && (Header.HT_deltax == HT_deltax));
+}
+
+//*****************************************************************************/
+// Write the data from temperature file tempfile_thislayer (in either an ASCII or binary format) to the temperature
+// cache file cachefile, grouped by Y coordinate on the heat transport data grid with spacing HT_deltax. Data points
+// with the same Y coordinate remain in the order they appear in the temperature file, and the position of each data
+// point in the temperature file is stored after the data so that this order can be restored when reading
+void writeTemperatureCache(std::string tempfile_thislayer, std::string cachefile, double HT_deltax,
+                           std::uint64_t SourceHash) {
+
+    // Read all data points from the file, keeping the physical x, y, z coordinates of each
+    std::vector<int> LowerYBounds = {std::numeric_limits<int>::min()};
+    std::vector<int> UpperYBounds = {std::numeric_limits<int>::max()};
+    std::vector<std::vector<double>> FileData(1);
+    bool BinaryInputData = checkTemperatureFileFormat(tempfile_thislayer);
+    parseTemperatureDataByRank(tempfile_thislayer, 0.0, 1.0, LowerYBounds, UpperYBounds, FileData, BinaryInputData, 0,
+                               1);
+    std::vector<double> &RawData = FileData[0];
+    TemperatureCacheHeader Header;
+    Header.SourceHash = SourceHash;
+    Header.NumDataPoints = RawData.size() / 6;
+    Header.HT_deltax = HT_deltax;
+    if (Header.NumDataPoints == 0)
+        throw std::runtime_error("Error: No temperature data found in " + tempfile_thislayer);
+    for (int n = 0; n < 3; n++) {
+        Header.XYZMinMax[2 * n] = std::numeric_limits<double>::max();
+        Header.XYZMinMax[2 * n + 1] = std::numeric_limits<double>::lowest();
+    }
+    for (std::int64_t DataPoint = 0; DataPoint < Header.NumDataPoints; DataPoint++) {
+        for (int n = 0; n < 3; n++) {
+            Header.XYZMinMax[2 * n] = std::min(Header.XYZMinMax[2 * n], RawData[6 * DataPoint + n]);
+            Header.XYZMinMax[2 * n + 1] = std::max(Header.XYZMinMax[2 * n + 1], RawData[6 * DataPoint + n]);
+        }
+    }
+    Header.NumYSlices = std::lround((Header.XYZMinMax[3] - Header.XYZMinMax[2]) / HT_deltax) + 1;
+
+    // Y coordinate of each data point on the heat transport data grid, and the number of data points with each
+    std::vector<long int> YSlices(Header.NumDataPoints);
+    std::vector<std::int64_t> SliceStart(Header.NumYSlices + 1, 0);
+    for (std::int64_t DataPoint = 0; DataPoint < Header.NumDataPoints; DataPoint++) {
+        long int YSlice = std::lround((RawData[6 * DataPoint + 1] - Header.XYZMinMax[2]) / HT_deltax);
+        YSlice = std::max(0L, std::min(YSlice, static_cast<long int>(Header.NumYSlices - 1)));
+        YSlices[DataPoint] = YSlice;
+        SliceStart[YSlice + 1]++;
+    }
+    for (std::int64_t YSlice = 0; YSlice < Header.NumYSlices; YSlice++)
+        SliceStart[YSlice + 1] += SliceStart[YSlice];
+    // Group the data points by Y coordinate, keeping each group in file order
+    std::vector<std::int64_t> SortedOrder(Header.NumDataPoints);
+    std::vector<std::int64_t> SliceFill(SliceStart.begin(), SliceStart.end() - 1);
+    for (std::int64_t DataPoint = 0; DataPoint < Header.NumDataPoints; DataPoint++)
+        SortedOrder[SliceFill[YSlices[DataPoint]]++] = DataPoint;
+
+    std::ofstream CacheFilestream;
+    CacheFilestream.open(cachefile, std::ios::out | std::ios::binary);
+    if (!(CacheFilestream.is_open()))
+        throw std::runtime_error("Error: Could not open temperature cache file " + cachefile + " for writing");
+    CacheFilestream.write(TemperatureCacheMagic, 8);
+    CacheFilestream.write(reinterpret_cast<const char *>(&Header.SourceHash), 8);
+    CacheFilestream.write(reinterpret_cast<const char *>(&Header.NumDataPoints), 8);
+    CacheFilestream.write(reinterpret_cast<const char *>(&Header.NumYSlices), 8);
+    CacheFilestream.write(reinterpret_cast<const char *>(Header.XYZMinMax.data()), 6 * sizeof(double));
+    CacheFilestream.write(reinterpret_cast<const char *>(&Header.HT_deltax), sizeof(double));
+    CacheFilestream.write(reinterpret_cast<const char *>(SliceStart.data()), 8 * (Header.NumYSlices + 1));
+    for (std::int64_t DataPoint = 0; DataPoint < Header.NumDataPoints; DataPoint++)
+        CacheFilestream.write(reinterpret_cast<const char *>(&RawData[6 * SortedOrder[DataPoint]]),
+                              6 * sizeof(double));
+    CacheFilestream.write(reinterpret_cast<const char *>(SortedOrder.data()), 8 * Header.NumDataPoints);
+    CacheFilestream.close();
+}
+
+//*****************************************************************************/
+// Read the data points from temperature cache file cachefile within the Y bounds, adding them to RawData in the order
+// they appear in the temperature file the cache was written from. Only the Y slices of the cache that can contain
+// points within the bounds are read. The cache must have been written with heat transport data mesh size HT_deltax
+void parseTemperatureData_Cache(std::string cachefile, double HT_deltax, int LowerYBound, int UpperYBound,
+                                RawTemperatureData &RawData) {
+
+    long int MappedSize;
+    void *MappedFile = mapTemperatureFile(cachefile, MappedSize);
+    if ((MappedFile == nullptr) || (MappedSize < TemperatureCacheHeaderSize))
+        throw std::runtime_error("Error: " + cachefile + " is not an ExaCA temperature cache file");
+    const char *FileBytes = static_cast<const char *>(MappedFile);
+    TemperatureCacheHeader Header = parseTemperatureCacheHeader(FileBytes, cachefile);
+    if (MappedSize != TemperatureCacheHeaderSize + 8 * (Header.NumYSlices + 1) + 56 * Header.NumDataPoints) {
+        munmap(MappedFile, MappedSize);
+        throw std::runtime_error("Error: temperature cache file " + cachefile + " is truncated or corrupted");
+    }
+    if (std::abs(Header.HT_deltax - HT_deltax) > 0.000001 * HT_deltax) {
+        munmap(MappedFile, MappedSize);
+        throw std::runtime_error("Error: temperature cache file " + cachefile + " was written with a heat transport "
+                                 "data mesh size of " + std::to_string(Header.HT_deltax * 1.0e6) +
+                                 " microns, but the mesh size given is " + std::to_string(HT_deltax * 1.0e6) +
+                                 " microns");
+    }
+    // The header size and index size are multiples of 8 bytes, so the index, data, and data point positions in the
+    // temperature file can be read in place
+    const std::int64_t *SliceStart = reinterpret_cast<const std::int64_t *>(FileBytes + TemperatureCacheHeaderSize);
+    const double *TemperatureData =
+        reinterpret_cast<const double *>(FileBytes + TemperatureCacheHeaderSize + 8 * (Header.NumYSlices + 1));
+    const std::int64_t *SourceIndex =
+        reinterpret_cast<const std::int64_t *>(TemperatureData + 6 * Header.NumDataPoints);
+
+    // Range of Y slices spanning the Y bounds in CA cells (with one extra slice on each side to account for rounding)
+    double YLowerLimit = RawData.YMin + (LowerYBound - 0.5) * RawData.deltax;
+    double YUpperLimit = RawData.YMin + (UpperYBound + 0.5) * RawData.deltax;
+    long int FirstSlice = std::floor((YLowerLimit - Header.XYZMinMax[2]) / Header.HT_deltax + 0.5) - 1;
+    long int LastSlice = std::ceil((YUpperLimit - Header.XYZMinMax[2]) / Header.HT_deltax + 0.5) + 1;
+    FirstSlice = std::max(FirstSlice, 0L);
+    LastSlice = std::min(LastSlice, static_cast<long int>(Header.NumYSlices - 1));
+    if (FirstSlice <= LastSlice) {
+        // Put the data points from these slices back in temperature file order before filtering them, as the order of
+        // the points affects how the temperature data is placed
+        std::int64_t FirstDataPoint = SliceStart[FirstSlice];
+        std::int64_t NumDataPoints = SliceStart[LastSlice + 1] - FirstDataPoint;
+        std::vector<std::int64_t> FileOrder(NumDataPoints);
+        for (std::int64_t DataPoint = 0; DataPoint < NumDataPoints; DataPoint++)
+            FileOrder[DataPoint] = FirstDataPoint + DataPoint;
+        std::sort(FileOrder.begin(), FileOrder.end(), [&](std::int64_t DataPoint1, std::int64_t DataPoint2) {
+            return SourceIndex[DataPoint1] < SourceIndex[DataPoint2];
+        });
+        std::vector<double> SliceData(6 * NumDataPoints);
+        for (std::int64_t DataPoint = 0; DataPoint < NumDataPoints; DataPoint++)
+            std::memcpy(&SliceData[6 * DataPoint], TemperatureData + 6 * FileOrder[DataPoint], 6 * sizeof(double));
+        filterTemperatureDataPoints(SliceData.data(), 0, NumDataPoints, LowerYBound, UpperYBound, RawData);
+    }
+    munmap(MappedFile, MappedSize);
+}
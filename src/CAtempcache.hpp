@@ -0,0 +1,41 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_TEMPCACHE_HPP
+#define EXACA_TEMPCACHE_HPP
+
+#include "CAtempdata.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Temperature cache files (extension .catcache) hold the data from one temperature file as binary double precision
+// x, y, z, tm, tl, cr values, grouped by Y coordinate on the heat transport data grid. The file starts with a header,
+// followed by the data point index at which each Y coordinate's data starts (plus the total number of data points),
+// followed by the data, followed by the position of each data point in the temperature file
+struct TemperatureCacheHeader {
+    // Hash of the contents of the temperature file the cache was written from
+    std::uint64_t SourceHash = 0;
+    std::int64_t NumDataPoints = 0;
+    // Number of Y coordinates on the heat transport data grid spanned by the data
+    std::int64_t NumYSlices = 0;
+    // { Xmin, Xmax, Ymin, Ymax, Zmin, Zmax } of the data
+    std::array<double, 6> XYZMinMax = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    double HT_deltax = 0.0;
+};
+
+bool checkTemperatureCacheFormat(std::string tempfile_thislayer);
+std::string getTemperatureCacheName(std::string tempfile_thislayer);
+std::uint64_t hashTemperatureFile(std::string tempfile_thislayer);
+TemperatureCacheHeader readTemperatureCacheHeader(std::string cachefile);
+bool checkTemperatureCacheCurrent(std::string cachefile, std::uint64_t SourceHash, double HT_deltax);
+void writeTemperatureCache(std::string tempfile_thislayer, std::string cachefile, double HT_deltax,
+                           std::uint64_t SourceHash);
+void parseTemperatureData_Cache(std::string cachefile, double HT_deltax, int LowerYBound, int UpperYBound,
+                                RawTemperatureData &RawData);
+
+#endif
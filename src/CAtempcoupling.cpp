@@ -0,0 +1,143 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include "CAtempcoupling.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <unistd.h>
+
+//*****************************************************************************/
+// Add NumPoints data points, given as consecutive x, y, z, tm, tl, cr values, to data set "Name" on this rank
+void addTemperaturePoints(TemperatureCoupling &Coupling, std::string Name, const double *XYZTemperaturePoints,
+                          long int NumPoints) {
+
+    std::vector<double> &DataSet = Coupling.DataSets[Name];
+    DataSet.insert(DataSet.end(), XYZTemperaturePoints, XYZTemperaturePoints + 6 * NumPoints);
+}
+
+// Add NumPoints data points, given as separate arrays of x, y, z, tm, tl, cr values, to data set "Name" on this rank
+void addTemperaturePoints(TemperatureCoupling &Coupling, std::string Name, const double *X, const double *Y,
+                          const double *Z, const double *TM, const double *TL, const double *CR, long int NumPoints) {
+
+    std::vector<double> &DataSet = Coupling.DataSets[Name];
+    DataSet.reserve(DataSet.size() + 6 * NumPoints);
+    for (long int DataPoint = 0; DataPoint < NumPoints; DataPoint++) {
+        DataSet.push_back(X[DataPoint]);
+        DataSet.push_back(Y[DataPoint]);
+        DataSet.push_back(Z[DataPoint]);
+        DataSet.push_back(TM[DataPoint]);
+        DataSet.push_back(TL[DataPoint]);
+        DataSet.push_back(CR[DataPoint]);
+    }
+}
+
+// Get the min and max x, y, and z coordinates of the data points added to data set "Name" on this rank, as
+// { Xmin, Xmax, Ymin, Ymax, Zmin, Zmax }
+std::array<double, 6> calcCoupledCoordinateMinMax(const TemperatureCoupling &Coupling, std::string Name) {
+
+    std::array<double, 6> XYZMinMax;
+    for (int n = 0; n < 3; n++) {
+        XYZMinMax[2 * n] = std::numeric_limits<double>::max();
+        XYZMinMax[2 * n + 1] = std::numeric_limits<double>::lowest();
+    }
+    const std::vector<double> &DataSet = Coupling.DataSets.at(Name);
+    long int NumPoints = DataSet.size() / 6;
+    for (long int DataPoint = 0; DataPoint < NumPoints; DataPoint++) {
+        for (int n = 0; n < 3; n++) {
+            XYZMinMax[2 * n] = std::min(XYZMinMax[2 * n], DataSet[6 * DataPoint + n]);
+            XYZMinMax[2 * n + 1] = std::max(XYZMinMax[2 * n + 1], DataSet[6 * DataPoint + n]);
+        }
+    }
+    return XYZMinMax;
+}
+
+// Append the x, y, z, tm, tl, cr values for each data point added to data set "Name" on this rank to RankData[Rank] for
+// each MPI rank whose Y bounds (LowerYBounds[Rank] through UpperYBounds[Rank], in increasing order with rank) contain
+// the point
+void binCoupledTemperatureData(const TemperatureCoupling &Coupling, std::string Name, double YMin, double deltax,
+                               std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds,
+                               std::vector<std::vector<double>> &RankData) {
+
+    int np = LowerYBounds.size();
+    const std::vector<double> &DataSet = Coupling.DataSets.at(Name);
+    long int NumPoints = DataSet.size() / 6;
+    for (long int DataPoint = 0; DataPoint < NumPoints; DataPoint++) {
+        const double *XYZTemperaturePoint = DataSet.data() + 6 * DataPoint;
+        // The first rank whose upper Y bound is at or above the point, and any following ranks whose Y bounds overlap
+        // with it, should store the point
+        int YInt = round((XYZTemperaturePoint[1] - YMin) / deltax);
+        int Rank = std::lower_bound(UpperYBounds.begin(), UpperYBounds.end(), YInt) - UpperYBounds.begin();
+        while ((Rank < np) && (LowerYBounds[Rank] <= YInt)) {
+            RankData[Rank].insert(RankData[Rank].end(), XYZTemperaturePoint, XYZTemperaturePoint + 6);
+            Rank++;
+        }
+    }
+}
+
+//*****************************************************************************/
+// Stand-in for a coupled heat transport code: data points are written to a pipe (or FIFO, or socket) by the producer
+// and read from it into a data set by ExaCA, as consecutive x, y, z, tm, tl, cr values in native byte order (the same
+// layout as a .catemp file)
+
+// Write NumPoints data points, given as consecutive x, y, z, tm, tl, cr values, to FileDescriptor
+void sendTemperaturePoints(int FileDescriptor, const double *XYZTemperaturePoints, long int NumPoints) {
+
+    const char *Bytes = reinterpret_cast<const char *>(XYZTemperaturePoints);
+    std::size_t BytesLeft = 6 * NumPoints * sizeof(double);
+    while (BytesLeft > 0) {
+        ssize_t BytesWritten = write(FileDescriptor, Bytes, BytesLeft);
+        if (BytesWritten == -1) {
+            if (errno == EINTR)
+                continue;
+            throw std::runtime_error("Error: Could not send temperature data points: " +
+                                     std::string(std::strerror(errno)));
+        }
+        Bytes += BytesWritten;
+        BytesLeft -= BytesWritten;
+    }
+}
+
+// Read data points from FileDescriptor until the writing end is closed, adding them to data set "Name" on this rank as
+// they arrive. Returns the number of data points read
+long int receiveTemperaturePoints(TemperatureCoupling &Coupling, std::string Name, int FileDescriptor) {
+
+    // Data set is added even if no points are received
+    Coupling.DataSets[Name];
+    const int BatchSize = 4096;
+    std::vector<double> Batch(6 * BatchSize);
+    char *BatchBytes = reinterpret_cast<char *>(Batch.data());
+    std::size_t BatchBytesSize = Batch.size() * sizeof(double);
+    // Number of bytes currently in the batch buffer, which may end with part of a data point
+    std::size_t BytesInBatch = 0;
+    long int NumPoints = 0;
+    while (true) {
+        ssize_t BytesRead = read(FileDescriptor, BatchBytes + BytesInBatch, BatchBytesSize - BytesInBatch);
+        if (BytesRead == -1) {
+            if (errno == EINTR)
+                continue;
+            throw std::runtime_error("Error: Could not receive temperature data points: " +
+                                     std::string(std::strerror(errno)));
+        }
+        if (BytesRead == 0)
+            break;
+        BytesInBatch += BytesRead;
+        // Add the complete data points, keeping any partial data point at the start of the buffer
+        long int BatchPoints = BytesInBatch / (6 * sizeof(double));
+        addTemperaturePoints(Coupling, Name, Batch.data(), BatchPoints);
+        NumPoints += BatchPoints;
+        std::size_t BytesUsed = BatchPoints * 6 * sizeof(double);
+        std::memmove(BatchBytes, BatchBytes + BytesUsed, BytesInBatch - BytesUsed);
+        BytesInBatch -= BytesUsed;
+    }
+    if (BytesInBatch != 0)
+        throw std::runtime_error("Error: Incomplete temperature data point received for data set " + Name);
+    return NumPoints;
+}
@@ -0,0 +1,38 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_TEMPCOUPLING_HPP
+#define EXACA_TEMPCOUPLING_HPP
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+// Temperature data passed to ExaCA in memory by a coupled heat transport code, rather than written to and read back
+// from temperature files. Each data set is named, and is used in place of a temperature file wherever its name is
+// listed in the temperature instructions file. Data points can be added on any MPI rank, regardless of which rank(s)
+// will store them: when a data set is read, each point is sent to the rank(s) whose Y bounds contain it. Every rank
+// must add each data set, even if it adds no data points to it
+struct TemperatureCoupling {
+    // x, y, z, tm, tl, cr values for each data point added on this rank, for each data set
+    std::map<std::string, std::vector<double>> DataSets;
+
+    bool empty() const { return DataSets.empty(); }
+    bool hasDataSet(std::string Name) const { return (DataSets.count(Name) > 0); }
+};
+
+void addTemperaturePoints(TemperatureCoupling &Coupling, std::string Name, const double *XYZTemperaturePoints,
+                          long int NumPoints);
+void addTemperaturePoints(TemperatureCoupling &Coupling, std::string Name, const double *X, const double *Y,
+                          const double *Z, const double *TM, const double *TL, const double *CR, long int NumPoints);
+std::array<double, 6> calcCoupledCoordinateMinMax(const TemperatureCoupling &Coupling, std::string Name);
+void binCoupledTemperatureData(const TemperatureCoupling &Coupling, std::string Name, double YMin, double deltax,
+                               std::vector<int> &LowerYBounds, std::vector<int> &UpperYBounds,
+                               std::vector<std::vector<double>> &RankData);
+void sendTemperaturePoints(int FileDescriptor, const double *XYZTemperaturePoints, long int NumPoints);
+long int receiveTemperaturePoints(TemperatureCoupling &Coupling, std::string Name, int FileDescriptor);
+
+#endif
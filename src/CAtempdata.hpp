@@ -0,0 +1,80 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_TEMPDATA_HPP
+#define EXACA_TEMPDATA_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Temperature data points read from temperature files, with each value stored in a separate array. The x, y, z
+// coordinates of each point are converted to CA cell indices (relative to the cell at XMin, YMin, ZMin) when the point
+// is added, while the melting time, liquidus time, and cooling rate values are kept in double precision (storing times
+// as floats, even relative to the smallest time, would change the time step of some cells for realistic time steps)
+struct RawTemperatureData {
+
+    // Physical coordinates of CA cell (0, 0, 0) and the CA cell size
+    double XMin = 0.0;
+    double YMin = 0.0;
+    double ZMin = 0.0;
+    double deltax = 1.0;
+    std::vector<int> XInt, YInt, ZInt;
+    std::vector<double> TMelting, TLiquidus, CoolingRate;
+
+    RawTemperatureData() = default;
+    RawTemperatureData(double XMin_, double YMin_, double ZMin_, double deltax_)
+        : XMin(XMin_)
+        , YMin(YMin_)
+        , ZMin(ZMin_)
+        , deltax(deltax_) {}
+
+    // Number of data points stored
+    int size() const { return XInt.size(); }
+
+    // Size of the stored data, in bytes
+    std::size_t memorySize() const { return XInt.size() * (3 * sizeof(int) + 3 * sizeof(double)); }
+
+    void reserve(std::size_t NumPoints) {
+        XInt.reserve(NumPoints);
+        YInt.reserve(NumPoints);
+        ZInt.reserve(NumPoints);
+        TMelting.reserve(NumPoints);
+        TLiquidus.reserve(NumPoints);
+        CoolingRate.reserve(NumPoints);
+    }
+
+    // Add a data point given as x, y, z, tm, tl, cr values
+    void addPoint(const double *XYZTemperaturePoint) {
+        XInt.push_back(std::round((XYZTemperaturePoint[0] - XMin) / deltax));
+        YInt.push_back(std::round((XYZTemperaturePoint[1] - YMin) / deltax));
+        ZInt.push_back(std::round((XYZTemperaturePoint[2] - ZMin) / deltax));
+        TMelting.push_back(XYZTemperaturePoint[3]);
+        TLiquidus.push_back(XYZTemperaturePoint[4]);
+        CoolingRate.push_back(XYZTemperaturePoint[5]);
+    }
+
+    // Add the data points from OtherData, which must use the same CA grid
+    void append(const RawTemperatureData &OtherData) {
+        XInt.insert(XInt.end(), OtherData.XInt.begin(), OtherData.XInt.end());
+        YInt.insert(YInt.end(), OtherData.YInt.begin(), OtherData.YInt.end());
+        ZInt.insert(ZInt.end(), OtherData.ZInt.begin(), OtherData.ZInt.end());
+        TMelting.insert(TMelting.end(), OtherData.TMelting.begin(), OtherData.TMelting.end());
+        TLiquidus.insert(TLiquidus.end(), OtherData.TLiquidus.begin(), OtherData.TLiquidus.end());
+        CoolingRate.insert(CoolingRate.end(), OtherData.CoolingRate.begin(), OtherData.CoolingRate.end());
+    }
+
+    // Release memory held by the data points
+    void clear() {
+        XInt = std::vector<int>();
+        YInt = std::vector<int>();
+        ZInt = std::vector<int>();
+        TMelting = std::vector<double>();
+        TLiquidus = std::vector<double>();
+        CoolingRate = std::vector<double>();
+    }
+};
+
+#endif
@@ -0,0 +1,45 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include "CAtempprefetch.hpp"
+#include "CAinitialize.hpp"
+
+//*****************************************************************************/
+// Start reading the temperature data for layer "layernumber" (if it exists) on a background host thread, keeping the
+// data points within this rank's Y bounds. Any read already in progress must have been finished first
+void startTemperaturePrefetch(TemperaturePrefetch &Prefetch, int layernumber, int NumberOfLayers,
+                              int TempFilesInSeries, std::vector<std::string> &temp_paths, double XMin, double YMin,
+                              double ZMin, double deltax, double HT_deltax, int HTtoCAratio, int MyYSlices,
+                              int MyYOffset) {
+
+    if (layernumber >= NumberOfLayers)
+        return;
+    int LowerYBound, UpperYBound;
+    calcTemperatureYBounds(HTtoCAratio, MyYSlices, MyYOffset, LowerYBound, UpperYBound);
+    std::string tempfile_thislayer = temp_paths[layernumber % TempFilesInSeries];
+    Prefetch.layernumber = layernumber;
+    // Parse ASCII data serially on the background thread, as the host execution space is in use by the main thread
+    Prefetch.RawData = std::async(std::launch::async, [=]() {
+        RawTemperatureData RawData(XMin, YMin, ZMin, deltax);
+        readTemperatureFile(tempfile_thislayer, HT_deltax, LowerYBound, UpperYBound, RawData, false);
+        return RawData;
+    });
+}
+
+// If the temperature data for layer "layernumber" is being read in the background, wait for the read to finish and
+// hand the data off to RawData, in the same form as from ReadTemperatureData with LayerwiseTempRead. Returns false if
+// this layer's data was not being read, in which case it should be read with ReadTemperatureData
+bool finishTemperaturePrefetch(TemperaturePrefetch &Prefetch, int layernumber, RawTemperatureData &RawData,
+                               int *FirstValue, int *LastValue) {
+
+    if (Prefetch.layernumber != layernumber)
+        return false;
+    // Any exception thrown while reading the file is rethrown here
+    RawData = Prefetch.RawData.get();
+    Prefetch.layernumber = -1;
+    FirstValue[layernumber] = 0;
+    LastValue[layernumber] = RawData.size();
+    return true;
+}
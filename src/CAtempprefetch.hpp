@@ -0,0 +1,31 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_TEMPPREFETCH_HPP
+#define EXACA_TEMPPREFETCH_HPP
+
+#include "CAtempdata.hpp"
+
+#include <future>
+#include <string>
+#include <vector>
+
+// Temperature data for an upcoming layer, read from its temperature file on a background host thread while the
+// current layer solidifies. The background thread only reads, parses, and filters the data within this rank's Y
+// bounds; it makes no MPI or Kokkos calls
+struct TemperaturePrefetch {
+    // Layer whose temperature data is being read, or -1 if no data is being read
+    int layernumber = -1;
+    std::future<RawTemperatureData> RawData;
+};
+
+void startTemperaturePrefetch(TemperaturePrefetch &Prefetch, int layernumber, int NumberOfLayers,
+                              int TempFilesInSeries, std::vector<std::string> &temp_paths, double XMin, double YMin,
+                              double ZMin, double deltax, double HT_deltax, int HTtoCAratio, int MyYSlices,
+                              int MyYOffset);
+bool finishTemperaturePrefetch(TemperaturePrefetch &Prefetch, int layernumber, RawTemperatureData &RawData,
+                               int *FirstValue, int *LastValue);
+
+#endif
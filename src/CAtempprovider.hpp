@@ -0,0 +1,367 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_TEMPPROVIDER_HPP
+#define EXACA_TEMPPROVIDER_HPP
+
+#include "CAtypes.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// Analytic temperature fields, evaluated for each cell on the device rather than stored as data. Each provider gives
+// the number of times that the cell at X coordinate i, global Y coordinate j, and Z coordinate k (relative to the
+// bottom of the layer) melts and goes back below the liquidus during a layer, and the melting time step, liquidus time
+// step, and undercooling change per time step of each of these solidification events, in order of melting time:
+//   KOKKOS_INLINE_FUNCTION int numEvents(const int i, const int j, const int k) const;
+//   KOKKOS_INLINE_FUNCTION void getEvent(const int i, const int j, const int k, const int EventNumber,
+//                                        int &MeltTimeStep, int &CritTimeStep, float &UndercoolingChange) const;
+// Providers are copied to the device by value, and are used by TempInit_ProviderNoRemelt and TempInit_ProviderRemelt
+
+//*****************************************************************************/
+// Directional solidification: a fixed thermal gradient G in Z, with all cells cooling at rate R. Cells at the bottom
+// surface (Z = 0) are at the liquidus at time step 0
+struct DirSolidificationProvider {
+
+    double G, R, deltax, deltat;
+
+    DirSolidificationProvider(double G, double R, double deltax, double deltat)
+        : G(G)
+        , R(R)
+        , deltax(deltax)
+        , deltat(deltat) {}
+
+    KOKKOS_INLINE_FUNCTION int numEvents(const int, const int, const int) const { return 1; }
+
+    KOKKOS_INLINE_FUNCTION void getEvent(const int, const int, const int k, const int, int &MeltTimeStep,
+                                         int &CritTimeStep, float &UndercoolingChange) const {
+        MeltTimeStep = 0;
+        CritTimeStep = (int)((k * G * deltax) / (R * deltat));
+        UndercoolingChange = R * deltat;
+    }
+};
+
+//*****************************************************************************/
+// An array of NSpotsX by NSpotsY overlapping hemispherical spot melts, SpotOffset cells apart, melted one after
+// another. The outer edge of each spot is initialized at the liquidus temperature, and the spot cools at constant rate
+// R with radial thermal gradient G. The next spot starts once the previous spot has entirely gone below the solidus
+struct SpotArrayProvider {
+
+    int NSpotsX, NSpotsY, NumberOfSpots, SpotRadius, SpotOffset;
+    float IsothermVelocity; // in cells per time step
+    int TimeBetweenSpots;   // in time steps
+    double R, deltat;
+
+    SpotArrayProvider(double G, double R, double deltax, double deltat, double FreezingRange, int NSpotsX, int NSpotsY,
+                      int SpotRadius, int SpotOffset)
+        : NSpotsX(NSpotsX)
+        , NSpotsY(NSpotsY)
+        , NumberOfSpots(NSpotsX * NSpotsY)
+        , SpotRadius(SpotRadius)
+        , SpotOffset(SpotOffset)
+        , R(R)
+        , deltat(deltat) {
+        IsothermVelocity = (R / G) * deltat / deltax;
+        TimeBetweenSpots = SpotRadius / IsothermVelocity + (FreezingRange / R) / deltat;
+    }
+
+    // Distance (in cells) of the cell from the center of spot number Spot, at the top of the layer
+    KOKKOS_INLINE_FUNCTION float calcSpotDistance(const int Spot, const int i, const int j, const int k) const {
+        int XSpotPos = SpotRadius + (Spot % NSpotsX) * SpotOffset;
+        int YSpotPos = SpotRadius + (Spot / NSpotsX) * SpotOffset;
+        float DistX = (float)(XSpotPos - i);
+        float DistY = (float)(YSpotPos - j);
+        float DistZ = (float)(SpotRadius - k);
+        return sqrt(DistX * DistX + DistY * DistY + DistZ * DistZ);
+    }
+
+    // Rows (or columns) of spots, out of NSpots, whose centers are within SpotRadius of coordinate Coord in Y (or X)
+    KOKKOS_INLINE_FUNCTION void getSpotRange(const int Coord, const int NSpots, int &FirstSpot, int &LastSpot) const {
+        if (SpotOffset <= 0) {
+            // All spots are centered at the same coordinate
+            FirstSpot = 0;
+            LastSpot = NSpots - 1;
+            return;
+        }
+        int SpotPosOffset = Coord - 2 * SpotRadius;
+        FirstSpot = (SpotPosOffset <= 0) ? 0 : (SpotPosOffset + SpotOffset - 1) / SpotOffset;
+        LastSpot = (Coord < 0) ? -1 : Coord / SpotOffset;
+        if (LastSpot > NSpots - 1)
+            LastSpot = NSpots - 1;
+    }
+
+    // Get the EventNumber-th time that the cell melts and goes below the liquidus (if EventNumber is less than the
+    // number of events), returning the number of events up to and including it. Only the spots near the cell in X and
+    // Y are checked, in the order that they are melted
+    KOKKOS_INLINE_FUNCTION int calcEvent(const int i, const int j, const int k, const int EventNumber,
+                                         int &MeltTimeStep, int &CritTimeStep, float &UndercoolingChange) const {
+        int NumEvents = 0;
+        int FirstSpotX, LastSpotX, FirstSpotY, LastSpotY;
+        getSpotRange(i, NSpotsX, FirstSpotX, LastSpotX);
+        getSpotRange(j, NSpotsY, FirstSpotY, LastSpotY);
+        for (int SpotY = FirstSpotY; SpotY <= LastSpotY; SpotY++) {
+            for (int SpotX = FirstSpotX; SpotX <= LastSpotX; SpotX++) {
+                int Spot = SpotY * NSpotsX + SpotX;
+                float TotDist = calcSpotDistance(Spot, i, j, k);
+                if (TotDist <= SpotRadius) {
+                    if (NumEvents == EventNumber) {
+                        MeltTimeStep = 1 + TimeBetweenSpots * Spot;
+                        CritTimeStep =
+                            1 + (int)(((float)(SpotRadius)-TotDist) / IsothermVelocity) + TimeBetweenSpots * Spot;
+                        UndercoolingChange = R * deltat;
+                        return NumEvents + 1;
+                    }
+                    NumEvents++;
+                }
+            }
+        }
+        return NumEvents;
+    }
+
+    KOKKOS_INLINE_FUNCTION int numEvents(const int i, const int j, const int k) const {
+        int MeltTimeStep = 0, CritTimeStep = 0;
+        float UndercoolingChange = 0.0;
+        return calcEvent(i, j, k, NumberOfSpots, MeltTimeStep, CritTimeStep, UndercoolingChange);
+    }
+
+    KOKKOS_INLINE_FUNCTION void getEvent(const int i, const int j, const int k, const int EventNumber,
+                                         int &MeltTimeStep, int &CritTimeStep, float &UndercoolingChange) const {
+        calcEvent(i, j, k, EventNumber, MeltTimeStep, CritTimeStep, UndercoolingChange);
+    }
+};
+
+//*****************************************************************************/
+// A point heat source moving at constant speed along NumberOfTracks parallel raster tracks in X, each TrackLength cells
+// long and HatchSpacing cells apart in Y, alternating in direction. Each track starts as soon as the previous one ends,
+// with its temperature field given by the quasi-steady Rosenthal solution for a moving point source on a semi-infinite
+// body at the preheat temperature. The melt pool cross-section is a half-disc of radius PoolRadius cells, so track n
+// runs along Y = PoolRadius + n * HatchSpacing at the top of the layer (Z = PoolRadius relative to the layer bottom).
+// The fields of different tracks are not superimposed: a track that melts a cell again before it has gone below the
+// liquidus from the previous track extends that solidification event instead
+struct RosenthalRasterProvider {
+
+    // Absorbed beam power (W), scan speed (m/s), thermal conductivity (W/m-K), thermal diffusivity (m^2/s), and the
+    // preheat and liquidus temperatures (K)
+    double AbsorbedPower = 0.0;
+    double ScanSpeed = 0.0;
+    double Conductivity = 0.0;
+    double Diffusivity = 0.0;
+    double PreheatTemperature = 0.0;
+    double LiquidusTemperature = 0.0;
+    // Track length and hatch spacing (in cells), and the number of tracks in each layer
+    int TrackLength = 0;
+    int HatchSpacing = 1;
+    int NumberOfTracks = 0;
+    double deltax = 0.0;
+    double deltat = 0.0;
+    // Temperature rise above the preheat temperature is PeakScale / Dist * exp(-DecayRate * (Xi + Dist)), where Xi is
+    // the distance ahead of the source along the track and Dist is the distance from the source
+    double PeakScale = 0.0;
+    double DecayRate = 0.0;
+    double LiquidusRise = 0.0;
+    // Time for the source to cross one track (s)
+    double TrackTime = 0.0;
+    // Largest distance from the track centerline (m, and rounded down to cells) that reaches the liquidus
+    double MaxMeltDistance = 0.0;
+    int PoolRadius = 0;
+
+    RosenthalRasterProvider() = default;
+
+    RosenthalRasterProvider(double AbsorbedPower, double ScanSpeed, double Conductivity, double Diffusivity,
+                            double PreheatTemperature, double LiquidusTemperature, int TrackLength, int HatchSpacing,
+                            int NumberOfTracks, double deltax, double deltat)
+        : AbsorbedPower(AbsorbedPower)
+        , ScanSpeed(ScanSpeed)
+        , Conductivity(Conductivity)
+        , Diffusivity(Diffusivity)
+        , PreheatTemperature(PreheatTemperature)
+        , LiquidusTemperature(LiquidusTemperature)
+        , TrackLength(TrackLength)
+        , HatchSpacing(HatchSpacing)
+        , NumberOfTracks(NumberOfTracks)
+        , deltax(deltax)
+        , deltat(deltat) {
+
+        if ((AbsorbedPower <= 0.0) || (ScanSpeed <= 0.0) || (Conductivity <= 0.0) || (Diffusivity <= 0.0))
+            throw std::runtime_error("Error: Absorbed beam power, scan speed, thermal conductivity, and thermal "
+                                     "diffusivity must be larger than 0");
+        if (LiquidusTemperature <= PreheatTemperature)
+            throw std::runtime_error("Error: Preheat temperature must be below the liquidus temperature");
+        if ((TrackLength < 1) || (HatchSpacing < 1) || (NumberOfTracks < 1))
+            throw std::runtime_error("Error: Track length and hatch spacing must be at least one CA cell, and there "
+                                     "must be at least one track");
+        PeakScale = AbsorbedPower / (2.0 * M_PI * Conductivity);
+        DecayRate = ScanSpeed / (2.0 * Diffusivity);
+        LiquidusRise = LiquidusTemperature - PreheatTemperature;
+        TrackTime = TrackLength * deltax / ScanSpeed;
+        // The peak temperature reached decreases with distance from the track centerline: bracket the distance at
+        // which it reaches the liquidus, and bisect
+        double Low = 0.5 * deltax;
+        if (calcPeakTemperatureRise(Low) < LiquidusRise)
+            throw std::runtime_error("Error: Rosenthal melt pool for these inputs is smaller than one CA cell");
+        double High = 2.0 * Low;
+        while (calcPeakTemperatureRise(High) >= LiquidusRise) {
+            Low = High;
+            High *= 2.0;
+        }
+        for (int Iteration = 0; Iteration < 64; Iteration++) {
+            double Mid = 0.5 * (Low + High);
+            if (calcPeakTemperatureRise(Mid) >= LiquidusRise)
+                Low = Mid;
+            else
+                High = Mid;
+        }
+        MaxMeltDistance = Low;
+        PoolRadius = MaxMeltDistance / deltax;
+    }
+
+    // Temperature rise above the preheat temperature at distance Xi ahead of the source along the track (negative
+    // behind it) and distance Rho from the track centerline
+    KOKKOS_INLINE_FUNCTION double calcTemperatureRise(const double Xi, const double Rho) const {
+        double Dist = sqrt(Xi * Xi + Rho * Rho);
+        return PeakScale / Dist * exp(-DecayRate * (Xi + Dist));
+    }
+
+    // Derivative of the log of the temperature rise with respect to Xi
+    KOKKOS_INLINE_FUNCTION double calcLogSlope(const double Xi, const double Rho) const {
+        double Dist = sqrt(Xi * Xi + Rho * Rho);
+        return -Xi / (Dist * Dist) - DecayRate * (1.0 + Xi / Dist);
+    }
+
+    // Position along the track of the peak temperature at distance Rho from the centerline, which trails the source
+    KOKKOS_INLINE_FUNCTION double calcPeakPosition(const double Rho) const {
+        double Low = -(Rho + 1.0 / DecayRate);
+        while (calcLogSlope(Low, Rho) <= 0.0)
+            Low *= 2.0;
+        double High = 0.0;
+        for (int Iteration = 0; Iteration < 64; Iteration++) {
+            double Mid = 0.5 * (Low + High);
+            if (calcLogSlope(Mid, Rho) > 0.0)
+                Low = Mid;
+            else
+                High = Mid;
+        }
+        return 0.5 * (Low + High);
+    }
+
+    KOKKOS_INLINE_FUNCTION double calcPeakTemperatureRise(const double Rho) const {
+        return calcTemperatureRise(calcPeakPosition(Rho), Rho);
+    }
+
+    // Position along the track where the temperature at distance Rho from the centerline crosses the liquidus, between
+    // the peak position and Bound (ahead of the peak for the melting front, behind it for the liquidus isotherm at the
+    // back of the melt pool)
+    KOKKOS_INLINE_FUNCTION double calcLiquidusPosition(const double PeakPosition, double Bound,
+                                                       const double Rho) const {
+        double Above = PeakPosition;
+        while (calcTemperatureRise(Bound, Rho) >= LiquidusRise) {
+            Above = Bound;
+            Bound = PeakPosition + 2.0 * (Bound - PeakPosition);
+        }
+        for (int Iteration = 0; Iteration < 64; Iteration++) {
+            double Mid = 0.5 * (Above + Bound);
+            if (calcTemperatureRise(Mid, Rho) >= LiquidusRise)
+                Above = Mid;
+            else
+                Bound = Mid;
+        }
+        return 0.5 * (Above + Bound);
+    }
+
+    // Tracks whose melt pools could reach global Y coordinate j
+    KOKKOS_INLINE_FUNCTION void getTrackRange(const int j, int &FirstTrack, int &LastTrack) const {
+        int TrackOffset = j - 2 * PoolRadius;
+        FirstTrack = (TrackOffset <= 0) ? 0 : (TrackOffset + HatchSpacing - 1) / HatchSpacing;
+        LastTrack = j / HatchSpacing;
+        if (LastTrack > NumberOfTracks - 1)
+            LastTrack = NumberOfTracks - 1;
+    }
+
+    // Get the EventNumber-th time that the cell melts and goes below the liquidus (or the last such time, if
+    // EventNumber is at least the number of events), returning the number of events up to and including it
+    KOKKOS_INLINE_FUNCTION int calcEvent(const int i, const int j, const int k, const int EventNumber,
+                                         int &MeltTimeStep, int &CritTimeStep, float &UndercoolingChange) const {
+        int NumEvents = 0;
+        int FirstTrack, LastTrack;
+        getTrackRange(j, FirstTrack, LastTrack);
+        double DistZ = (PoolRadius - k) * deltax;
+        for (int Track = FirstTrack; Track <= LastTrack; Track++) {
+            double DistY = (j - PoolRadius - Track * HatchSpacing) * deltax;
+            double Rho = sqrt(DistY * DistY + DistZ * DistZ);
+            if (Rho > MaxMeltDistance)
+                continue;
+            // Avoid the singularity at the source for cells on the track centerline
+            if (Rho < 0.5 * deltax)
+                Rho = 0.5 * deltax;
+            double PeakPosition = calcPeakPosition(Rho);
+            double Spread = Rho + 1.0 / DecayRate;
+            double FrontPosition = calcLiquidusPosition(PeakPosition, PeakPosition + Spread, Rho);
+            double BackPosition = calcLiquidusPosition(PeakPosition, PeakPosition - Spread, Rho);
+            // Distance of the cell from the start of the track, with even tracks scanned in +X and odd tracks in -X.
+            // Cells already above the liquidus when the track starts melt at its start
+            double TrackPosition = ((Track % 2 == 0) ? i : TrackLength - i) * deltax;
+            double TrackStartTime = Track * TrackTime;
+            double MeltTime = TrackStartTime;
+            if (TrackPosition > FrontPosition)
+                MeltTime += (TrackPosition - FrontPosition) / ScanSpeed;
+            double LiquidusTime = TrackStartTime + (TrackPosition - BackPosition) / ScanSpeed;
+            int TrackMeltTimeStep = 1 + (int)(MeltTime / deltat);
+            int TrackCritTimeStep = 1 + (int)(LiquidusTime / deltat);
+            if (TrackCritTimeStep <= TrackMeltTimeStep)
+                TrackCritTimeStep = TrackMeltTimeStep + 1;
+            // At the back of the melt pool, the cell cools at the scan speed times the temperature gradient along the
+            // track
+            float TrackUndercoolingChange = ScanSpeed * LiquidusRise * calcLogSlope(BackPosition, Rho) * deltat;
+            if ((NumEvents > 0) && (TrackMeltTimeStep <= CritTimeStep)) {
+                // Cell melts again before going below the liquidus from the previous track
+                if (TrackCritTimeStep > CritTimeStep) {
+                    CritTimeStep = TrackCritTimeStep;
+                    UndercoolingChange = TrackUndercoolingChange;
+                }
+            }
+            else {
+                if (NumEvents == EventNumber + 1)
+                    break;
+                MeltTimeStep = TrackMeltTimeStep;
+                CritTimeStep = TrackCritTimeStep;
+                UndercoolingChange = TrackUndercoolingChange;
+                NumEvents++;
+            }
+        }
+        return NumEvents;
+    }
+
+    KOKKOS_INLINE_FUNCTION int numEvents(const int i, const int j, const int k) const {
+        int MeltTimeStep = 0, CritTimeStep = 0;
+        float UndercoolingChange = 0.0;
+        return calcEvent(i, j, k, NumberOfTracks, MeltTimeStep, CritTimeStep, UndercoolingChange);
+    }
+
+    KOKKOS_INLINE_FUNCTION void getEvent(const int i, const int j, const int k, const int EventNumber,
+                                         int &MeltTimeStep, int &CritTimeStep, float &UndercoolingChange) const {
+        calcEvent(i, j, k, EventNumber, MeltTimeStep, CritTimeStep, UndercoolingChange);
+    }
+
+    std::string print() const {
+        std::stringstream out;
+        out << "Absorbed beam power (W): " << AbsorbedPower << std::endl;
+        out << "Scan speed (m/s): " << ScanSpeed << std::endl;
+        out << "Thermal conductivity (W/m-K): " << Conductivity << std::endl;
+        out << "Thermal diffusivity (m^2/s): " << Diffusivity << std::endl;
+        out << "Preheat temperature (K): " << PreheatTemperature << std::endl;
+        out << "Liquidus temperature (K): " << LiquidusTemperature << std::endl;
+        out << "Number of tracks per layer: " << NumberOfTracks << std::endl;
+        out << "Track length (in cells): " << TrackLength << std::endl;
+        out << "Hatch spacing (in cells): " << HatchSpacing << std::endl;
+        out << "Melt pool depth and half-width (in cells): " << PoolRadius;
+        return out.str();
+    }
+};
+
+#endif
@@ -0,0 +1,52 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include "CAtempstore.hpp"
+
+//*****************************************************************************/
+// Check if the data from temperature file tempfile_thislayer is stored
+bool checkStoredTemperatureData(TemperatureDataStore &Store, std::string tempfile_thislayer) {
+
+    for (auto &StoredFile : Store.StoredFiles) {
+        if (StoredFile.first == tempfile_thislayer)
+            return true;
+    }
+    return false;
+}
+
+// If the data from temperature file tempfile_thislayer is stored, copy it to RawData for layer "layernumber", in the
+// same form as from ReadTemperatureData with LayerwiseTempRead, and mark it as the most recently used. Returns false if
+// this file's data is not stored, in which case it should be read from the file
+bool getStoredTemperatureData(TemperatureDataStore &Store, std::string tempfile_thislayer, int layernumber,
+                              RawTemperatureData &RawData, int *FirstValue, int *LastValue) {
+
+    for (auto StoredFile = Store.StoredFiles.begin(); StoredFile != Store.StoredFiles.end(); StoredFile++) {
+        if (StoredFile->first == tempfile_thislayer) {
+            Store.StoredFiles.splice(Store.StoredFiles.begin(), Store.StoredFiles, StoredFile);
+            RawData = StoredFile->second;
+            FirstValue[layernumber] = 0;
+            LastValue[layernumber] = RawData.size();
+            return true;
+        }
+    }
+    return false;
+}
+
+// Store a copy of RawData, read from temperature file tempfile_thislayer, as the most recently used data. Data from the
+// least recently used files is removed as needed to stay within the memory limit, and the data is not stored if it is
+// larger than the memory limit by itself
+void storeTemperatureData(TemperatureDataStore &Store, std::string tempfile_thislayer,
+                          const RawTemperatureData &RawData) {
+
+    std::size_t DataSize = RawData.memorySize();
+    if ((DataSize > Store.MemoryLimit) || (checkStoredTemperatureData(Store, tempfile_thislayer)))
+        return;
+    while (Store.MemoryUsed + DataSize > Store.MemoryLimit) {
+        Store.MemoryUsed -= Store.StoredFiles.back().second.memorySize();
+        Store.StoredFiles.pop_back();
+    }
+    Store.StoredFiles.emplace_front(tempfile_thislayer, RawData);
+    Store.MemoryUsed += DataSize;
+}
@@ -0,0 +1,33 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_TEMPSTORE_HPP
+#define EXACA_TEMPSTORE_HPP
+
+#include "CAtempdata.hpp"
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <utility>
+
+// Temperature data (the data points within an MPI rank's Y bounds) from temperature files read during previous layers,
+// kept so that later layers using the same file don't reread it. When storing a file's data would exceed the memory
+// limit, data from the least recently used files is removed
+struct TemperatureDataStore {
+    // Maximum size of the stored data, in bytes
+    std::size_t MemoryLimit = 0;
+    std::size_t MemoryUsed = 0;
+    // Temperature file names and data, ordered from most to least recently used
+    std::list<std::pair<std::string, RawTemperatureData>> StoredFiles;
+};
+
+bool checkStoredTemperatureData(TemperatureDataStore &Store, std::string tempfile_thislayer);
+bool getStoredTemperatureData(TemperatureDataStore &Store, std::string tempfile_thislayer, int layernumber,
+                              RawTemperatureData &RawData, int *FirstValue, int *LastValue);
+void storeTemperatureData(TemperatureDataStore &Store, std::string tempfile_thislayer,
+                          const RawTemperatureData &RawData);
+
+#endif
@@ -0,0 +1,214 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include "CAtempstream.hpp"
+
+#include "CAinitialize.hpp"
+#include "CAupdate.hpp"
+
+#include <algorithm>
+
+//*****************************************************************************/
+// Time step at which event "NextEvent" of the stream should be loaded, or INT_MAX if all events have been loaded
+int calcNextLoadTimeStep(const TemperatureEventStream &EventStream) {
+
+    if (EventStream.NextEvent == static_cast<int>(EventStream.EventOrder.size()))
+        return INT_MAX;
+    int NextMeltTimeStep =
+        static_cast<int>(EventStream.LayerTimeTempHistory_Host(EventStream.EventOrder[EventStream.NextEvent], 0));
+    return NextMeltTimeStep - EventStream.WindowSize;
+}
+
+//*****************************************************************************/
+// Remap the streamed layer's events, initialized for all cells in the layer's Z bounds, to the cells of the active
+// region, and allocate the device ring buffer with one slot per cell. No events other than each cell's first are on
+// the device until loadEventWindow is called
+void TrimEventStreamToActiveRegion(int nx, int MyYSlices, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                                   int nyActive, TemperatureEventStream &EventStream, ViewF2D &LayerTimeTempHistory,
+                                   ViewI &NumberOfSolidificationEvents, ViewI &SolidificationEventOffset,
+                                   ViewI &SolidificationEventCounter) {
+
+    int LocalActiveDomainSize = nxActive * nyActive * nzActive;
+    ViewI_H NumberOfSolidificationEvents_Active(Kokkos::ViewAllocateWithoutInitializing("NumSEvents_H"),
+                                                LocalActiveDomainSize);
+    ViewI_H SolidificationEventOffset_Active(Kokkos::ViewAllocateWithoutInitializing("SEventOffset_H"),
+                                             LocalActiveDomainSize + 1);
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LocalActiveDomainSize; D3D1ConvPosition++) {
+        int RankZ = D3D1ConvPosition / (nxActive * nyActive);
+        int Rem = D3D1ConvPosition % (nxActive * nyActive);
+        int RankX = Rem / nyActive + XBound_Low;
+        int RankY = Rem % nyActive + YBound_Low;
+        int LayerD3D1ConvPosition = RankZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+        NumberOfSolidificationEvents_Active(D3D1ConvPosition) =
+            EventStream.NumberOfSolidificationEvents_Host(LayerD3D1ConvPosition);
+    }
+    int NumberOfEvents_Active = calcSolidificationEventOffsets(
+        LocalActiveDomainSize, NumberOfSolidificationEvents_Active, SolidificationEventOffset_Active);
+    ViewF2D_H LayerTimeTempHistory_Active(Kokkos::ViewAllocateWithoutInitializing("TimeTempHistory_H"),
+                                          NumberOfEvents_Active, 3);
+    EventStream.EventOrder.clear();
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LocalActiveDomainSize; D3D1ConvPosition++) {
+        int RankZ = D3D1ConvPosition / (nxActive * nyActive);
+        int Rem = D3D1ConvPosition % (nxActive * nyActive);
+        int RankX = Rem / nyActive + XBound_Low;
+        int RankY = Rem % nyActive + YBound_Low;
+        int LayerD3D1ConvPosition = RankZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+        int FirstEvent_Active = SolidificationEventOffset_Active(D3D1ConvPosition);
+        int FirstEvent_Layer = EventStream.SolidificationEventOffset_Host(LayerD3D1ConvPosition);
+        for (int n = 0; n < NumberOfSolidificationEvents_Active(D3D1ConvPosition); n++) {
+            for (int l = 0; l < 3; l++)
+                LayerTimeTempHistory_Active(FirstEvent_Active + n, l) =
+                    EventStream.LayerTimeTempHistory_Host(FirstEvent_Layer + n, l);
+            if (n > 0)
+                EventStream.EventOrder.push_back(FirstEvent_Active + n);
+        }
+    }
+    EventStream.NumberOfSolidificationEvents_Host = NumberOfSolidificationEvents_Active;
+    EventStream.SolidificationEventOffset_Host = SolidificationEventOffset_Active;
+    EventStream.LayerTimeTempHistory_Host = LayerTimeTempHistory_Active;
+    // Events are loaded in order of melting time
+    std::stable_sort(EventStream.EventOrder.begin(), EventStream.EventOrder.end(), [&](const int &a, const int &b) {
+        return (LayerTimeTempHistory_Active(a, 0) < LayerTimeTempHistory_Active(b, 0));
+    });
+    EventStream.NextEvent = 0;
+    EventStream.NextLoadTimeStep = calcNextLoadTimeStep(EventStream);
+
+    // Each cell starts with a single empty ring buffer slot: a melting time of 0 marks a slot without an event
+    EventStream.EventSlots = 1;
+    NumberOfSolidificationEvents =
+        Kokkos::create_mirror_view_and_copy(device_memory_space(), NumberOfSolidificationEvents_Active);
+    Kokkos::realloc(SolidificationEventOffset, LocalActiveDomainSize + 1);
+    ViewI SolidificationEventOffset_Local = SolidificationEventOffset;
+    Kokkos::parallel_for(
+        "RingSEventOffsets", LocalActiveDomainSize + 1, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+            SolidificationEventOffset_Local(D3D1ConvPosition) = D3D1ConvPosition;
+        });
+    LayerTimeTempHistory = ViewF2D("TimeTempHistory", LocalActiveDomainSize, 3);
+    // Solidification event counter starts at 0 for each cell
+    Kokkos::realloc(SolidificationEventCounter, LocalActiveDomainSize);
+    Kokkos::deep_copy(SolidificationEventCounter, 0);
+}
+
+//*****************************************************************************/
+// Resize the device ring buffer to "EventSlots" slots per cell, moving each cell's loaded events to their slots in the
+// new buffer. A cell's unused events follow the one given by its solidification event counter, event "j" being stored
+// in slot "j" modulo the number of slots
+void growEventSlots(int LocalActiveDomainSize, int EventSlots, ViewF2D &LayerTimeTempHistory,
+                    ViewI SolidificationEventOffset, ViewI SolidificationEventCounter) {
+
+    ViewF2D LayerTimeTempHistory_Old = LayerTimeTempHistory;
+    ViewF2D LayerTimeTempHistory_New("TimeTempHistory", LocalActiveDomainSize * EventSlots, 3);
+    Kokkos::parallel_for(
+        "GrowSEventSlots", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+            int FirstSlot = SolidificationEventOffset(D3D1ConvPosition);
+            int OldSlots = SolidificationEventOffset(D3D1ConvPosition + 1) - FirstSlot;
+            int FirstUnusedEvent = SolidificationEventCounter(D3D1ConvPosition) + 1;
+            for (int s = 0; s < OldSlots; s++) {
+                if (LayerTimeTempHistory_Old(FirstSlot + s, 0) > 0) {
+                    int Event = FirstUnusedEvent + ((s - FirstUnusedEvent % OldSlots) + OldSlots) % OldSlots;
+                    int NewSlot = D3D1ConvPosition * EventSlots + Event % EventSlots;
+                    for (int l = 0; l < 3; l++)
+                        LayerTimeTempHistory_New(NewSlot, l) = LayerTimeTempHistory_Old(FirstSlot + s, l);
+                }
+            }
+        });
+    Kokkos::fence();
+    Kokkos::parallel_for(
+        "RingSEventOffsets", LocalActiveDomainSize + 1, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
+            SolidificationEventOffset(D3D1ConvPosition) = D3D1ConvPosition * EventSlots;
+        });
+    LayerTimeTempHistory = LayerTimeTempHistory_New;
+}
+
+//*****************************************************************************/
+// Load the streamed events melting within the next 2 * WindowSize time steps onto the device, and set the time step at
+// which the next events should be loaded (WindowSize time steps before the first of them melts). Events are stored in
+// the ring buffer slots of their cells, which is grown if a cell doesn't have enough slots, or if the cell already
+// solidified for the previous event and is waiting for this one, are placed in the cell's temperature fields directly
+void loadEventWindow(int cycle, TemperatureEventStream &EventStream, int nx, int MyYSlices, int ZBound_Low,
+                     int XBound_Low, int nxActive, int YBound_Low, int nyActive, int nzActive,
+                     ViewF2D &LayerTimeTempHistory, ViewI SolidificationEventOffset, ViewI SolidificationEventCounter,
+                     ViewI MeltTimeStep, ViewI CritTimeStep, ViewF UndercoolingChange, ViewI TileWakeTime) {
+
+    int LocalActiveDomainSize = nxActive * nyActive * nzActive;
+    int NumEventsTotal = EventStream.EventOrder.size();
+    int FirstEvent = EventStream.NextEvent;
+    int LastEvent = FirstEvent;
+    while ((LastEvent < NumEventsTotal) &&
+           (EventStream.LayerTimeTempHistory_Host(EventStream.EventOrder[LastEvent], 0) <=
+            cycle + 2 * EventStream.WindowSize))
+        LastEvent++;
+    int NumEventsWindow = LastEvent - FirstEvent;
+
+    // Cell, position among the cell's events, and TM, TL, CR values for each event in this window, copied to the device
+    ViewI_H EventCell_Host(Kokkos::ViewAllocateWithoutInitializing("EventCell_H"), NumEventsWindow);
+    ViewI_H EventNumber_Host(Kokkos::ViewAllocateWithoutInitializing("EventNumber_H"), NumEventsWindow);
+    ViewF2D_H EventData_Host(Kokkos::ViewAllocateWithoutInitializing("EventData_H"), NumEventsWindow, 3);
+    for (int n = 0; n < NumEventsWindow; n++) {
+        int Event = EventStream.EventOrder[FirstEvent + n];
+        int *CellEnd = std::upper_bound(EventStream.SolidificationEventOffset_Host.data(),
+                                        EventStream.SolidificationEventOffset_Host.data() + LocalActiveDomainSize + 1,
+                                        Event);
+        int D3D1ConvPosition = CellEnd - EventStream.SolidificationEventOffset_Host.data() - 1;
+        EventCell_Host(n) = D3D1ConvPosition;
+        EventNumber_Host(n) = Event - EventStream.SolidificationEventOffset_Host(D3D1ConvPosition);
+        for (int l = 0; l < 3; l++)
+            EventData_Host(n, l) = EventStream.LayerTimeTempHistory_Host(Event, l);
+    }
+    ViewI EventCell = Kokkos::create_mirror_view_and_copy(device_memory_space(), EventCell_Host);
+    ViewI EventNumber = Kokkos::create_mirror_view_and_copy(device_memory_space(), EventNumber_Host);
+    ViewF2D EventData = Kokkos::create_mirror_view_and_copy(device_memory_space(), EventData_Host);
+
+    // Each cell needs enough slots for all loaded events after the one given by its solidification event counter
+    int SlotsNeeded = 0;
+    Kokkos::parallel_reduce(
+        "SEventSlotsNeeded", NumEventsWindow,
+        KOKKOS_LAMBDA(const int &n, int &LocalSlotsNeeded) {
+            int Slots = EventNumber(n) - SolidificationEventCounter(EventCell(n));
+            if (Slots > LocalSlotsNeeded)
+                LocalSlotsNeeded = Slots;
+        },
+        Kokkos::Max<int>(SlotsNeeded));
+    if (SlotsNeeded > EventStream.EventSlots) {
+        EventStream.EventSlots = std::max(SlotsNeeded, 2 * EventStream.EventSlots);
+        growEventSlots(LocalActiveDomainSize, EventStream.EventSlots, LayerTimeTempHistory, SolidificationEventOffset,
+                       SolidificationEventCounter);
+    }
+
+    ViewF2D LayerTimeTempHistory_Local = LayerTimeTempHistory;
+    int NumTilesX = calcNumTiles(nxActive);
+    int NumTilesY = calcNumTiles(nyActive);
+    Kokkos::parallel_for(
+        "LoadSEvents", NumEventsWindow, KOKKOS_LAMBDA(const int &n) {
+            int D3D1ConvPosition = EventCell(n);
+            if (SolidificationEventCounter(D3D1ConvPosition) == EventNumber(n)) {
+                // This cell is waiting for this event: initialize its temperature fields with it, and make sure that
+                // its tile is checked at the new melting time
+                int RankZ = D3D1ConvPosition / (nxActive * nyActive);
+                int Rem = D3D1ConvPosition % (nxActive * nyActive);
+                int ActiveX = Rem / nyActive;
+                int ActiveY = Rem % nyActive;
+                int GlobalD3D1ConvPosition =
+                    (RankZ + ZBound_Low) * nx * MyYSlices + (ActiveX + XBound_Low) * MyYSlices + (ActiveY + YBound_Low);
+                MeltTimeStep(GlobalD3D1ConvPosition) = (int)(EventData(n, 0));
+                CritTimeStep(GlobalD3D1ConvPosition) = (int)(EventData(n, 1));
+                UndercoolingChange(GlobalD3D1ConvPosition) = EventData(n, 2);
+                int TileIndex = (RankZ / TileSize) * NumTilesX * NumTilesY + (ActiveX / TileSize) * NumTilesY +
+                                ActiveY / TileSize;
+                Kokkos::atomic_min(&TileWakeTime(TileIndex), (int)(EventData(n, 0)));
+            }
+            else {
+                int FirstSlot = SolidificationEventOffset(D3D1ConvPosition);
+                int NumSlots = SolidificationEventOffset(D3D1ConvPosition + 1) - FirstSlot;
+                int Slot = FirstSlot + EventNumber(n) % NumSlots;
+                for (int l = 0; l < 3; l++)
+                    LayerTimeTempHistory_Local(Slot, l) = EventData(n, l);
+            }
+        });
+    Kokkos::fence();
+
+    EventStream.NextEvent = LastEvent;
+    EventStream.NextLoadTimeStep = calcNextLoadTimeStep(EventStream);
+}
@@ -0,0 +1,51 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef EXACA_TEMPSTREAM_HPP
+#define EXACA_TEMPSTREAM_HPP
+
+#include "CAtypes.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <climits>
+#include <vector>
+
+// Solidification events of a layer with remelting, streamed to the device in time windows rather than stored there for
+// the whole layer. Each cell's first event is placed in the temperature fields when the layer is initialized. Its
+// later events are kept on the host, and are loaded into a per-cell ring buffer of "EventSlots" slots on the device
+// (LayerTimeTempHistory) once the simulation is within WindowSize time steps of their melting time, so that device
+// memory depends on the number of events loaded but not yet reached rather than on the length of the layer
+struct TemperatureEventStream {
+    // Number of time steps before melting at which events are loaded (0 if events are not streamed)
+    int WindowSize = 0;
+    // The layer's events, stored like LayerTimeTempHistory without streaming: for each cell in the layer's Z bounds,
+    // and after TrimEventStreamToActiveRegion, for each cell in the active region
+    ViewI_H NumberOfSolidificationEvents_Host;
+    ViewI_H SolidificationEventOffset_Host;
+    ViewF2D_H LayerTimeTempHistory_Host;
+    // Positions in LayerTimeTempHistory_Host of all events other than the first of each cell, ordered by melting time
+    std::vector<int> EventOrder;
+    // Next event of EventOrder to load, and the time step at which it should be loaded
+    int NextEvent = 0;
+    int NextLoadTimeStep = INT_MAX;
+    // Number of ring buffer slots per cell
+    int EventSlots = 1;
+
+    bool streaming() const { return (WindowSize > 0); }
+};
+
+void TrimEventStreamToActiveRegion(int nx, int MyYSlices, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                                   int nyActive, TemperatureEventStream &EventStream, ViewF2D &LayerTimeTempHistory,
+                                   ViewI &NumberOfSolidificationEvents, ViewI &SolidificationEventOffset,
+                                   ViewI &SolidificationEventCounter);
+void growEventSlots(int LocalActiveDomainSize, int EventSlots, ViewF2D &LayerTimeTempHistory,
+                    ViewI SolidificationEventOffset, ViewI SolidificationEventCounter);
+void loadEventWindow(int cycle, TemperatureEventStream &EventStream, int nx, int MyYSlices, int ZBound_Low,
+                     int XBound_Low, int nxActive, int YBound_Low, int nyActive, int nzActive,
+                     ViewF2D &LayerTimeTempHistory, ViewI SolidificationEventOffset, ViewI SolidificationEventCounter,
+                     ViewI MeltTimeStep, ViewI CritTimeStep, ViewF UndercoolingChange, ViewI TileWakeTime);
+
+#endif
@@ -21,15 +21,19 @@ enum TypeNames {
 
 // Use Kokkos::DefaultExecutionSpace
 typedef Kokkos::View<float *> ViewF;
+typedef Kokkos::View<double *> ViewD;
 typedef Kokkos::View<int *> ViewI;
 typedef Kokkos::View<int **> ViewI2D;
 typedef Kokkos::View<int *, Kokkos::MemoryTraits<Kokkos::Atomic>> View_a;
 typedef Kokkos::View<double **> Buffer2D;
 typedef Kokkos::View<float *> TestView;
+typedef Kokkos::View<float **> ViewF2D;
 typedef Kokkos::View<float ***> ViewF3D;
 
 using exe_space = Kokkos::DefaultExecutionSpace::execution_space;
 using device_memory_space = Kokkos::DefaultExecutionSpace::memory_space;
+using team_policy = Kokkos::TeamPolicy<exe_space>;
+using team_member = team_policy::member_type;
 typedef typename exe_space::array_layout layout;
 typedef Kokkos::View<double *, layout, Kokkos::HostSpace> ViewD_H;
 typedef Kokkos::View<float *, layout, Kokkos::HostSpace> ViewF_H;
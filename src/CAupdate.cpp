@@ -18,7 +18,8 @@ using std::min;
 //*****************************************************************************/
 void Nucleation(int cycle, int &SuccessfulNucEvents_ThisRank, int &NucleationCounter, int PossibleNuclei_ThisRank,
                 ViewI_H NucleationTimes_H, ViewI NucleiLocations, ViewI NucleiGrainID, ViewI CellType, ViewI GrainID,
-                int ZBound_Low, int nx, int MyYSlices, ViewI SteeringVector, ViewI numSteer_G) {
+                int ZBound_Low, int nx, int MyYSlices, int XBound_Low, int nxActive, int YBound_Low, int nyActive,
+                ViewI SteeringVector, ViewI numSteer_G) {
 
     // Is there nucleation left in this layer to check?
     if (NucleationCounter < PossibleNuclei_ThisRank) {
@@ -60,7 +61,9 @@ void Nucleation(int cycle, int &SuccessfulNucEvents_ThisRank, int &NucleationCou
                         int RankX = Rem / MyYSlices;
                         int RankY = Rem % MyYSlices;
                         int RankZ = GlobalZ - ZBound_Low;
-                        int NucleationEventLocation_LocalGrid = RankZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+                        // Nucleation only occurs in liquid cells, which always lie within the active region bounds
+                        int NucleationEventLocation_LocalGrid =
+                            RankZ * nxActive * nyActive + (RankX - XBound_Low) * nyActive + (RankY - YBound_Low);
                         SteeringVector(Kokkos::atomic_fetch_add(&numSteer_G(0), 1)) = NucleationEventLocation_LocalGrid;
                         // This undercooled liquid cell is now a nuclei (no nuclei are in the ghost nodes - halo
                         // exchange routine GhostNodes1D or GhostNodes2D is used to fill these)
@@ -75,42 +78,93 @@ void Nucleation(int cycle, int &SuccessfulNucEvents_ThisRank, int &NucleationCou
     }
 }
 
+//*****************************************************************************/
+// Allocate the tile map for the current active region, marking all tiles as potentially having work
+void ResetTileWakeTimes(int nxActive, int nyActive, int nzActive, ViewI &TileWakeTime) {
+
+    int NumTiles = calcNumTiles(nxActive) * calcNumTiles(nyActive) * calcNumTiles(nzActive);
+    Kokkos::realloc(TileWakeTime, NumTiles);
+    Kokkos::deep_copy(TileWakeTime, 0);
+}
+
+//*****************************************************************************/
+// Recalculate the earliest time step at which each tile may have work to do, based on the current state of its cells.
+// Tiles already finished for this layer are skipped, as their cells cannot change type again until the next layer
+void UpdateTileWakeTimes(int cycle, int nx, int MyYSlices, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                         int nyActive, int ZBound_Low, int layernumber, bool RemeltingYN, ViewI CellType,
+                         ViewI CritTimeStep, ViewI MeltTimeStep, ViewI LayerID, ViewI TileWakeTime) {
+
+    int NumTiles = TileWakeTime.extent(0);
+    Kokkos::parallel_for(
+        "UpdateTiles", team_policy(NumTiles, Kokkos::AUTO), KOKKOS_LAMBDA(const team_member &TeamMember) {
+            int TileIndex = TeamMember.league_rank();
+            if (TileWakeTime(TileIndex) == INT_MAX)
+                return;
+            int TileWake;
+            Kokkos::parallel_reduce(
+                Kokkos::TeamThreadRange(TeamMember, TileVolume),
+                [&](const int &n, int &tilev) {
+                    int ActiveX, ActiveY, RankZ;
+                    if (getTileCellCoordinates(TileIndex, n, nxActive, nyActive, nzActive, ActiveX, ActiveY, RankZ)) {
+                        int GlobalD3D1ConvPosition = (RankZ + ZBound_Low) * nx * MyYSlices +
+                                                     (ActiveX + XBound_Low) * MyYSlices + (ActiveY + YBound_Low);
+                        int CellWake = calcCellWakeTime(GlobalD3D1ConvPosition, cycle, layernumber, RemeltingYN,
+                                                        CellType, CritTimeStep, MeltTimeStep, LayerID);
+                        if (CellWake < tilev)
+                            tilev = CellWake;
+                    }
+                },
+                Kokkos::Min<int>(TileWake));
+            Kokkos::single(Kokkos::PerTeam(TeamMember), [&]() { TileWakeTime(TileIndex) = TileWake; });
+        });
+    Kokkos::fence();
+}
+
 //*****************************************************************************/
 // Determine which cells are associated with the "steering vector" of cells that are either active, or becoming active
 // this time step
-void FillSteeringVector_NoRemelt(int cycle, int LocalActiveDomainSize, int nx, int MyYSlices, ViewI CritTimeStep,
-                                 ViewF UndercoolingCurrent, ViewF UndercoolingChange, ViewI CellType, int ZBound_Low,
-                                 int layernumber, ViewI LayerID, ViewI SteeringVector, ViewI numSteer,
-                                 ViewI_H numSteer_Host) {
+void FillSteeringVector_NoRemelt(int cycle, int, int nx, int MyYSlices, ViewI CritTimeStep, ViewF UndercoolingCurrent,
+                                 ViewF UndercoolingChange, ViewI CellType, int ZBound_Low, int layernumber,
+                                 ViewI LayerID, ViewI SteeringVector, ViewI numSteer, ViewI_H numSteer_Host,
+                                 int nzActive, int XBound_Low, int nxActive, int YBound_Low, int nyActive,
+                                 ViewI TileWakeTime) {
 
     // Cells associated with this layer that are not solid type but have passed the liquidus (crit time step) have their
     // undercooling values updated Cells that meet the aforementioned criteria and are active type should be added to
-    // the steering vector
+    // the steering vector. Only tiles that may contain such cells are checked
+    int NumTiles = TileWakeTime.extent(0);
     Kokkos::parallel_for(
-        "FillSV", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
-            // Cells of interest for the CA
-            int RankZ = D3D1ConvPosition / (nx * MyYSlices);
-            int Rem = D3D1ConvPosition % (nx * MyYSlices);
-            int RankX = Rem / MyYSlices;
-            int RankY = Rem % MyYSlices;
-            int GlobalZ = RankZ + ZBound_Low;
-            int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + RankX * MyYSlices + RankY;
-            int cellType = CellType(GlobalD3D1ConvPosition);
-
-            int layerCheck = (LayerID(GlobalD3D1ConvPosition) <= layernumber);
-            int isNotSolid = (cellType != Solid);
-            int pastCritTime = (cycle > CritTimeStep(GlobalD3D1ConvPosition));
-
-            int cell_Liquid = (cellType == Liquid);
-            int cell_Active = (cellType == Active);
-
-            if (layerCheck && isNotSolid && pastCritTime) {
-                UndercoolingCurrent(GlobalD3D1ConvPosition) +=
-                    UndercoolingChange(GlobalD3D1ConvPosition) * (cell_Liquid + cell_Active);
-                if (cell_Active) {
-                    SteeringVector(Kokkos::atomic_fetch_add(&numSteer(0), 1)) = D3D1ConvPosition;
+        "FillSV", team_policy(NumTiles, Kokkos::AUTO), KOKKOS_LAMBDA(const team_member &TeamMember) {
+            int TileIndex = TeamMember.league_rank();
+            if (cycle < TileWakeTime(TileIndex))
+                return;
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(TeamMember, TileVolume), [&](const int &n) {
+                // Cells of interest for the CA
+                int ActiveX, ActiveY, RankZ;
+                if (!(getTileCellCoordinates(TileIndex, n, nxActive, nyActive, nzActive, ActiveX, ActiveY, RankZ)))
+                    return;
+                int D3D1ConvPosition = RankZ * nxActive * nyActive + ActiveX * nyActive + ActiveY;
+                int RankX = ActiveX + XBound_Low;
+                int RankY = ActiveY + YBound_Low;
+                int GlobalZ = RankZ + ZBound_Low;
+                int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+                int cellType = CellType(GlobalD3D1ConvPosition);
+
+                int layerCheck = (LayerID(GlobalD3D1ConvPosition) <= layernumber);
+                int isNotSolid = (cellType != Solid);
+                int pastCritTime = (cycle > CritTimeStep(GlobalD3D1ConvPosition));
+
+                int cell_Liquid = (cellType == Liquid);
+                int cell_Active = (cellType == Active);
+
+                if (layerCheck && isNotSolid && pastCritTime) {
+                    UndercoolingCurrent(GlobalD3D1ConvPosition) +=
+                        UndercoolingChange(GlobalD3D1ConvPosition) * (cell_Liquid + cell_Active);
+                    if (cell_Active) {
+                        SteeringVector(Kokkos::atomic_fetch_add(&numSteer(0), 1)) = D3D1ConvPosition;
+                    }
                 }
-            }
+            });
         });
     Kokkos::deep_copy(numSteer_Host, numSteer);
 }
@@ -118,68 +172,78 @@ void FillSteeringVector_NoRemelt(int cycle, int LocalActiveDomainSize, int nx, i
 //*****************************************************************************/
 // Determine which cells are associated with the "steering vector" of cells that are either active, or becoming active
 // this time step - version with remelting
-void FillSteeringVector_Remelt(int cycle, int LocalActiveDomainSize, int nx, int MyYSlices, NList NeighborX,
-                               NList NeighborY, NList NeighborZ, ViewI CritTimeStep, ViewF UndercoolingCurrent,
-                               ViewF UndercoolingChange, ViewI CellType, ViewI GrainID, int ZBound_Low, int nzActive,
-                               ViewI SteeringVector, ViewI numSteer, ViewI_H numSteer_Host, ViewI MeltTimeStep,
-                               int BufSizeX, bool AtNorthBoundary, bool AtSouthBoundary, Buffer2D BufferNorthSend,
-                               Buffer2D BufferSouthSend) {
-
+void FillSteeringVector_Remelt(int cycle, int, int nx, int MyYSlices, NList NeighborX, NList NeighborY,
+                               NList NeighborZ, ViewI CritTimeStep, ViewF UndercoolingCurrent, ViewF UndercoolingChange,
+                               ViewI CellType, ViewI GrainID, int ZBound_Low, int nzActive, int XBound_Low,
+                               int nxActive, int YBound_Low, int nyActive, ViewI SteeringVector, ViewI numSteer,
+                               ViewI_H numSteer_Host, ViewI MeltTimeStep, int BufSizeX, bool AtNorthBoundary,
+                               bool AtSouthBoundary, Buffer2D BufferNorthSend, Buffer2D BufferSouthSend,
+                               ViewI TileWakeTime) {
+
+    // Only tiles that may contain cells that are melting or below the liquidus are checked
+    int NumTiles = TileWakeTime.extent(0);
     Kokkos::parallel_for(
-        "FillSV_RM", LocalActiveDomainSize, KOKKOS_LAMBDA(const int &D3D1ConvPosition) {
-            // Coordinate of this cell on the "global" (all cells in the Z direction) grid
-            int RankZ = D3D1ConvPosition / (nx * MyYSlices);
-            int Rem = D3D1ConvPosition % (nx * MyYSlices);
-            int RankX = Rem / MyYSlices;
-            int RankY = Rem % MyYSlices;
-            int GlobalZ = RankZ + ZBound_Low;
-            int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + RankX * MyYSlices + RankY;
-
-            int cellType = CellType(GlobalD3D1ConvPosition);
-            bool isNotSolid = ((cellType != TempSolid) && (cellType != Solid));
-            bool atMeltTime = (cycle == MeltTimeStep(GlobalD3D1ConvPosition));
-            bool pastCritTime = (cycle > CritTimeStep(GlobalD3D1ConvPosition));
-            if ((atMeltTime) && ((cellType == TempSolid) || (cellType == Active))) {
-                // This cell should be a liquid cell
-                CellType(GlobalD3D1ConvPosition) = Liquid;
-                // Reset current undercooling to zero
-                UndercoolingCurrent(GlobalD3D1ConvPosition) = 0.0;
-                // Remove solid cell data from the buffer
-                loadghostnodes(0, 0, 0, 0, 0, BufSizeX, MyYSlices, RankX, RankY, RankZ, AtNorthBoundary,
-                               AtSouthBoundary, BufferSouthSend, BufferNorthSend);
-            }
-            else if ((isNotSolid) && (pastCritTime)) {
-                // Update cell undercooling
-                UndercoolingCurrent(GlobalD3D1ConvPosition) += UndercoolingChange(GlobalD3D1ConvPosition);
-                if (cellType == Active) {
-                    // Add active cells below liquidus to steering vector
-                    SteeringVector(Kokkos::atomic_fetch_add(&numSteer(0), 1)) = D3D1ConvPosition;
+        "FillSV_RM", team_policy(NumTiles, Kokkos::AUTO), KOKKOS_LAMBDA(const team_member &TeamMember) {
+            int TileIndex = TeamMember.league_rank();
+            if (cycle < TileWakeTime(TileIndex))
+                return;
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(TeamMember, TileVolume), [&](const int &n) {
+                // Coordinates of this cell on the active region and "global" (all cells in the Z direction) grids
+                int ActiveX, ActiveY, RankZ;
+                if (!(getTileCellCoordinates(TileIndex, n, nxActive, nyActive, nzActive, ActiveX, ActiveY, RankZ)))
+                    return;
+                int D3D1ConvPosition = RankZ * nxActive * nyActive + ActiveX * nyActive + ActiveY;
+                int RankX = ActiveX + XBound_Low;
+                int RankY = ActiveY + YBound_Low;
+                int GlobalZ = RankZ + ZBound_Low;
+                int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+
+                int cellType = CellType(GlobalD3D1ConvPosition);
+                bool isNotSolid = ((cellType != TempSolid) && (cellType != Solid));
+                bool atMeltTime = (cycle == MeltTimeStep(GlobalD3D1ConvPosition));
+                bool pastCritTime = (cycle > CritTimeStep(GlobalD3D1ConvPosition));
+                if ((atMeltTime) && ((cellType == TempSolid) || (cellType == Active))) {
+                    // This cell should be a liquid cell
+                    CellType(GlobalD3D1ConvPosition) = Liquid;
+                    // Reset current undercooling to zero
+                    UndercoolingCurrent(GlobalD3D1ConvPosition) = 0.0;
+                    // Remove solid cell data from the buffer
+                    loadghostnodes(0, 0, 0, 0, 0, BufSizeX, MyYSlices, ActiveX, RankY, RankZ, AtNorthBoundary,
+                                   AtSouthBoundary, BufferSouthSend, BufferNorthSend);
                 }
-                else if ((cellType == Liquid) && (GrainID(GlobalD3D1ConvPosition) != 0)) {
-                    // If this cell borders at least one solid/tempsolid cell and is part of a grain, it should become
-                    // active
-                    for (int l = 0; l < 26; l++) {
-                        // "l" correpsponds to the specific neighboring cell
-                        // Local coordinates of adjacent cell center
-                        int MyNeighborX = RankX + NeighborX[l];
-                        int MyNeighborY = RankY + NeighborY[l];
-                        int MyNeighborZ = RankZ + NeighborZ[l];
-                        if ((MyNeighborX >= 0) && (MyNeighborX < nx) && (MyNeighborY >= 0) &&
-                            (MyNeighborY < MyYSlices) && (MyNeighborZ < nzActive) && (MyNeighborZ >= 0)) {
-                            int GlobalNeighborD3D1ConvPosition =
-                                (MyNeighborZ + ZBound_Low) * nx * MyYSlices + MyNeighborX * MyYSlices + MyNeighborY;
-                            if ((CellType(GlobalNeighborD3D1ConvPosition) == TempSolid) ||
-                                (CellType(GlobalNeighborD3D1ConvPosition) == Solid) || (RankZ == 0)) {
-                                // Cell activation to be performed as part of steering vector
-                                l = 26;
-                                SteeringVector(Kokkos::atomic_fetch_add(&numSteer(0), 1)) = D3D1ConvPosition;
-                                CellType(GlobalD3D1ConvPosition) =
-                                    FutureActive; // this cell cannot be captured - is being activated
+                else if ((isNotSolid) && (pastCritTime)) {
+                    // Update cell undercooling
+                    UndercoolingCurrent(GlobalD3D1ConvPosition) += UndercoolingChange(GlobalD3D1ConvPosition);
+                    if (cellType == Active) {
+                        // Add active cells below liquidus to steering vector
+                        SteeringVector(Kokkos::atomic_fetch_add(&numSteer(0), 1)) = D3D1ConvPosition;
+                    }
+                    else if ((cellType == Liquid) && (GrainID(GlobalD3D1ConvPosition) != 0)) {
+                        // If this cell borders at least one solid/tempsolid cell and is part of a grain, it should
+                        // become active
+                        for (int l = 0; l < 26; l++) {
+                            // "l" correpsponds to the specific neighboring cell
+                            // Local coordinates of adjacent cell center
+                            int MyNeighborX = RankX + NeighborX[l];
+                            int MyNeighborY = RankY + NeighborY[l];
+                            int MyNeighborZ = RankZ + NeighborZ[l];
+                            if ((MyNeighborX >= 0) && (MyNeighborX < nx) && (MyNeighborY >= 0) &&
+                                (MyNeighborY < MyYSlices) && (MyNeighborZ < nzActive) && (MyNeighborZ >= 0)) {
+                                int GlobalNeighborD3D1ConvPosition =
+                                    (MyNeighborZ + ZBound_Low) * nx * MyYSlices + MyNeighborX * MyYSlices + MyNeighborY;
+                                if ((CellType(GlobalNeighborD3D1ConvPosition) == TempSolid) ||
+                                    (CellType(GlobalNeighborD3D1ConvPosition) == Solid) || (RankZ == 0)) {
+                                    // Cell activation to be performed as part of steering vector
+                                    l = 26;
+                                    SteeringVector(Kokkos::atomic_fetch_add(&numSteer(0), 1)) = D3D1ConvPosition;
+                                    CellType(GlobalD3D1ConvPosition) =
+                                        FutureActive; // this cell cannot be captured - is being activated
+                                }
                             }
                         }
                     }
                 }
-            }
+            });
         });
     Kokkos::fence();
 
@@ -192,10 +256,11 @@ void CellCapture(int, int np, int, int, int, int nx, int MyYSlices, InterfacialR
                  NList NeighborX, NList NeighborY, NList NeighborZ, ViewI CritTimeStep, ViewF UndercoolingCurrent,
                  ViewF UndercoolingChange, ViewF GrainUnitVector, ViewF CritDiagonalLength, ViewF DiagonalLength,
                  ViewI CellType, ViewF DOCenter, ViewI GrainID, int NGrainOrientations, Buffer2D BufferNorthSend,
-                 Buffer2D BufferSouthSend, int BufSizeX, int ZBound_Low, int nzActive, int, ViewI SteeringVector,
-                 ViewI numSteer, ViewI_H numSteer_Host, bool AtNorthBoundary, bool AtSouthBoundary,
-                 ViewI SolidificationEventCounter, ViewI MeltTimeStep, ViewF3D LayerTimeTempHistory,
-                 ViewI NumberOfSolidificationEvents, bool RemeltingYN) {
+                 Buffer2D BufferSouthSend, int BufSizeX, int ZBound_Low, int nzActive, int XBound_Low, int nxActive,
+                 int YBound_Low, int nyActive, int, ViewI SteeringVector, ViewI numSteer, ViewI_H numSteer_Host,
+                 bool AtNorthBoundary, bool AtSouthBoundary, ViewI SolidificationEventCounter, ViewI MeltTimeStep,
+                 ViewF2D LayerTimeTempHistory, ViewI NumberOfSolidificationEvents, ViewI SolidificationEventOffset,
+                 bool RemeltingYN, bool StreamingEvents) {
 
     // Loop over list of active and soon-to-be active cells, potentially performing cell capture events and updating
     // cell types
@@ -204,10 +269,11 @@ void CellCapture(int, int np, int, int, int, int nx, int MyYSlices, InterfacialR
             numSteer(0) = 0;
             int D3D1ConvPosition = SteeringVector(num);
             // Cells of interest for the CA - active cells and future active cells
-            int RankZ = D3D1ConvPosition / (nx * MyYSlices);
-            int Rem = D3D1ConvPosition % (nx * MyYSlices);
-            int GlobalX = Rem / MyYSlices;
-            int RankY = Rem % MyYSlices;
+            int RankZ = D3D1ConvPosition / (nxActive * nyActive);
+            int Rem = D3D1ConvPosition % (nxActive * nyActive);
+            int ActiveX = Rem / nyActive;
+            int GlobalX = ActiveX + XBound_Low;
+            int RankY = Rem % nyActive + YBound_Low;
             int GlobalZ = RankZ + ZBound_Low;
             int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + GlobalX * MyYSlices + RankY;
             if (CellType(GlobalD3D1ConvPosition) == Active) {
@@ -228,8 +294,10 @@ void CellCapture(int, int np, int, int, int, int nx, int MyYSlices, InterfacialR
                     // Check if neighbor is in bounds
                     if ((MyNeighborX >= 0) && (MyNeighborX < nx) && (MyNeighborY >= 0) && (MyNeighborY < MyYSlices) &&
                         (MyNeighborZ < nzActive) && (MyNeighborZ >= 0)) {
-                        long int NeighborD3D1ConvPosition =
-                            MyNeighborZ * nx * MyYSlices + MyNeighborX * MyYSlices + MyNeighborY;
+                        // Only meaningful for liquid neighbors, which always lie within the active region bounds
+                        long int NeighborD3D1ConvPosition = MyNeighborZ * nxActive * nyActive +
+                                                            (MyNeighborX - XBound_Low) * nyActive +
+                                                            (MyNeighborY - YBound_Low);
                         long int GlobalNeighborD3D1ConvPosition =
                             (MyNeighborZ + ZBound_Low) * nx * MyYSlices + MyNeighborX * MyYSlices + MyNeighborY;
                         if (CellType(GlobalNeighborD3D1ConvPosition) == Liquid)
@@ -434,8 +502,8 @@ void CellCapture(int, int np, int, int, int, int nx, int MyYSlices, InterfacialR
                                     // Collect data for the ghost nodes, if necessary
                                     // Data loaded into the ghost nodes is for the cell that was just captured
                                     loadghostnodes(GhostGID, GhostDOCX, GhostDOCY, GhostDOCZ, GhostDL, BufSizeX,
-                                                   MyYSlices, MyNeighborX, MyNeighborY, MyNeighborZ, AtNorthBoundary,
-                                                   AtSouthBoundary, BufferSouthSend, BufferNorthSend);
+                                                   MyYSlices, MyNeighborX - XBound_Low, MyNeighborY, MyNeighborZ,
+                                                   AtNorthBoundary, AtSouthBoundary, BufferSouthSend, BufferNorthSend);
                                 } // End if statement for serial/parallel code
                                 // Only update the new cell's type once Critical Diagonal Length, Triangle Index, and
                                 // Diagonal Length values have been assigned to it Avoids the race condition in which
@@ -462,12 +530,30 @@ void CellCapture(int, int np, int, int, int, int nx, int MyYSlices, InterfacialR
                         }
                         else {
                             CellType(GlobalD3D1ConvPosition) = TempSolid;
-                            MeltTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(
-                                D3D1ConvPosition, SolidificationEventCounter(D3D1ConvPosition), 0));
-                            CritTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(
-                                D3D1ConvPosition, SolidificationEventCounter(D3D1ConvPosition), 1));
-                            UndercoolingChange(GlobalD3D1ConvPosition) =
-                                LayerTimeTempHistory(D3D1ConvPosition, SolidificationEventCounter(D3D1ConvPosition), 2);
+                            if (!StreamingEvents) {
+                                int NextEvent = SolidificationEventOffset(D3D1ConvPosition) +
+                                                SolidificationEventCounter(D3D1ConvPosition);
+                                MeltTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(NextEvent, 0));
+                                CritTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(NextEvent, 1));
+                                UndercoolingChange(GlobalD3D1ConvPosition) = LayerTimeTempHistory(NextEvent, 2);
+                            }
+                            else {
+                                // With streamed temperature events, the cell's events are held in a ring buffer of
+                                // slots, and the next event may not be loaded yet (marked by a melting time of 0).
+                                // The cell then doesn't melt until the event is loaded, which initializes these
+                                // values
+                                int FirstSlot = SolidificationEventOffset(D3D1ConvPosition);
+                                int NumSlots = SolidificationEventOffset(D3D1ConvPosition + 1) - FirstSlot;
+                                int NextEvent = FirstSlot + SolidificationEventCounter(D3D1ConvPosition) % NumSlots;
+                                if (LayerTimeTempHistory(NextEvent, 0) > 0) {
+                                    MeltTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(NextEvent, 0));
+                                    CritTimeStep(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory(NextEvent, 1));
+                                    UndercoolingChange(GlobalD3D1ConvPosition) = LayerTimeTempHistory(NextEvent, 2);
+                                    LayerTimeTempHistory(NextEvent, 0) = 0;
+                                }
+                                else
+                                    MeltTimeStep(GlobalD3D1ConvPosition) = INT_MAX;
+                            }
                         }
                     }
                     else {
@@ -505,7 +591,7 @@ void CellCapture(int, int np, int, int, int, int nx, int MyYSlices, InterfacialR
                     double GhostDOCZ = static_cast<double>(GlobalZ + 0.5);
                     double GhostDL = 0.01;
                     // Collect data for the ghost nodes, if necessary
-                    loadghostnodes(GhostGID, GhostDOCX, GhostDOCY, GhostDOCZ, GhostDL, BufSizeX, MyYSlices, GlobalX,
+                    loadghostnodes(GhostGID, GhostDOCX, GhostDOCY, GhostDOCZ, GhostDL, BufSizeX, MyYSlices, ActiveX,
                                    RankY, RankZ, AtNorthBoundary, AtSouthBoundary, BufferSouthSend, BufferNorthSend);
                 } // End if statement for serial/parallel code
                 // Cell activation is now finished - cell type can be changed from TemporaryUpdate to Active
@@ -521,13 +607,14 @@ void CellCapture(int, int np, int, int, int, int nx, int MyYSlices, InterfacialR
 // CritTimeStep With remelting, the cells of interest are active cells, and the view checked for future work is
 // MeltTimeStep Print intermediate output during this jump if PrintIdleMovieFrames = true
 void JumpTimeStep(int &cycle, unsigned long int RemainingCellsOfInterest, unsigned long int LocalIncompleteCells,
-                  ViewI FutureWorkView, int LocalActiveDomainSize, int MyYSlices, int ZBound_Low, bool RemeltingYN,
-                  ViewI CellType, ViewI LayerID, int id, int layernumber, int np, int nx, int ny, int nz, int MyYOffset,
-                  ViewI GrainID, ViewI CritTimeStep, ViewF GrainUnitVector, ViewF UndercoolingChange,
-                  ViewF UndercoolingCurrent, std::string OutputFile, int NGrainOrientations, std::string PathToOutput,
-                  int &IntermediateFileCounter, int nzActive, double deltax, double XMin, double YMin, double ZMin,
-                  int NumberOfLayers, int &XSwitch, std::string TemperatureDataType, bool PrintIdleMovieFrames,
-                  int MovieFrameInc, bool PrintBinary, int FinishTimeStep = 0) {
+                  ViewI FutureWorkView, int, int MyYSlices, int ZBound_Low, bool RemeltingYN, ViewI CellType,
+                  ViewI LayerID, int id, int layernumber, int np, int nx, int ny, int nz, int MyYOffset, ViewI GrainID,
+                  ViewI CritTimeStep, ViewF GrainUnitVector, ViewF UndercoolingChange, ViewF UndercoolingCurrent,
+                  std::string OutputFile, int NGrainOrientations, std::string PathToOutput,
+                  int &IntermediateFileCounter, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                  int nyActive, double deltax, double XMin, double YMin, double ZMin, int NumberOfLayers, int &XSwitch,
+                  std::string TemperatureDataType, bool PrintIdleMovieFrames, int MovieFrameInc, bool PrintBinary,
+                  ViewI TileWakeTime, int LatestJumpTimeStep, int FinishTimeStep = 0) {
 
     MPI_Bcast(&RemainingCellsOfInterest, 1, MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
     if (RemainingCellsOfInterest == 0) {
@@ -537,29 +624,48 @@ void JumpTimeStep(int &cycle, unsigned long int RemainingCellsOfInterest, unsign
         // done on the rank
         unsigned long int NextWorkTimeStep;
         if (LocalIncompleteCells > 0) {
+            // Tiles that are finished for this layer cannot contain cells associated with future work
+            int NumTiles = TileWakeTime.extent(0);
             Kokkos::parallel_reduce(
-                "CheckNextTSForWork", LocalActiveDomainSize,
-                KOKKOS_LAMBDA(const int &D3D1ConvPosition, unsigned long int &tempv) {
-                    int RankZ = D3D1ConvPosition / (nx * MyYSlices);
-                    int Rem = D3D1ConvPosition % (nx * MyYSlices);
-                    int RankX = Rem / MyYSlices;
-                    int RankY = Rem % MyYSlices;
-                    int GlobalZ = RankZ + ZBound_Low;
-                    int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + RankX * MyYSlices + RankY;
-                    unsigned long int NextWorkTimeStep_ThisCell =
-                        (unsigned long int)(FutureWorkView(GlobalD3D1ConvPosition));
-                    // remelting/no remelting criteria for a cell to be associated with future work
-                    if (((!(RemeltingYN)) && (CellType(GlobalD3D1ConvPosition) == Liquid) &&
-                         (LayerID(GlobalD3D1ConvPosition) == layernumber)) ||
-                        ((RemeltingYN) && (CellType(GlobalD3D1ConvPosition) == TempSolid))) {
-                        if (NextWorkTimeStep_ThisCell < tempv)
-                            tempv = NextWorkTimeStep_ThisCell;
-                    }
+                "CheckNextTSForWork", team_policy(NumTiles, Kokkos::AUTO),
+                KOKKOS_LAMBDA(const team_member &TeamMember, unsigned long int &tempv) {
+                    int TileIndex = TeamMember.league_rank();
+                    if (TileWakeTime(TileIndex) == INT_MAX)
+                        return;
+                    unsigned long int TileNextWorkTimeStep;
+                    Kokkos::parallel_reduce(
+                        Kokkos::TeamThreadRange(TeamMember, TileVolume),
+                        [&](const int &n, unsigned long int &tilev) {
+                            int ActiveX, ActiveY, RankZ;
+                            if (!(getTileCellCoordinates(TileIndex, n, nxActive, nyActive, nzActive, ActiveX, ActiveY,
+                                                         RankZ)))
+                                return;
+                            int GlobalZ = RankZ + ZBound_Low;
+                            int GlobalD3D1ConvPosition =
+                                GlobalZ * nx * MyYSlices + (ActiveX + XBound_Low) * MyYSlices + (ActiveY + YBound_Low);
+                            unsigned long int NextWorkTimeStep_ThisCell =
+                                (unsigned long int)(FutureWorkView(GlobalD3D1ConvPosition));
+                            // remelting/no remelting criteria for a cell to be associated with future work
+                            if (((!(RemeltingYN)) && (CellType(GlobalD3D1ConvPosition) == Liquid) &&
+                                 (LayerID(GlobalD3D1ConvPosition) == layernumber)) ||
+                                ((RemeltingYN) && (CellType(GlobalD3D1ConvPosition) == TempSolid))) {
+                                if (NextWorkTimeStep_ThisCell < tilev)
+                                    tilev = NextWorkTimeStep_ThisCell;
+                            }
+                        },
+                        Kokkos::Min<unsigned long int>(TileNextWorkTimeStep));
+                    Kokkos::single(Kokkos::PerTeam(TeamMember), [&]() {
+                        if (TileNextWorkTimeStep < tempv)
+                            tempv = TileNextWorkTimeStep;
+                    });
                 },
                 Kokkos::Min<unsigned long int>(NextWorkTimeStep));
         }
         else
             NextWorkTimeStep = INT_MAX;
+        // Don't jump past the time step at which more temperature events need to be loaded
+        if (NextWorkTimeStep > (unsigned long int)(LatestJumpTimeStep))
+            NextWorkTimeStep = LatestJumpTimeStep;
 
         unsigned long int GlobalNextWorkTimeStep;
         MPI_Allreduce(&NextWorkTimeStep, &GlobalNextWorkTimeStep, 1, MPI_UNSIGNED_LONG, MPI_MIN, MPI_COMM_WORLD);
@@ -594,14 +700,15 @@ void JumpTimeStep(int &cycle, unsigned long int RemainingCellsOfInterest, unsign
 //*****************************************************************************/
 // Prints intermediate code output to stdout, checks to see if solidification is complete
 void IntermediateOutputAndCheck(int id, int np, int &cycle, int MyYSlices, int MyYOffset, int LocalDomainSize,
-                                int LocalActiveDomainSize, int nx, int ny, int nz, int nzActive, double deltax,
-                                double XMin, double YMin, double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch,
-                                ViewI CellType, ViewI CritTimeStep, ViewI GrainID, std::string TemperatureDataType,
-                                int *FinishTimeStep, int layernumber, int, int ZBound_Low, int NGrainOrientations,
-                                ViewI LayerID, ViewF GrainUnitVector, ViewF UndercoolingChange,
-                                ViewF UndercoolingCurrent, std::string PathToOutput, std::string OutputFile,
-                                bool PrintIdleMovieFrames, int MovieFrameInc, int &IntermediateFileCounter,
-                                int NumberOfLayers, bool PrintBinary) {
+                                int LocalActiveDomainSize, int nx, int ny, int nz, int nzActive, int XBound_Low,
+                                int nxActive, int YBound_Low, int nyActive, double deltax, double XMin, double YMin,
+                                double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch, ViewI CellType,
+                                ViewI CritTimeStep, ViewI GrainID, std::string TemperatureDataType, int *FinishTimeStep,
+                                int layernumber, int, int ZBound_Low, int NGrainOrientations, ViewI LayerID,
+                                ViewF GrainUnitVector, ViewF UndercoolingChange, ViewF UndercoolingCurrent,
+                                std::string PathToOutput, std::string OutputFile, bool PrintIdleMovieFrames,
+                                int MovieFrameInc, int &IntermediateFileCounter, int NumberOfLayers, bool PrintBinary,
+                                ViewI TileWakeTime) {
 
     unsigned long int LocalSuperheatedCells;
     unsigned long int LocalUndercooledCells;
@@ -657,12 +764,14 @@ void IntermediateOutputAndCheck(int id, int np, int &cycle, int MyYSlices, int M
 
     // If an appropraite problem type/solidification is not finished, jump to the next time step with work to be done,
     // if nothing left to do in the near future
-    if ((XSwitch == 0) && ((TemperatureDataType == "R") || (TemperatureDataType == "S")))
+    if ((XSwitch == 0) && ((TemperatureDataType == "R") || (TemperatureDataType == "S") ||
+                           (TemperatureDataType == "L")))
         JumpTimeStep(cycle, GlobalUndercooledCells, LocalSuperheatedCells, CritTimeStep, LocalActiveDomainSize,
                      MyYSlices, ZBound_Low, false, CellType, LayerID, id, layernumber, np, nx, ny, nz, MyYOffset,
                      GrainID, CritTimeStep, GrainUnitVector, UndercoolingChange, UndercoolingCurrent, OutputFile,
-                     NGrainOrientations, PathToOutput, IntermediateFileCounter, nzActive, deltax, XMin, YMin, ZMin,
-                     NumberOfLayers, XSwitch, TemperatureDataType, PrintIdleMovieFrames, MovieFrameInc, PrintBinary,
+                     NGrainOrientations, PathToOutput, IntermediateFileCounter, nzActive, XBound_Low, nxActive,
+                     YBound_Low, nyActive, deltax, XMin, YMin, ZMin, NumberOfLayers, XSwitch, TemperatureDataType,
+                     PrintIdleMovieFrames, MovieFrameInc, PrintBinary, TileWakeTime, INT_MAX,
                      FinishTimeStep[layernumber]);
 }
 
@@ -671,37 +780,53 @@ void IntermediateOutputAndCheck(int id, int np, int &cycle, int MyYSlices, int M
 // remelting) and checks to see if solidification is complete in the case where cells can solidify multiple times
 void IntermediateOutputAndCheck_Remelt(
     int id, int np, int &cycle, int MyYSlices, int MyYOffset, int LocalActiveDomainSize, int nx, int ny, int nz,
-    int nzActive, double deltax, double XMin, double YMin, double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch,
-    ViewI CellType, ViewI CritTimeStep, ViewI GrainID, std::string TemperatureDataType, int layernumber, int,
-    int ZBound_Low, int NGrainOrientations, ViewI LayerID, ViewF GrainUnitVector, ViewF UndercoolingChange,
-    ViewF UndercoolingCurrent, std::string PathToOutput, std::string OutputFile, bool PrintIdleMovieFrames,
-    int MovieFrameInc, int &IntermediateFileCounter, int NumberOfLayers, ViewI MeltTimeStep, bool PrintBinary) {
+    int nzActive, int XBound_Low, int nxActive, int YBound_Low, int nyActive, double deltax, double XMin, double YMin,
+    double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch, ViewI CellType, ViewI CritTimeStep, ViewI GrainID,
+    std::string TemperatureDataType, int layernumber, int, int ZBound_Low, int NGrainOrientations, ViewI LayerID,
+    ViewF GrainUnitVector, ViewF UndercoolingChange, ViewF UndercoolingCurrent, std::string PathToOutput,
+    std::string OutputFile, bool PrintIdleMovieFrames, int MovieFrameInc, int &IntermediateFileCounter,
+    int NumberOfLayers, ViewI MeltTimeStep, bool PrintBinary, ViewI TileWakeTime, int NextEventLoadTimeStep) {
 
     unsigned long int LocalSuperheatedCells;
     unsigned long int LocalUndercooledCells;
     unsigned long int LocalActiveCells;
     unsigned long int LocalTempSolidCells;
     unsigned long int LocalFinishedSolidCells;
+    // Tiles that are finished for this layer only contain solid cells, and their cell types don't need to be checked
+    int NumTiles = TileWakeTime.extent(0);
     Kokkos::parallel_reduce(
-        LocalActiveDomainSize,
-        KOKKOS_LAMBDA(const int &D3D1ConvPosition, unsigned long int &sum_superheated,
-                      unsigned long int &sum_undercooled, unsigned long int &sum_active,
-                      unsigned long int &sum_temp_solid, unsigned long int &sum_finished_solid) {
-            int GlobalD3D1ConvPosition = D3D1ConvPosition + ZBound_Low * nx * MyYSlices;
-            if (CellType(GlobalD3D1ConvPosition) == Liquid) {
-                if (CritTimeStep(GlobalD3D1ConvPosition) > cycle)
-                    sum_superheated += 1;
-                else
-                    sum_undercooled += 1;
+        NumTiles,
+        KOKKOS_LAMBDA(const int &TileIndex, unsigned long int &sum_superheated, unsigned long int &sum_undercooled,
+                      unsigned long int &sum_active, unsigned long int &sum_temp_solid,
+                      unsigned long int &sum_finished_solid) {
+            bool TileFinished = (TileWakeTime(TileIndex) == INT_MAX);
+            for (int n = 0; n < TileVolume; n++) {
+                int ActiveX, ActiveY, RankZ;
+                if (!(getTileCellCoordinates(TileIndex, n, nxActive, nyActive, nzActive, ActiveX, ActiveY, RankZ)))
+                    continue;
+                if (TileFinished) {
+                    sum_finished_solid += 1;
+                    continue;
+                }
+                int GlobalD3D1ConvPosition =
+                    (RankZ + ZBound_Low) * nx * MyYSlices + (ActiveX + XBound_Low) * MyYSlices + (ActiveY + YBound_Low);
+                if (CellType(GlobalD3D1ConvPosition) == Liquid) {
+                    if (CritTimeStep(GlobalD3D1ConvPosition) > cycle)
+                        sum_superheated += 1;
+                    else
+                        sum_undercooled += 1;
+                }
+                else if (CellType(GlobalD3D1ConvPosition) == Active)
+                    sum_active += 1;
+                else if (CellType(GlobalD3D1ConvPosition) == TempSolid)
+                    sum_temp_solid += 1;
+                else if (CellType(GlobalD3D1ConvPosition) == Solid)
+                    sum_finished_solid += 1;
             }
-            else if (CellType(GlobalD3D1ConvPosition) == Active)
-                sum_active += 1;
-            else if (CellType(GlobalD3D1ConvPosition) == TempSolid)
-                sum_temp_solid += 1;
-            else if (CellType(GlobalD3D1ConvPosition) == Solid)
-                sum_finished_solid += 1;
         },
         LocalSuperheatedCells, LocalUndercooledCells, LocalActiveCells, LocalTempSolidCells, LocalFinishedSolidCells);
+    // Cells in this layer outside of the active region bounds never melt, and were initialized as solid
+    LocalFinishedSolidCells += (unsigned long int)(nx * MyYSlices - nxActive * nyActive) * nzActive;
 
     unsigned long int Global_SuccessfulNucEvents_ThisRank = 0;
     unsigned long int GlobalSuperheatedCells, GlobalUndercooledCells, GlobalActiveCells, GlobalTempSolidCells,
@@ -725,10 +850,12 @@ void IntermediateOutputAndCheck_Remelt(
             XSwitch = 1;
     }
     MPI_Bcast(&XSwitch, 1, MPI_INT, 0, MPI_COMM_WORLD);
-    if ((XSwitch == 0) && ((TemperatureDataType == "R") || (TemperatureDataType == "S")))
+    if ((XSwitch == 0) && ((TemperatureDataType == "R") || (TemperatureDataType == "S") ||
+                           (TemperatureDataType == "L")))
         JumpTimeStep(cycle, GlobalActiveCells, LocalTempSolidCells, MeltTimeStep, LocalActiveDomainSize, MyYSlices,
                      ZBound_Low, true, CellType, LayerID, id, layernumber, np, nx, ny, nz, MyYOffset, GrainID,
                      CritTimeStep, GrainUnitVector, UndercoolingChange, UndercoolingCurrent, OutputFile,
-                     NGrainOrientations, PathToOutput, IntermediateFileCounter, nzActive, deltax, XMin, YMin, ZMin,
-                     NumberOfLayers, XSwitch, TemperatureDataType, PrintIdleMovieFrames, MovieFrameInc, PrintBinary);
+                     NGrainOrientations, PathToOutput, IntermediateFileCounter, nzActive, XBound_Low, nxActive,
+                     YBound_Low, nyActive, deltax, XMin, YMin, ZMin, NumberOfLayers, XSwitch, TemperatureDataType,
+                     PrintIdleMovieFrames, MovieFrameInc, PrintBinary, TileWakeTime, NextEventLoadTimeStep);
 }
@@ -11,8 +11,60 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <climits>
 #include <string>
 
+// The active region is divided into cubic tiles of TileSize cells per side. Each tile stores the earliest time step at
+// which any of its cells may need to be considered by FillSteeringVector_*, so that sweeps over the active region can
+// skip tiles where nothing is happening. A tile with a wake time of INT_MAX has no more work for this layer
+constexpr int TileSize = 8;
+constexpr int TileVolume = TileSize * TileSize * TileSize;
+
+// Number of tiles needed to span "NumCells" cells in one direction
+KOKKOS_INLINE_FUNCTION int calcNumTiles(const int NumCells) { return (NumCells + TileSize - 1) / TileSize; }
+
+// Coordinates (relative to the active region) of cell "n" in tile "TileIndex". Tiles are ordered like cells (Z, then X,
+// then Y), as are cells within a tile. Returns false for cells of edge tiles that lie outside of the active region
+KOKKOS_INLINE_FUNCTION bool getTileCellCoordinates(const int TileIndex, const int n, const int nxActive,
+                                                   const int nyActive, const int nzActive, int &ActiveX, int &ActiveY,
+                                                   int &RankZ) {
+    int NumTilesX = calcNumTiles(nxActive);
+    int NumTilesY = calcNumTiles(nyActive);
+    int TileZ = TileIndex / (NumTilesX * NumTilesY);
+    int Rem = TileIndex % (NumTilesX * NumTilesY);
+    int TileX = Rem / NumTilesY;
+    int TileY = Rem % NumTilesY;
+    RankZ = TileZ * TileSize + n / (TileSize * TileSize);
+    ActiveX = TileX * TileSize + (n / TileSize) % TileSize;
+    ActiveY = TileY * TileSize + n % TileSize;
+    return ((ActiveX < nxActive) && (ActiveY < nyActive) && (RankZ < nzActive));
+}
+
+// Earliest time step at which the cell at "GlobalD3D1ConvPosition" may need to be updated by FillSteeringVector_*,
+// given its current state. Returns INT_MAX only for cells that are finished for this layer
+KOKKOS_INLINE_FUNCTION int calcCellWakeTime(const int GlobalD3D1ConvPosition, const int cycle, const int layernumber,
+                                            const bool RemeltingYN, ViewI CellType, ViewI CritTimeStep,
+                                            ViewI MeltTimeStep, ViewI LayerID) {
+    int cellType = CellType(GlobalD3D1ConvPosition);
+    if (cellType == Solid)
+        return INT_MAX;
+    int CritTime = CritTimeStep(GlobalD3D1ConvPosition);
+    // Cells first need updating the time step after reaching the liquidus
+    int WakeTime = (CritTime < INT_MAX - 1) ? CritTime + 1 : INT_MAX - 1;
+    if (RemeltingYN) {
+        int MeltTime = MeltTimeStep(GlobalD3D1ConvPosition);
+        // TempSolid cells only need updating once they melt again
+        if (cellType == TempSolid)
+            WakeTime = MeltTime;
+        else if ((MeltTime >= cycle) && (MeltTime < WakeTime))
+            WakeTime = MeltTime;
+    }
+    else if (LayerID(GlobalD3D1ConvPosition) > layernumber)
+        return INT_MAX;
+    // Cells that may still change type this layer are never marked as finished
+    return (WakeTime < INT_MAX - 1) ? WakeTime : INT_MAX - 1;
+}
+
 // Assign octahedron a small initial size, and a center location
 template <typename ViewType>
 KOKKOS_INLINE_FUNCTION void createNewOctahedron(int D3D1ConvPosition, ViewType DiagonalLength, ViewType DOCenter,
@@ -80,49 +132,60 @@ KOKKOS_INLINE_FUNCTION void calcCritDiagonalLength(int D3D1ConvPosition, float x
 
 void Nucleation(int cycle, int &SuccessfulNucEvents_ThisRank, int &NucleationCounter, int PossibleNuclei_ThisRank,
                 ViewI_H NucleationTimes_H, ViewI NucleiLocations, ViewI NucleiGrainID, ViewI CellType, ViewI GrainID,
-                int ZBound_Low, int nx, int MyYSlices, ViewI SteeringVector, ViewI numSteer_G);
+                int ZBound_Low, int nx, int MyYSlices, int XBound_Low, int nxActive, int YBound_Low, int nyActive,
+                ViewI SteeringVector, ViewI numSteer_G);
+void ResetTileWakeTimes(int nxActive, int nyActive, int nzActive, ViewI &TileWakeTime);
+void UpdateTileWakeTimes(int cycle, int nx, int MyYSlices, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                         int nyActive, int ZBound_Low, int layernumber, bool RemeltingYN, ViewI CellType,
+                         ViewI CritTimeStep, ViewI MeltTimeStep, ViewI LayerID, ViewI TileWakeTime);
 void FillSteeringVector_NoRemelt(int cycle, int LocalActiveDomainSize, int nx, int MyYSlices, ViewI CritTimeStep,
                                  ViewF UndercoolingCurrent, ViewF UndercoolingChange, ViewI CellType, int ZBound_Low,
                                  int layernumber, ViewI LayerID, ViewI SteeringVector, ViewI numSteer_G,
-                                 ViewI_H numSteer_H);
+                                 ViewI_H numSteer_H, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                                 int nyActive, ViewI TileWakeTime);
 void FillSteeringVector_Remelt(int cycle, int LocalActiveDomainSize, int nx, int MyYSlices, NList NeighborX,
                                NList NeighborY, NList NeighborZ, ViewI CritTimeStep, ViewF UndercoolingCurrent,
                                ViewF UndercoolingChange, ViewI CellType, ViewI GrainID, int ZBound_Low, int nzActive,
-                               ViewI SteeringVector, ViewI numSteer, ViewI_H numSteer_Host, ViewI MeltTimeStep,
-                               int BufSizeX, bool AtNorthBoundary, bool AtSouthBoundary, Buffer2D BufferNorthSend,
-                               Buffer2D BufferSouthSend);
+                               int XBound_Low, int nxActive, int YBound_Low, int nyActive, ViewI SteeringVector,
+                               ViewI numSteer, ViewI_H numSteer_Host, ViewI MeltTimeStep, int BufSizeX,
+                               bool AtNorthBoundary, bool AtSouthBoundary, Buffer2D BufferNorthSend,
+                               Buffer2D BufferSouthSend, ViewI TileWakeTime);
 void CellCapture(int id, int np, int cycle, int LocalActiveDomainSize, int LocalDomainSize, int nx, int MyYSlices,
                  InterfacialResponseFunction irf, int MyYOffset, NList NeighborX, NList NeighborY, NList NeighborZ,
                  ViewI CritTimeStep, ViewF UndercoolingCurrent, ViewF UndercoolingChange, ViewF GrainUnitVector,
                  ViewF CritDiagonalLength, ViewF DiagonalLength, ViewI CellType, ViewF DOCenter, ViewI GrainID,
                  int NGrainOrientations, Buffer2D BufferNorthSend, Buffer2D BufferSouthSend, int BufSizeX,
-                 int ZBound_Low, int nzActive, int nz, ViewI SteeringVector, ViewI numSteer_G, ViewI_H numSteer_H,
-                 bool AtNorthBoundary, bool AtSouthBoundary, ViewI SolidificationEventCounter, ViewI MeltTimeStep,
-                 ViewF3D LayerTimeTempHistory, ViewI NumberOfSolidificationEvents, bool RemeltingYN);
-void JumpTimeStep(int &cycle, unsigned long int RemainingCellsOfInterest, ViewI FutureWorkView,
-                  unsigned long int LocalIncompleteCells, int LocalActiveDomainSize, int MyYSlices, int ZBound_Low,
-                  bool RemeltingYN, ViewI CellType, ViewI LayerID, int id, int layernumber, int np, int nx, int ny,
-                  int nz, int MyYOffset, ViewI GrainID, ViewI CritTimeStep, ViewF GrainUnitVector,
-                  ViewF UndercoolingChange, ViewF UndercoolingCurrent, std::string OutputFile,
-                  int DecompositionStrategy, int NGrainOrientations, std::string PathToOutput,
-                  int &IntermediateFileCounter, int nzActive, double deltax, double XMin, double YMin, double ZMin,
-                  int NumberOfLayers, int &XSwitch, std::string TemperatureDataType, bool PrintIdleMovieFrames,
-                  int MovieFrameInc, bool PrintBinary, int FinishTimeStep);
+                 int ZBound_Low, int nzActive, int XBound_Low, int nxActive, int YBound_Low, int nyActive, int nz,
+                 ViewI SteeringVector, ViewI numSteer_G, ViewI_H numSteer_H, bool AtNorthBoundary,
+                 bool AtSouthBoundary, ViewI SolidificationEventCounter, ViewI MeltTimeStep,
+                 ViewF2D LayerTimeTempHistory, ViewI NumberOfSolidificationEvents, ViewI SolidificationEventOffset,
+                 bool RemeltingYN, bool StreamingEvents);
+void JumpTimeStep(int &cycle, unsigned long int RemainingCellsOfInterest, unsigned long int LocalIncompleteCells,
+                  ViewI FutureWorkView, int LocalActiveDomainSize, int MyYSlices, int ZBound_Low, bool RemeltingYN,
+                  ViewI CellType, ViewI LayerID, int id, int layernumber, int np, int nx, int ny, int nz, int MyYOffset,
+                  ViewI GrainID, ViewI CritTimeStep, ViewF GrainUnitVector, ViewF UndercoolingChange,
+                  ViewF UndercoolingCurrent, std::string OutputFile, int NGrainOrientations, std::string PathToOutput,
+                  int &IntermediateFileCounter, int nzActive, int XBound_Low, int nxActive, int YBound_Low,
+                  int nyActive, double deltax, double XMin, double YMin, double ZMin, int NumberOfLayers, int &XSwitch,
+                  std::string TemperatureDataType, bool PrintIdleMovieFrames, int MovieFrameInc, bool PrintBinary,
+                  ViewI TileWakeTime, int LatestJumpTimeStep, int FinishTimeStep);
 void IntermediateOutputAndCheck(int id, int np, int &cycle, int MyYSlices, int MyYOffset, int LocalDomainSize,
-                                int LocalActiveDomainSize, int nx, int ny, int nz, int nzActive, double deltax,
-                                double XMin, double YMin, double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch,
-                                ViewI CellType, ViewI CritTimeStep, ViewI GrainID, std::string TemperatureDataType,
-                                int *FinishTimeStep, int layernumber, int, int ZBound_Low, int NGrainOrientations,
-                                ViewI LayerID, ViewF GrainUnitVector, ViewF UndercoolingChange,
-                                ViewF UndercoolingCurrent, std::string PathToOutput, std::string OutputFile,
-                                bool PrintIdleMovieFrames, int MovieFrameInc, int &IntermediateFileCounter,
-                                int NumberOfLayers, bool PrintBinary);
+                                int LocalActiveDomainSize, int nx, int ny, int nz, int nzActive, int XBound_Low,
+                                int nxActive, int YBound_Low, int nyActive, double deltax, double XMin, double YMin,
+                                double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch, ViewI CellType,
+                                ViewI CritTimeStep, ViewI GrainID, std::string TemperatureDataType, int *FinishTimeStep,
+                                int layernumber, int, int ZBound_Low, int NGrainOrientations, ViewI LayerID,
+                                ViewF GrainUnitVector, ViewF UndercoolingChange, ViewF UndercoolingCurrent,
+                                std::string PathToOutput, std::string OutputFile, bool PrintIdleMovieFrames,
+                                int MovieFrameInc, int &IntermediateFileCounter, int NumberOfLayers, bool PrintBinary,
+                                ViewI TileWakeTime);
 void IntermediateOutputAndCheck_Remelt(
     int id, int np, int &cycle, int MyYSlices, int MyYOffset, int LocalActiveDomainSize, int nx, int ny, int nz,
-    int nzActive, double deltax, double XMin, double YMin, double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch,
-    ViewI CellType, ViewI CritTimeStep, ViewI GrainID, std::string TemperatureDataType, int layernumber, int,
-    int ZBound_Low, int NGrainOrientations, ViewI LayerID, ViewF GrainUnitVector, ViewF UndercoolingChange,
-    ViewF UndercoolingCurrent, std::string PathToOutput, std::string OutputFile, bool PrintIdleMovieFrames,
-    int MovieFrameInc, int &IntermediateFileCounter, int NumberOfLayers, ViewI MeltTimeStep, bool PrintBinary);
+    int nzActive, int XBound_Low, int nxActive, int YBound_Low, int nyActive, double deltax, double XMin, double YMin,
+    double ZMin, int SuccessfulNucEvents_ThisRank, int &XSwitch, ViewI CellType, ViewI CritTimeStep, ViewI GrainID,
+    std::string TemperatureDataType, int layernumber, int, int ZBound_Low, int NGrainOrientations, ViewI LayerID,
+    ViewF GrainUnitVector, ViewF UndercoolingChange, ViewF UndercoolingCurrent, std::string PathToOutput,
+    std::string OutputFile, bool PrintIdleMovieFrames, int MovieFrameInc, int &IntermediateFileCounter,
+    int NumberOfLayers, ViewI MeltTimeStep, bool PrintBinary, ViewI TileWakeTime, int NextEventLoadTimeStep);
 
 #endif
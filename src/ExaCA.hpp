@@ -6,12 +6,20 @@
 #ifndef EXACA_HPP
 #define EXACA_HPP
 
+#include "CAfrozenregion.hpp"
 #include "CAfunctions.hpp"
 #include "CAghostnodes.hpp"
 #include "CAinitialize.hpp"
 #include "CAinterfacialresponse.hpp"
 #include "CAparsefiles.hpp"
 #include "CAprint.hpp"
+#include "CArandom.hpp"
+#include "CAtempcache.hpp"
+#include "CAtempcoupling.hpp"
+#include "CAtempdata.hpp"
+#include "CAtempprovider.hpp"
+#include "CAtempprefetch.hpp"
+#include "CAtempstore.hpp"
 #include "CAtypes.hpp"
 #include "CAupdate.hpp"
 #include "runCA.hpp"
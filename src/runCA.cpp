@@ -5,9 +5,13 @@
 
 #include "runCA.hpp"
 
+#include "CAfrozenregion.hpp"
 #include "CAghostnodes.hpp"
 #include "CAinitialize.hpp"
 #include "CAprint.hpp"
+#include "CAtempprefetch.hpp"
+#include "CAtempstore.hpp"
+#include "CAtempstream.hpp"
 #include "CAtypes.hpp"
 #include "CAupdate.hpp"
 
@@ -16,22 +20,23 @@
 #include <string>
 #include <vector>
 
-void RunProgram_Reduced(int id, int np, std::string InputFile) {
+void RunProgram_Reduced(int id, int np, std::string InputFile, const TemperatureCoupling &Coupling) {
     double NuclTime = 0.0, CreateSVTime = 0.0, CaptureTime = 0.0, GhostTime = 0.0;
     double StartNuclTime, StartCreateSVTime, StartCaptureTime, StartGhostTime;
     double StartInitTime = MPI_Wtime();
 
     int nx, ny, nz, NumberOfLayers, LayerHeight, TempFilesInSeries;
-    int NSpotsX, NSpotsY, SpotOffset, SpotRadius, HTtoCAratio, RVESize;
-    unsigned int NumberOfTemperatureDataPoints;
-    int PrintDebug, TimeSeriesInc;
+    int NSpotsX, NSpotsY, SpotOffset, SpotRadius, HTtoCAratio, RVESize, TempReaderRanks, TempReuseMemory;
+    int PrintDebug, TimeSeriesInc, TempEventWindow;
     bool PrintMisorientation, PrintFinalUndercoolingVals, PrintFullOutput, RemeltingYN, UseSubstrateFile,
         PrintTimeSeries, PrintIdleTimeSeriesFrames, PrintDefaultRVE, BaseplateThroughPowder, LayerwiseTempRead,
-        PrintBinary;
+        PrintBinary, FreezeSolidifiedCells, RunLengthEncodeFrozen;
     float SubstrateGrainSpacing;
     double HT_deltax, deltax, deltat, FractSurfaceSitesActive, G, R, NMax, dTN, dTsigma, RNGSeed, PowderActiveFraction;
     std::string SubstrateFileName, MaterialFileName, SimulationType, OutputFile, GrainOrientationFile, PathToOutput;
     std::vector<std::string> temp_paths;
+    // Moving heat source for raster scan problems
+    RosenthalRasterProvider Raster;
 
     // Read input data
     InputReadFromFile(id, InputFile, SimulationType, deltax, NMax, dTN, dTsigma, OutputFile, GrainOrientationFile,
@@ -40,9 +45,16 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
                       FractSurfaceSitesActive, PathToOutput, PrintDebug, PrintMisorientation,
                       PrintFinalUndercoolingVals, PrintFullOutput, NSpotsX, NSpotsY, SpotOffset, SpotRadius,
                       PrintTimeSeries, TimeSeriesInc, PrintIdleTimeSeriesFrames, PrintDefaultRVE, RNGSeed,
-                      BaseplateThroughPowder, PowderActiveFraction, RVESize, LayerwiseTempRead, PrintBinary);
+                      BaseplateThroughPowder, PowderActiveFraction, RVESize, LayerwiseTempRead, PrintBinary,
+                      FreezeSolidifiedCells, RunLengthEncodeFrozen, TempReaderRanks, TempReuseMemory, TempEventWindow,
+                      Raster, Coupling);
     // Read material data.
     InterfacialResponseFunction irf(id, MaterialFileName, deltat, deltax);
+    // Without remelting, temperature data for all layers is read during initialization, but the temperature fields are
+    // (if LayerwiseTempRead was set) only initialized for each layer's cells once that layer starts
+    bool LayerwiseTempInit = ((SimulationType == "R") && (!(RemeltingYN)) && (LayerwiseTempRead));
+    if (LayerwiseTempInit)
+        LayerwiseTempRead = false;
 
     // Variables characterizing local processor grids relative to global domain
     // 1D decomposition in Y: Each MPI rank has a subset consisting of of MyYSlices cells, out of ny cells in Y
@@ -63,13 +75,12 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     int *FinishTimeStep = new int[NumberOfLayers];
 
     // Data structure for storing raw temperature data from file(s)
-    // Store data as double - needed for small time steps to resolve local differences in solidification conditions
-    // With no remelting, each data point has 5 values (X, Y, Z coordinates, liquidus time, and cooling rate)
-    // With remelting, each data point has 6 values (X, Y, Z coordinates, melting time, liquidus time, and cooling rate)
-    // Initial estimate for size
-    std::vector<double> RawData(1000000);
+    // Each data point has X, Y, Z coordinates (stored as CA cell indices), along with melting time, liquidus time, and
+    // cooling rate (stored as double - needed for small time steps to resolve local differences in solidification
+    // conditions)
+    RawTemperatureData RawData;
 
-    // Contains "NumberOfLayers" values corresponding to the location within "RawData" of the first data element in each
+    // Contains "NumberOfLayers" values corresponding to the location within "RawData" of the first data point in each
     // temperature file
     int *FirstValue = new int[NumberOfLayers];
     int *LastValue = new int[NumberOfLayers];
@@ -81,11 +92,11 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     // temperature data files and parsing the coordinates
     // For simulations using input temperature data with remelting: even if only LayerwiseTempRead is true, all files
     // need to be read to determine the domain bounds
-    FindXYZBounds(SimulationType, id, deltax, nx, ny, nz, temp_paths, XMin, XMax, YMin, YMax, ZMin, ZMax, LayerHeight,
-                  NumberOfLayers, TempFilesInSeries, ZMinLayer, ZMaxLayer, SpotRadius);
+    FindXYZBounds(SimulationType, id, np, deltax, nx, ny, nz, temp_paths, XMin, XMax, YMin, YMax, ZMin, ZMax,
+                  LayerHeight, NumberOfLayers, TempFilesInSeries, ZMinLayer, ZMaxLayer, SpotRadius, Coupling);
 
     // Ensure that input powder layer init options are compatible with this domain size, if needed for this problem type
-    if ((SimulationType == "R") || (SimulationType == "S"))
+    if ((SimulationType == "R") || (SimulationType == "S") || (SimulationType == "L"))
         checkPowderOverflow(nx, ny, LayerHeight, NumberOfLayers, BaseplateThroughPowder, PowderActiveFraction);
 
     // Decompose the domain into subdomains on each MPI rank: Calculate MyYSlices and MyYOffset for each rank, where
@@ -96,9 +107,9 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     // Read in temperature data from files, stored in "RawData", with the appropriate MPI ranks storing the appropriate
     // data
     if (SimulationType == "R")
-        ReadTemperatureData(id, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, YMin, temp_paths, NumberOfLayers,
-                            TempFilesInSeries, NumberOfTemperatureDataPoints, RawData, FirstValue, LastValue,
-                            LayerwiseTempRead, 0);
+        ReadTemperatureData(id, np, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, XMin, YMin, ZMin, temp_paths,
+                            NumberOfLayers, TempFilesInSeries, RawData, FirstValue, LastValue, LayerwiseTempRead, 0,
+                            TempReaderRanks, Coupling);
 
     MPI_Barrier(MPI_COMM_WORLD);
     if (id == 0)
@@ -114,51 +125,123 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     // With remelting, temperature fields are also characterized by these variables:
     // Maximum number of times a cell in a given layer undergoes solidification
     ViewI MaxSolidificationEvents(Kokkos::ViewAllocateWithoutInitializing("NumberOfRemeltEvents"), NumberOfLayers);
-    // For each cell in the current layer (index 1), and each time solidification happens (index 2), hold the values
-    // that will be used for MeltTimeStep, CritTimeStep, and UndercoolingChange (index 3)
-    ViewF3D LayerTimeTempHistory(Kokkos::ViewAllocateWithoutInitializing("TimeTempHistory"), 0, 0, 0);
+    // For each time a cell in the current layer undergoes solidification (index 1), hold the values that will be used
+    // for MeltTimeStep, CritTimeStep, and UndercoolingChange (index 2). Each cell's events are stored consecutively
+    ViewF2D LayerTimeTempHistory(Kokkos::ViewAllocateWithoutInitializing("TimeTempHistory"), 0, 3);
     // The number of times that each CA cell will undergo solidification during this layer
     ViewI NumberOfSolidificationEvents(Kokkos::ViewAllocateWithoutInitializing("NumSEvents"), 0);
+    // The position of each CA cell's first solidification event in LayerTimeTempHistory
+    ViewI SolidificationEventOffset(Kokkos::ViewAllocateWithoutInitializing("SEventOffset"), 0);
     // A counter for the number of times each CA cell has undergone solidification so far this layer
     ViewI SolidificationEventCounter(Kokkos::ViewAllocateWithoutInitializing("SEventCounter"), 0);
     // The next time that each cell will melt during this layer
     ViewI MeltTimeStep(Kokkos::ViewAllocateWithoutInitializing("MeltTimeStep"), 0);
 
+    // With remelting and input temperature data, solidification events after each cell's first can be streamed to the
+    // device in time windows during each layer, rather than stored on the device for the whole layer
+    TemperatureEventStream EventStream;
+    if ((SimulationType == "R") && (RemeltingYN))
+        EventStream.WindowSize = TempEventWindow;
+
     // Bounds of the current layer: Z coordinates span ZBound_Low-ZBound_High, inclusive
     int ZBound_Low = calcZBound_Low(SimulationType, LayerHeight, 0, ZMinLayer, ZMin, deltax);
     int ZBound_High = calcZBound_High(SimulationType, SpotRadius, LayerHeight, 0, ZMin, deltax, nz, ZMaxLayer);
     int nzActive = calcnzActive(ZBound_Low, ZBound_High, id, 0);
-    int LocalActiveDomainSize =
-        calcLocalActiveDomainSize(nx, MyYSlices, nzActive); // Number of active cells on this MPI rank
+    // Number of cells in the layer's Z bounds on this MPI rank (trimmed to the active region after temperature init)
+    int LocalActiveDomainSize = calcLocalActiveDomainSize(nx, MyYSlices, nzActive);
+    // Without remelting, cell types (and with LayerwiseTempInit, temperature fields) are initialized for cells with Z
+    // coordinates InitZ_Low-InitZ_High, inclusive: either all cells, or the cells up to the top of the first layer
+    int InitZ_Low = 0;
+    int InitZ_High = nz - 1;
+    if (LayerwiseTempInit)
+        InitZ_High = ZBound_High;
+    // With FreezeSolidifiedCells, cells below the melt pools of all remaining layers are moved out of the views after
+    // each layer, keeping only their GrainID and LayerID values in the frozen region store. The views then start at
+    // global Z coordinate Frozen.nzFrozen, and the layer bounds ZBound_Low and ZBound_High are relative to it
+    FrozenRegion Frozen;
+    Frozen.RunLengthEncode = RunLengthEncodeFrozen;
+    int nzResident = nz;
     // Initialize the temperature fields:
     // R: input temperature data from files using reduced/sparse data format (with or without remelting)
     // S: spot melt array test problem (with or without remelting)
+    // L: raster scan by a moving point heat source (with or without remelting)
     // C: directional/constrained solidification test problem
-    if ((SimulationType == "R") && (RemeltingYN))
+    if ((SimulationType == "R") && (RemeltingYN) && (EventStream.streaming()))
+        TempInit_ReadDataRemelt_Streamed(0, id, nx, MyYSlices, LocalActiveDomainSize, LocalDomainSize, MyYOffset,
+                                         deltat, irf.FreezingRange, NumberOfSolidificationEvents,
+                                         MaxSolidificationEvents, MeltTimeStep, CritTimeStep, UndercoolingChange,
+                                         UndercoolingCurrent, ZMinLayer, LayerHeight, nzActive, ZBound_Low,
+                                         FinishTimeStep, LayerID, FirstValue, LastValue, RawData,
+                                         SolidificationEventCounter, TempFilesInSeries, EventStream);
+    else if ((SimulationType == "R") && (RemeltingYN))
         TempInit_ReadDataRemelt(0, id, nx, MyYSlices, nz, LocalActiveDomainSize, LocalDomainSize, MyYOffset, deltax,
                                 deltat, irf.FreezingRange, LayerTimeTempHistory, NumberOfSolidificationEvents,
-                                MaxSolidificationEvents, MeltTimeStep, CritTimeStep, UndercoolingChange,
-                                UndercoolingCurrent, XMin, YMin, ZMinLayer, LayerHeight, nzActive, ZBound_Low,
+                                SolidificationEventOffset, MaxSolidificationEvents, MeltTimeStep, CritTimeStep,
+                                UndercoolingChange, UndercoolingCurrent, ZMinLayer, LayerHeight, nzActive, ZBound_Low,
                                 FinishTimeStep, LayerID, FirstValue, LastValue, RawData, SolidificationEventCounter,
                                 TempFilesInSeries);
     else if ((SimulationType == "S") && (RemeltingYN))
         TempInit_SpotRemelt(0, G, R, SimulationType, id, nx, MyYSlices, MyYOffset, deltax, deltat, ZBound_Low, nz,
                             LocalActiveDomainSize, LocalDomainSize, CritTimeStep, UndercoolingChange,
                             UndercoolingCurrent, LayerHeight, irf.FreezingRange, LayerID, NSpotsX, NSpotsY, SpotRadius,
-                            SpotOffset, LayerTimeTempHistory, NumberOfSolidificationEvents, MeltTimeStep,
-                            MaxSolidificationEvents, SolidificationEventCounter);
-    else if ((SimulationType == "R") && (!RemeltingYN))
-        TempInit_ReadDataNoRemelt(id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio, deltat, nz, LocalDomainSize,
-                                  CritTimeStep, UndercoolingChange, XMin, YMin, ZMin, ZMinLayer, ZMaxLayer, LayerHeight,
-                                  NumberOfLayers, FinishTimeStep, irf.FreezingRange, LayerID, FirstValue, LastValue,
-                                  RawData, ny);
+                            SpotOffset, LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                            MeltTimeStep, MaxSolidificationEvents, SolidificationEventCounter);
+    else if ((SimulationType == "L") && (RemeltingYN))
+        TempInit_RasterRemelt(Raster, 0, id, nx, MyYSlices, MyYOffset, ZBound_Low, LocalActiveDomainSize,
+                              LocalDomainSize, CritTimeStep, UndercoolingChange, UndercoolingCurrent, LayerID,
+                              LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                              MeltTimeStep, MaxSolidificationEvents, SolidificationEventCounter);
+    else if ((SimulationType == "R") && (!RemeltingYN)) {
+        if (LayerwiseTempInit)
+            TempInit_ReadDataNoRemelt_Layer(0, id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio, deltat, nz,
+                                            CritTimeStep, UndercoolingChange, LayerID, ZMin, ZMinLayer, ZMaxLayer,
+                                            LayerHeight, NumberOfLayers, FinishTimeStep, irf.FreezingRange, FirstValue,
+                                            LastValue, RawData, ny, InitZ_Low, InitZ_High, Frozen.nzFrozen);
+        else
+            TempInit_ReadDataNoRemelt(id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio, deltat, nz, LocalDomainSize,
+                                      CritTimeStep, UndercoolingChange, ZMin, ZMinLayer, ZMaxLayer, LayerHeight,
+                                      NumberOfLayers, FinishTimeStep, irf.FreezingRange, LayerID, FirstValue, LastValue,
+                                      RawData, ny);
+    }
     else if ((SimulationType == "S") && (!RemeltingYN))
         TempInit_SpotNoRemelt(G, R, SimulationType, id, nx, MyYSlices, MyYOffset, deltax, deltat, nz, LocalDomainSize,
                               CritTimeStep, UndercoolingChange, LayerHeight, NumberOfLayers, irf.FreezingRange, LayerID,
                               NSpotsX, NSpotsY, SpotRadius, SpotOffset);
+    else if ((SimulationType == "L") && (!RemeltingYN))
+        TempInit_RasterNoRemelt(Raster, id, nx, MyYSlices, MyYOffset, LocalDomainSize, CritTimeStep, UndercoolingChange,
+                                LayerHeight, NumberOfLayers, LayerID);
     else if (SimulationType == "C")
         TempInit_DirSolidification(G, R, id, nx, MyYSlices, deltax, deltat, nz, LocalDomainSize, CritTimeStep,
                                    UndercoolingChange, LayerID);
+    // With LayerwiseTempRead, each layer's temperature file is read on a background host thread while the previous
+    // layer solidifies, unless a subset of ranks reads the data or the data comes from a coupled code (both of which
+    // require MPI communication during the read)
+    bool PrefetchTempData =
+        ((SimulationType == "R") && (LayerwiseTempRead) && (TempReaderRanks == 0) && (Coupling.empty()));
+    TemperaturePrefetch Prefetch;
+    // With LayerwiseTempRead, each file's temperature data is also kept (up to the given memory limit) for reuse by
+    // later layers using the same file
+    TemperatureDataStore TempStore;
+    if ((SimulationType == "R") && (LayerwiseTempRead)) {
+        TempStore.MemoryLimit = static_cast<std::size_t>(TempReuseMemory) * 1024 * 1024;
+        storeTemperatureData(TempStore, temp_paths[0], RawData);
+    }
+    if ((PrefetchTempData) && (!(checkStoredTemperatureData(TempStore, temp_paths[1 % TempFilesInSeries]))))
+        startTemperaturePrefetch(Prefetch, 1, NumberOfLayers, TempFilesInSeries, temp_paths, XMin, YMin, ZMin, deltax,
+                                 HT_deltax, HTtoCAratio, MyYSlices, MyYOffset);
+    // Bounds of the layer's active region in X and Y: active cell data is only stored for cells in these bounds
+    int XBound_Low, nxActive, YBound_Low, nyActive;
+    calcActiveRegionBounds(SimulationType, id, 0, nx, MyYSlices, nzActive, ZBound_Low, CritTimeStep, XBound_Low,
+                           nxActive, YBound_Low, nyActive);
+    if (EventStream.streaming())
+        TrimEventStreamToActiveRegion(nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive, EventStream,
+                                      LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                                      SolidificationEventCounter);
+    else if (RemeltingYN)
+        TrimEventDataToActiveRegion(nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive,
+                                    LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                                    SolidificationEventCounter);
+    LocalActiveDomainSize = calcLocalActiveDomainSize(nxActive, nyActive, nzActive); // Number of active cells
     MPI_Barrier(MPI_COMM_WORLD);
     if (id == 0)
         std::cout << "Done with temperature field initialization, active domain size is " << nzActive << " out of "
@@ -184,7 +267,7 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     ViewF CritDiagonalLength(Kokkos::ViewAllocateWithoutInitializing("CritDiagonalLength"), 26 * LocalActiveDomainSize);
 
     // Buffers for ghost node data (fixed size)
-    int BufSizeX = nx;
+    int BufSizeX = nxActive;
     int BufSizeZ = nzActive;
 
     // Send/recv buffers for ghost node data should be initialized with zeros
@@ -193,6 +276,11 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     Buffer2D BufferSouthRecv("BufferSouthRecv", BufSizeX * BufSizeZ, 5);
     Buffer2D BufferNorthRecv("BufferNorthRecv", BufSizeX * BufSizeZ, 5);
 
+    // Persistent MPI requests for the halo exchange, recreated each time the buffers are resized
+    std::vector<MPI_Request> HaloSendRequests, HaloRecvRequests;
+    InitHaloRequests(NeighborRank_North, NeighborRank_South, BufferNorthSend, BufferSouthSend, BufferNorthRecv,
+                     BufferSouthRecv, BufSizeX, BufSizeZ, HaloSendRequests, HaloRecvRequests);
+
     // Initialize the grain structure and cell types - for either a constrained solidification problem, using a
     // substrate from a file, or generating a substrate using the existing CA algorithm
     int NextLayer_FirstEpitaxialGrainID;
@@ -204,7 +292,7 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     }
     else {
         if (UseSubstrateFile)
-            SubstrateInit_FromFile(SubstrateFileName, nz, nx, MyYSlices, MyYOffset, id, GrainID, nzActive,
+            SubstrateInit_FromFile(SubstrateFileName, nz, nx, ny, MyYSlices, MyYOffset, id, GrainID, nzActive,
                                    BaseplateThroughPowder);
         else
             BaseplateInit_FromGrainSpacing(SubstrateGrainSpacing, nx, ny, ZMinLayer, ZMaxLayer, MyYSlices, MyYOffset,
@@ -212,13 +300,13 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
                                            BaseplateThroughPowder);
         // Separate routine for active cell data structure init for problems other than constrained solidification
         if (RemeltingYN)
-            CellTypeInit_Remelt(nx, MyYSlices, LocalActiveDomainSize, CellType, CritTimeStep, id, ZBound_Low);
+            CellTypeInit_Remelt(nx, MyYSlices, nzActive, CellType, CritTimeStep, id, ZBound_Low);
         else {
-            CellTypeInit_NoRemelt(0, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, nz, LocalActiveDomainSize,
-                                  LocalDomainSize, CellType, CritTimeStep, NeighborX, NeighborY, NeighborZ,
-                                  NGrainOrientations, GrainUnitVector, DiagonalLength, GrainID, CritDiagonalLength,
-                                  DOCenter, LayerID, BufferNorthSend, BufferSouthSend, BufSizeX, AtNorthBoundary,
-                                  AtSouthBoundary);
+            CellTypeInit_NoRemelt(0, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, XBound_Low, nxActive, YBound_Low,
+                                  nyActive, nz, LocalActiveDomainSize, InitZ_Low, InitZ_High, CellType, CritTimeStep,
+                                  NeighborX, NeighborY, NeighborZ, NGrainOrientations, GrainUnitVector, DiagonalLength,
+                                  GrainID, CritDiagonalLength, DOCenter, LayerID, BufferNorthSend, BufferSouthSend,
+                                  BufSizeX, AtNorthBoundary, AtSouthBoundary);
         }
     }
     MPI_Barrier(MPI_COMM_WORLD);
@@ -237,10 +325,11 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     // Fill in nucleation data structures, and assign nucleation undercooling values to potential nucleation events
     // Potential nucleation grains are only associated with liquid cells in layer 0 - they will be initialized for each
     // successive layer when layer 0 in complete
-    NucleiInit(0, RNGSeed, MyYSlices, MyYOffset, nx, ny, nzActive, ZBound_Low, id, NMax, dTN, dTsigma, deltax,
-               NucleiLocation, NucleationTimes_Host, NucleiGrainID, CellType, CritTimeStep, UndercoolingChange, LayerID,
-               PossibleNuclei_ThisRankThisLayer, Nuclei_WholeDomain, AtNorthBoundary, AtSouthBoundary, RemeltingYN,
-               NucleationCounter, MaxSolidificationEvents, NumberOfSolidificationEvents, LayerTimeTempHistory);
+    NucleiInit(0, RNGSeed, MyYSlices, MyYOffset, nx, ny, nzActive, ZBound_Low, XBound_Low, nxActive, YBound_Low,
+               nyActive, id, NMax, dTN, dTsigma, deltax, NucleiLocation, NucleationTimes_Host, NucleiGrainID, CellType,
+               CritTimeStep, UndercoolingChange, LayerID, PossibleNuclei_ThisRankThisLayer, Nuclei_WholeDomain,
+               AtNorthBoundary, AtSouthBoundary, RemeltingYN, NucleationCounter, MaxSolidificationEvents,
+               NumberOfSolidificationEvents, SolidificationEventOffset, LayerTimeTempHistory, EventStream);
 
     // Steering Vector
     ViewI SteeringVector(Kokkos::ViewAllocateWithoutInitializing("SteeringVector"), LocalActiveDomainSize);
@@ -254,7 +343,8 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
         GhostNodes1D(-1, id, NeighborRank_North, NeighborRank_South, nx, MyYSlices, MyYOffset, NeighborX, NeighborY,
                      NeighborZ, CellType, DOCenter, GrainID, GrainUnitVector, DiagonalLength, CritDiagonalLength,
                      NGrainOrientations, BufferNorthSend, BufferSouthSend, BufferNorthRecv, BufferSouthRecv, BufSizeX,
-                     BufSizeZ, ZBound_Low);
+                     BufSizeZ, ZBound_Low, XBound_Low, nxActive, YBound_Low, nyActive, HaloSendRequests,
+                     HaloRecvRequests);
     }
 
     // If specified, print initial values in some views for debugging purposes
@@ -274,6 +364,8 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     }
     int cycle = 0;
     int IntermediateFileCounter = 0;
+    // Earliest time step at which each tile of the active domain may have cells that need updating
+    ViewI TileWakeTime(Kokkos::ViewAllocateWithoutInitializing("TileWakeTime"), 0);
     double StartRunTime = MPI_Wtime();
     for (int layernumber = 0; layernumber < NumberOfLayers; layernumber++) {
 
@@ -281,6 +373,11 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
         int XSwitch = 0;
         double LayerTime1 = MPI_Wtime();
 
+        // Initialize the tile map for this layer's active region
+        ResetTileWakeTimes(nxActive, nyActive, nzActive, TileWakeTime);
+        UpdateTileWakeTimes(cycle, nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive, ZBound_Low,
+                            layernumber, RemeltingYN, CellType, CritTimeStep, MeltTimeStep, LayerID, TileWakeTime);
+
         // Loop continues until all liquid cells claimed by solid grains
         do {
             // Start of time step - check and see if intermediate system output is to be printed to files
@@ -297,13 +394,20 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
             }
             cycle++;
 
+            // If streaming solidification events, load the next window of events as the simulation approaches them
+            if (cycle >= EventStream.NextLoadTimeStep)
+                loadEventWindow(cycle, EventStream, nx, MyYSlices, ZBound_Low, XBound_Low, nxActive, YBound_Low,
+                                nyActive, nzActive, LayerTimeTempHistory, SolidificationEventOffset,
+                                SolidificationEventCounter, MeltTimeStep, CritTimeStep, UndercoolingChange,
+                                TileWakeTime);
+
             // Update cells on GPU - undercooling and diagonal length updates, nucleation
             // Cells with a successful nucleation event are marked and added to a steering vector, later dealt with in
             // CellCapture
             StartNuclTime = MPI_Wtime();
             Nucleation(cycle, SuccessfulNucEvents_ThisRank, NucleationCounter, PossibleNuclei_ThisRankThisLayer,
                        NucleationTimes_Host, NucleiLocation, NucleiGrainID, CellType, GrainID, ZBound_Low, nx,
-                       MyYSlices, SteeringVector, numSteer);
+                       MyYSlices, XBound_Low, nxActive, YBound_Low, nyActive, SteeringVector, numSteer);
             NuclTime += MPI_Wtime() - StartNuclTime;
 
             // Update cells on GPU - new active cells, solidification of old active cells
@@ -314,21 +418,25 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
             if (RemeltingYN)
                 FillSteeringVector_Remelt(cycle, LocalActiveDomainSize, nx, MyYSlices, NeighborX, NeighborY, NeighborZ,
                                           CritTimeStep, UndercoolingCurrent, UndercoolingChange, CellType, GrainID,
-                                          ZBound_Low, nzActive, SteeringVector, numSteer, numSteer_Host, MeltTimeStep,
-                                          BufSizeX, AtNorthBoundary, AtSouthBoundary, BufferNorthSend, BufferSouthSend);
+                                          ZBound_Low, nzActive, XBound_Low, nxActive, YBound_Low, nyActive,
+                                          SteeringVector, numSteer, numSteer_Host, MeltTimeStep, BufSizeX,
+                                          AtNorthBoundary, AtSouthBoundary, BufferNorthSend, BufferSouthSend,
+                                          TileWakeTime);
             else
                 FillSteeringVector_NoRemelt(cycle, LocalActiveDomainSize, nx, MyYSlices, CritTimeStep,
                                             UndercoolingCurrent, UndercoolingChange, CellType, ZBound_Low, layernumber,
-                                            LayerID, SteeringVector, numSteer, numSteer_Host);
+                                            LayerID, SteeringVector, numSteer, numSteer_Host, nzActive, XBound_Low,
+                                            nxActive, YBound_Low, nyActive, TileWakeTime);
             CreateSVTime += MPI_Wtime() - StartCreateSVTime;
 
             StartCaptureTime = MPI_Wtime();
             CellCapture(id, np, cycle, LocalActiveDomainSize, LocalDomainSize, nx, MyYSlices, irf, MyYOffset, NeighborX,
                         NeighborY, NeighborZ, CritTimeStep, UndercoolingCurrent, UndercoolingChange, GrainUnitVector,
                         CritDiagonalLength, DiagonalLength, CellType, DOCenter, GrainID, NGrainOrientations,
-                        BufferNorthSend, BufferSouthSend, BufSizeX, ZBound_Low, nzActive, nz, SteeringVector, numSteer,
-                        numSteer_Host, AtNorthBoundary, AtSouthBoundary, SolidificationEventCounter, MeltTimeStep,
-                        LayerTimeTempHistory, NumberOfSolidificationEvents, RemeltingYN);
+                        BufferNorthSend, BufferSouthSend, BufSizeX, ZBound_Low, nzActive, XBound_Low, nxActive,
+                        YBound_Low, nyActive, nz, SteeringVector, numSteer, numSteer_Host, AtNorthBoundary,
+                        AtSouthBoundary, SolidificationEventCounter, MeltTimeStep, LayerTimeTempHistory,
+                        NumberOfSolidificationEvents, SolidificationEventOffset, RemeltingYN, EventStream.streaming());
             CaptureTime += MPI_Wtime() - StartCaptureTime;
 
             if (np > 1) {
@@ -337,7 +445,8 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
                 GhostNodes1D(cycle, id, NeighborRank_North, NeighborRank_South, nx, MyYSlices, MyYOffset, NeighborX,
                              NeighborY, NeighborZ, CellType, DOCenter, GrainID, GrainUnitVector, DiagonalLength,
                              CritDiagonalLength, NGrainOrientations, BufferNorthSend, BufferSouthSend, BufferNorthRecv,
-                             BufferSouthRecv, BufSizeX, BufSizeZ, ZBound_Low);
+                             BufferSouthRecv, BufSizeX, BufSizeZ, ZBound_Low, XBound_Low, nxActive, YBound_Low,
+                             nyActive, HaloSendRequests, HaloRecvRequests);
                 GhostTime += MPI_Wtime() - StartGhostTime;
             }
 
@@ -345,20 +454,25 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
 
                 if (RemeltingYN)
                     IntermediateOutputAndCheck_Remelt(
-                        id, np, cycle, MyYSlices, MyYOffset, LocalActiveDomainSize, nx, ny, nz, nzActive, deltax, XMin,
-                        YMin, ZMin, SuccessfulNucEvents_ThisRank, XSwitch, CellType, CritTimeStep, GrainID,
-                        SimulationType, layernumber, NumberOfLayers, ZBound_Low, NGrainOrientations, LayerID,
-                        GrainUnitVector, UndercoolingChange, UndercoolingCurrent, PathToOutput, OutputFile,
-                        PrintIdleTimeSeriesFrames, TimeSeriesInc, IntermediateFileCounter, NumberOfLayers, MeltTimeStep,
-                        PrintBinary);
+                        id, np, cycle, MyYSlices, MyYOffset, LocalActiveDomainSize, nx, ny, nz, nzActive, XBound_Low,
+                        nxActive, YBound_Low, nyActive, deltax, XMin, YMin, ZMin, SuccessfulNucEvents_ThisRank, XSwitch,
+                        CellType, CritTimeStep, GrainID, SimulationType, layernumber, NumberOfLayers, ZBound_Low,
+                        NGrainOrientations, LayerID, GrainUnitVector, UndercoolingChange, UndercoolingCurrent,
+                        PathToOutput, OutputFile, PrintIdleTimeSeriesFrames, TimeSeriesInc, IntermediateFileCounter,
+                        NumberOfLayers, MeltTimeStep, PrintBinary, TileWakeTime, EventStream.NextLoadTimeStep);
                 else
-                    IntermediateOutputAndCheck(id, np, cycle, MyYSlices, MyYOffset, LocalDomainSize,
-                                               LocalActiveDomainSize, nx, ny, nz, nzActive, deltax, XMin, YMin, ZMin,
-                                               SuccessfulNucEvents_ThisRank, XSwitch, CellType, CritTimeStep, GrainID,
-                                               SimulationType, FinishTimeStep, layernumber, NumberOfLayers, ZBound_Low,
-                                               NGrainOrientations, LayerID, GrainUnitVector, UndercoolingChange,
-                                               UndercoolingCurrent, PathToOutput, OutputFile, PrintIdleTimeSeriesFrames,
-                                               TimeSeriesInc, IntermediateFileCounter, NumberOfLayers, PrintBinary);
+                    IntermediateOutputAndCheck(
+                        id, np, cycle, MyYSlices, MyYOffset, LocalDomainSize, LocalActiveDomainSize, nx, ny, nz,
+                        nzActive, XBound_Low, nxActive, YBound_Low, nyActive, deltax, XMin, YMin, ZMin,
+                        SuccessfulNucEvents_ThisRank, XSwitch, CellType, CritTimeStep, GrainID, SimulationType,
+                        FinishTimeStep, layernumber, NumberOfLayers, ZBound_Low, NGrainOrientations, LayerID,
+                        GrainUnitVector, UndercoolingChange, UndercoolingCurrent, PathToOutput, OutputFile,
+                        PrintIdleTimeSeriesFrames, TimeSeriesInc, IntermediateFileCounter, NumberOfLayers, PrintBinary,
+                        TileWakeTime);
+                // Refresh tile wake times with the current state of the cells
+                UpdateTileWakeTimes(cycle, nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive,
+                                    ZBound_Low, layernumber, RemeltingYN, CellType, CritTimeStep, MeltTimeStep, LayerID,
+                                    TileWakeTime);
             }
 
         } while (XSwitch == 0);
@@ -372,47 +486,118 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
             if (PrintTimeSeries)
                 IntermediateFileCounter = 0;
 
+            // If specified, move cells that cannot change during the remaining layers to the frozen region store
+            if (FreezeSolidifiedCells) {
+                int FrozenZ = calcFrozenZ(SimulationType, SpotRadius, LayerHeight, layernumber, NumberOfLayers, ZMin,
+                                          deltax, nz, ZMinLayer, ZMaxLayer);
+                FreezeBottomCells(id, Frozen, FrozenZ - Frozen.nzFrozen, nx, MyYSlices, GrainID, LayerID, CellType,
+                                  CritTimeStep, UndercoolingChange, UndercoolingCurrent, MeltTimeStep);
+                nzResident = nz - Frozen.nzFrozen;
+                LocalDomainSize = nx * MyYSlices * nzResident;
+            }
+
             // Determine new active cell domain size and offset from bottom of global domain
             ZBound_Low = calcZBound_Low(SimulationType, LayerHeight, layernumber + 1, ZMinLayer, ZMin, deltax);
             ZBound_High =
                 calcZBound_High(SimulationType, SpotRadius, LayerHeight, layernumber + 1, ZMin, deltax, nz, ZMaxLayer);
             nzActive = calcnzActive(ZBound_Low, ZBound_High, id, layernumber + 1);
+            // Offset from the bottom of the cells still stored in the views
+            ZBound_Low -= Frozen.nzFrozen;
+            ZBound_High -= Frozen.nzFrozen;
             LocalActiveDomainSize = calcLocalActiveDomainSize(nx, MyYSlices, nzActive);
             if (RemeltingYN) {
                 // Determine the bounds of the next layer: Z coordinates span ZBound_Low-ZBound_High, inclusive
-                // If the next layer's temperature data isn't already stored, it should be read
+                // If the next layer's temperature data isn't already stored, it should be read (or if it was read in
+                // the background, handed off to RawData)
                 if ((SimulationType == "R") && (LayerwiseTempRead)) {
-                    ReadTemperatureData(id, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, YMin, temp_paths,
-                                        NumberOfLayers, TempFilesInSeries, NumberOfTemperatureDataPoints, RawData,
-                                        FirstValue, LastValue, LayerwiseTempRead, layernumber + 1);
+                    std::string tempfile_nextlayer = temp_paths[(layernumber + 1) % TempFilesInSeries];
+                    if (!(getStoredTemperatureData(TempStore, tempfile_nextlayer, layernumber + 1, RawData, FirstValue,
+                                                   LastValue))) {
+                        if (!(finishTemperaturePrefetch(Prefetch, layernumber + 1, RawData, FirstValue, LastValue)))
+                            ReadTemperatureData(id, np, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, XMin,
+                                                YMin, ZMin, temp_paths, NumberOfLayers, TempFilesInSeries, RawData,
+                                                FirstValue, LastValue, LayerwiseTempRead, layernumber + 1,
+                                                TempReaderRanks, Coupling);
+                        storeTemperatureData(TempStore, tempfile_nextlayer, RawData);
+                    }
                 }
-                // With remelting, also reinitialize temperature views back to zero and resize LayerTimeTempHistory, in
-                // preparation for loading the next layer's (layernumber + 1) temperature data from RawData into the
-                // temperature views
+                // With remelting, also reinitialize temperature views back to zero and reallocate
+                // LayerTimeTempHistory, in preparation for loading the next layer's (layernumber + 1) temperature data
+                // from RawData into the temperature views
                 if (SimulationType == "S")
                     TempInit_SpotRemelt(layernumber + 1, G, R, SimulationType, id, nx, MyYSlices, MyYOffset, deltax,
-                                        deltat, ZBound_Low, nz, LocalActiveDomainSize, LocalDomainSize, CritTimeStep,
-                                        UndercoolingChange, UndercoolingCurrent, LayerHeight, irf.FreezingRange,
-                                        LayerID, NSpotsX, NSpotsY, SpotRadius, SpotOffset, LayerTimeTempHistory,
-                                        NumberOfSolidificationEvents, MeltTimeStep, MaxSolidificationEvents,
-                                        SolidificationEventCounter);
+                                        deltat, ZBound_Low, nzResident, LocalActiveDomainSize, LocalDomainSize,
+                                        CritTimeStep, UndercoolingChange, UndercoolingCurrent, LayerHeight,
+                                        irf.FreezingRange, LayerID, NSpotsX, NSpotsY, SpotRadius, SpotOffset,
+                                        LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                                        MeltTimeStep, MaxSolidificationEvents, SolidificationEventCounter);
+                else if (SimulationType == "L")
+                    TempInit_RasterRemelt(Raster, layernumber + 1, id, nx, MyYSlices, MyYOffset, ZBound_Low,
+                                          LocalActiveDomainSize, LocalDomainSize, CritTimeStep, UndercoolingChange,
+                                          UndercoolingCurrent, LayerID, LayerTimeTempHistory,
+                                          NumberOfSolidificationEvents, SolidificationEventOffset, MeltTimeStep,
+                                          MaxSolidificationEvents, SolidificationEventCounter);
                 else if (SimulationType == "R") {
-                    TempInit_ReadDataRemelt(
-                        layernumber + 1, id, nx, MyYSlices, nz, LocalActiveDomainSize, LocalDomainSize, MyYOffset,
-                        deltax, deltat, irf.FreezingRange, LayerTimeTempHistory, NumberOfSolidificationEvents,
-                        MaxSolidificationEvents, MeltTimeStep, CritTimeStep, UndercoolingChange, UndercoolingCurrent,
-                        XMin, YMin, ZMinLayer, LayerHeight, nzActive, ZBound_Low, FinishTimeStep, LayerID, FirstValue,
-                        LastValue, RawData, SolidificationEventCounter, TempFilesInSeries);
+                    if (EventStream.streaming())
+                        TempInit_ReadDataRemelt_Streamed(
+                            layernumber + 1, id, nx, MyYSlices, LocalActiveDomainSize, LocalDomainSize, MyYOffset,
+                            deltat, irf.FreezingRange, NumberOfSolidificationEvents, MaxSolidificationEvents,
+                            MeltTimeStep, CritTimeStep, UndercoolingChange, UndercoolingCurrent, ZMinLayer,
+                            LayerHeight, nzActive, ZBound_Low, FinishTimeStep, LayerID, FirstValue, LastValue, RawData,
+                            SolidificationEventCounter, TempFilesInSeries, EventStream);
+                    else
+                        TempInit_ReadDataRemelt(
+                            layernumber + 1, id, nx, MyYSlices, nzResident, LocalActiveDomainSize, LocalDomainSize,
+                            MyYOffset, deltax, deltat, irf.FreezingRange, LayerTimeTempHistory,
+                            NumberOfSolidificationEvents, SolidificationEventOffset, MaxSolidificationEvents,
+                            MeltTimeStep, CritTimeStep, UndercoolingChange, UndercoolingCurrent, ZMinLayer, LayerHeight,
+                            nzActive, ZBound_Low, FinishTimeStep, LayerID, FirstValue, LastValue, RawData,
+                            SolidificationEventCounter, TempFilesInSeries);
+                    // RawData is no longer needed for this layer: start reading the layer after it, if its data
+                    // isn't already stored
+                    std::string tempfile_layerafter = temp_paths[(layernumber + 2) % TempFilesInSeries];
+                    if ((PrefetchTempData) && (!(checkStoredTemperatureData(TempStore, tempfile_layerafter))))
+                        startTemperaturePrefetch(Prefetch, layernumber + 2, NumberOfLayers, TempFilesInSeries,
+                                                 temp_paths, XMin, YMin, ZMin, deltax, HT_deltax, HTtoCAratio,
+                                                 MyYSlices, MyYOffset);
+                }
+            }
+            else {
+                // Without remelting, cell types are initialized for cells above those initialized for the previous
+                // layer, if any. With LayerwiseTempInit, these cells' temperature fields are also initialized now
+                InitZ_Low = InitZ_High + 1;
+                if (LayerwiseTempInit) {
+                    InitZ_High = ZBound_High + Frozen.nzFrozen;
+                    TempInit_ReadDataNoRemelt_Layer(layernumber + 1, id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio,
+                                                    deltat, nz, CritTimeStep, UndercoolingChange, LayerID, ZMin,
+                                                    ZMinLayer, ZMaxLayer, LayerHeight, NumberOfLayers, FinishTimeStep,
+                                                    irf.FreezingRange, FirstValue, LastValue, RawData, ny, InitZ_Low,
+                                                    InitZ_High, Frozen.nzFrozen);
                 }
             }
 
-            // Update buffer size
+            // Trim the next layer's active region to the cells with temperature data, and update buffer sizes
+            calcActiveRegionBounds(SimulationType, id, layernumber + 1, nx, MyYSlices, nzActive, ZBound_Low,
+                                   CritTimeStep, XBound_Low, nxActive, YBound_Low, nyActive);
+            if (EventStream.streaming())
+                TrimEventStreamToActiveRegion(nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive,
+                                              EventStream, LayerTimeTempHistory, NumberOfSolidificationEvents,
+                                              SolidificationEventOffset, SolidificationEventCounter);
+            else if (RemeltingYN)
+                TrimEventDataToActiveRegion(nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive,
+                                            LayerTimeTempHistory, NumberOfSolidificationEvents,
+                                            SolidificationEventOffset, SolidificationEventCounter);
+            LocalActiveDomainSize = calcLocalActiveDomainSize(nxActive, nyActive, nzActive);
+            BufSizeX = nxActive;
             BufSizeZ = nzActive;
 
             // Resize and zero all view data relating to the active region from the last layer, in preparation for the
             // next layer
             ZeroResetViews(LocalActiveDomainSize, BufSizeX, BufSizeZ, DiagonalLength, CritDiagonalLength, DOCenter,
                            BufferNorthSend, BufferSouthSend, BufferNorthRecv, BufferSouthRecv, SteeringVector);
+            FreeHaloRequests(HaloSendRequests, HaloRecvRequests);
+            InitHaloRequests(NeighborRank_North, NeighborRank_South, BufferNorthSend, BufferSouthSend, BufferNorthRecv,
+                             BufferSouthRecv, BufSizeX, BufSizeZ, HaloSendRequests, HaloRecvRequests);
 
             MPI_Barrier(MPI_COMM_WORLD);
             if (id == 0)
@@ -424,26 +609,28 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
             // file, and the powder layers have already been initialized
             if ((!(UseSubstrateFile)) && (!(BaseplateThroughPowder)))
                 PowderInit(layernumber + 1, nx, ny, LayerHeight, ZMaxLayer, ZMin, deltax, MyYSlices, MyYOffset, id,
-                           GrainID, RNGSeed, NextLayer_FirstEpitaxialGrainID, PowderActiveFraction);
+                           GrainID, RNGSeed, NextLayer_FirstEpitaxialGrainID, PowderActiveFraction, Frozen.nzFrozen);
 
             // Initialize active cell data structures and nuclei locations for the next layer "layernumber + 1"
             if (RemeltingYN)
-                CellTypeInit_Remelt(nx, MyYSlices, LocalActiveDomainSize, CellType, CritTimeStep, id, ZBound_Low);
+                CellTypeInit_Remelt(nx, MyYSlices, nzActive, CellType, CritTimeStep, id, ZBound_Low);
             else
-                CellTypeInit_NoRemelt(layernumber + 1, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, nz,
-                                      LocalActiveDomainSize, LocalDomainSize, CellType, CritTimeStep, NeighborX,
-                                      NeighborY, NeighborZ, NGrainOrientations, GrainUnitVector, DiagonalLength,
-                                      GrainID, CritDiagonalLength, DOCenter, LayerID, BufferNorthSend, BufferSouthSend,
-                                      BufSizeX, AtNorthBoundary, AtSouthBoundary);
+                CellTypeInit_NoRemelt(layernumber + 1, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, XBound_Low,
+                                      nxActive, YBound_Low, nyActive, nzResident, LocalActiveDomainSize,
+                                      InitZ_Low - Frozen.nzFrozen, InitZ_High - Frozen.nzFrozen, CellType, CritTimeStep,
+                                      NeighborX, NeighborY, NeighborZ, NGrainOrientations, GrainUnitVector,
+                                      DiagonalLength, GrainID, CritDiagonalLength, DOCenter, LayerID, BufferNorthSend,
+                                      BufferSouthSend, BufSizeX, AtNorthBoundary, AtSouthBoundary);
 
             // Initialize potential nucleation event data for next layer "layernumber + 1"
             // Views containing nucleation data will be resized to the possible number of nuclei on a given MPI rank for
             // the next layer
-            NucleiInit(layernumber + 1, RNGSeed, MyYSlices, MyYOffset, nx, ny, nzActive, ZBound_Low, id, NMax, dTN,
-                       dTsigma, deltax, NucleiLocation, NucleationTimes_Host, NucleiGrainID, CellType, CritTimeStep,
-                       UndercoolingChange, LayerID, PossibleNuclei_ThisRankThisLayer, Nuclei_WholeDomain,
-                       AtNorthBoundary, AtSouthBoundary, RemeltingYN, NucleationCounter, MaxSolidificationEvents,
-                       NumberOfSolidificationEvents, LayerTimeTempHistory);
+            NucleiInit(layernumber + 1, RNGSeed, MyYSlices, MyYOffset, nx, ny, nzActive, ZBound_Low, XBound_Low,
+                       nxActive, YBound_Low, nyActive, id, NMax, dTN, dTsigma, deltax, NucleiLocation,
+                       NucleationTimes_Host, NucleiGrainID, CellType, CritTimeStep, UndercoolingChange, LayerID,
+                       PossibleNuclei_ThisRankThisLayer, Nuclei_WholeDomain, AtNorthBoundary, AtSouthBoundary,
+                       RemeltingYN, NucleationCounter, MaxSolidificationEvents, NumberOfSolidificationEvents,
+                       SolidificationEventOffset, LayerTimeTempHistory, EventStream);
 
             // Update ghost nodes for grain locations and attributes
             MPI_Barrier(MPI_COMM_WORLD);
@@ -451,7 +638,8 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
                 GhostNodes1D(-1, id, NeighborRank_North, NeighborRank_South, nx, MyYSlices, MyYOffset, NeighborX,
                              NeighborY, NeighborZ, CellType, DOCenter, GrainID, GrainUnitVector, DiagonalLength,
                              CritDiagonalLength, NGrainOrientations, BufferNorthSend, BufferSouthSend, BufferNorthRecv,
-                             BufferSouthRecv, BufSizeX, BufSizeZ, ZBound_Low);
+                             BufferSouthRecv, BufSizeX, BufSizeZ, ZBound_Low, XBound_Low, nxActive, YBound_Low,
+                             nyActive, HaloSendRequests, HaloRecvRequests);
             }
             if (id == 0)
                 std::cout << "New layer ghost nodes initialized" << std::endl;
@@ -471,6 +659,7 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
         }
     }
 
+    FreeHaloRequests(HaloSendRequests, HaloRecvRequests);
     double RunTime = MPI_Wtime() - StartRunTime;
     double StartOutTime = MPI_Wtime();
 
@@ -479,7 +668,8 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
         if (id == 0)
             std::cout << "Collecting data on rank 0 and printing to files" << std::endl;
         // Host mirrors of CellType and GrainID are not maintained - pass device views and perform copy inside of
-        // subroutine
+        // subroutine. GrainID and LayerID values of cells in the frozen region store are first restored to the views
+        UnfreezeBottomCells(Frozen, nx, MyYSlices, GrainID, LayerID);
         PrintExaCAData(id, NumberOfLayers - 1, np, nx, ny, nz, MyYSlices, MyYOffset, GrainID, CritTimeStep,
                        GrainUnitVector, LayerID, CellType, UndercoolingChange, UndercoolingCurrent, OutputFile,
                        NGrainOrientations, PathToOutput, 0, PrintMisorientation, PrintFinalUndercoolingVals,
@@ -511,8 +701,8 @@ void RunProgram_Reduced(int id, int np, std::string InputFile) {
     PrintExaCALog(id, np, InputFile, SimulationType, MyYSlices, MyYOffset, irf, deltax, NMax, dTN, dTsigma, temp_paths,
                   TempFilesInSeries, HT_deltax, RemeltingYN, deltat, NumberOfLayers, LayerHeight, SubstrateFileName,
                   SubstrateGrainSpacing, UseSubstrateFile, G, R, nx, ny, nz, FractSurfaceSitesActive, PathToOutput,
-                  NSpotsX, NSpotsY, SpotOffset, SpotRadius, OutputFile, InitTime, RunTime, OutTime, cycle, InitMaxTime,
-                  InitMinTime, NuclMaxTime, NuclMinTime, CreateSVMinTime, CreateSVMaxTime, CaptureMaxTime,
+                  NSpotsX, NSpotsY, SpotOffset, SpotRadius, Raster, OutputFile, InitTime, RunTime, OutTime, cycle,
+                  InitMaxTime, InitMinTime, NuclMaxTime, NuclMinTime, CreateSVMinTime, CreateSVMaxTime, CaptureMaxTime,
                   CaptureMinTime, GhostMaxTime, GhostMinTime, OutMaxTime, OutMinTime, XMin, XMax, YMin, YMax, ZMin,
                   ZMax);
 }
@@ -6,8 +6,12 @@
 #ifndef EXACA_RUN_HPP
 #define EXACA_RUN_HPP
 
+#include "CAtempcoupling.hpp"
+
 #include <string>
 
-void RunProgram_Reduced(int id, int np, std::string InputFile);
+// Temperature data sets in Coupling are used in place of the temperature files with the same names
+void RunProgram_Reduced(int id, int np, std::string InputFile,
+                        const TemperatureCoupling &Coupling = TemperatureCoupling());
 
 #endif
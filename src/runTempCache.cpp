@@ -0,0 +1,71 @@
+// Copyright 2021-2022 Lawrence Livermore National Security, LLC and other ExaCA Project Developers.
+// See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include "ExaCA.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include "mpi.h"
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+// Write a temperature cache file (extension .catcache) for each temperature file given on the command line, which can
+// then be listed in place of the temperature file in the temperature instructions file. Cache files written from the
+// same temperature file contents with the same heat transport data mesh size are reused. Cache files are only written
+// by rank 0 if run with multiple MPI ranks
+int main(int argc, char *argv[]) {
+    // Initialize MPI
+    int id;
+    MPI_Init(&argc, &argv);
+    // Initialize Kokkos
+    Kokkos::initialize(argc, argv);
+    int ExitCode = 0;
+    {
+        // Get individual process ID
+        MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+        // Errors in the input or in reading/writing files are reported, and the program exits after finalizing Kokkos
+        // and MPI
+        try {
+            if (argc < 3) {
+                throw std::runtime_error("Error: Usage is ExaCA-TemperatureCache <heat transport data mesh size in "
+                                         "microns> <temperature files>");
+            }
+            // Heat transport data mesh size is given in microns, converted to meters
+            char *MeshSizeEnd;
+            double HT_deltax = std::strtod(argv[1], &MeshSizeEnd) * 1.0e-6;
+            if ((MeshSizeEnd == argv[1]) || (*MeshSizeEnd != '\0'))
+                throw std::runtime_error("Error: Could not read heat transport data mesh size " + std::string(argv[1]));
+            for (int FileNumber = 2; (id == 0) && (FileNumber < argc); FileNumber++) {
+                std::string tempfile_thislayer = argv[FileNumber];
+                if (checkTemperatureCacheFormat(tempfile_thislayer))
+                    throw std::runtime_error("Error: " + tempfile_thislayer + " is already a temperature cache file");
+                std::string cachefile = getTemperatureCacheName(tempfile_thislayer);
+                std::uint64_t SourceHash = hashTemperatureFile(tempfile_thislayer);
+                if (checkTemperatureCacheCurrent(cachefile, SourceHash, HT_deltax))
+                    std::cout << "Temperature cache file " << cachefile << " is up to date" << std::endl;
+                else {
+                    writeTemperatureCache(tempfile_thislayer, cachefile, HT_deltax, SourceHash);
+                    std::cout << "Wrote temperature cache file " << cachefile << " from " << tempfile_thislayer
+                              << std::endl;
+                }
+            }
+        }
+        catch (const std::exception &Error) {
+            if (id == 0)
+                std::cerr << Error.what() << std::endl;
+            ExitCode = 1;
+        }
+    }
+    // Finalize Kokkos
+    Kokkos::finalize();
+    // Finalize MPI
+    MPI_Finalize();
+    return ExitCode;
+}
@@ -10,12 +10,20 @@
 #include "CAinterfacialresponse.hpp"
 #include "CAparsefiles.hpp"
 #include "CAprint.hpp"
+#include "CAtempcache.hpp"
+#include "CAtempprefetch.hpp"
+#include "CAtempstore.hpp"
 
 #include <gtest/gtest.h>
 
 #include "mpi.h"
 
+#include <algorithm>
+#include <array>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <locale>
 #include <string>
 #include <vector>
 
@@ -26,13 +34,14 @@ namespace Test {
 void testInputReadFromFile() {
 
     int id = 0;
-    // Three input files - one of each type
+    // Four input files - one of each type
     // Inp_DirSolidification.txt and Inp_SpotMelt.txt were installed from the examples directory
     // Since no temperature files exist in the repo, and there is no ability to write temperature files to a different
     // directory ( would need examples/Temperatures) using the C++11 standard, dummy input files are written and parsed
-    // to test an example problem that uses temperature data from a file.
+    // to test an example problem that uses temperature data from a file. A dummy input file is also written for a
+    // raster scan problem with remelting
     std::vector<std::string> InputFilenames = {"Inp_DirSolidification.txt", "Inp_SpotMelt.txt",
-                                               "Inp_TemperatureTest.txt"};
+                                               "Inp_TemperatureTest.txt", "Inp_RasterTest.txt"};
     std::vector<std::string> TemperatureFNames = {"1DummyTemperature.txt", "2DummyTemperature.txt"};
 
     // Write dummy input files for using read temperature data (Inp_TemperatureTest.txt)
@@ -64,13 +73,52 @@ void testInputReadFromFile() {
     TestDataFile << "Extra set of wall cells in lateral domain directions: N" << std::endl;
     TestDataFile << "Random seed for grains and nuclei generation: 2.0" << std::endl;
     TestDataFile << "Substrate filename: DummySubstrate.txt" << std::endl;
+    // Not compatible with printing final undercooling values, should be turned off
+    TestDataFile << "Store fully solidified cells as grain IDs only: Y" << std::endl;
+    TestDataFile << "Run-length encode stored solidified cells: N" << std::endl;
     TestDataFile.close();
 
+    // Write dummy input file for a raster scan problem with remelting (Inp_RasterTest.txt)
+    std::ofstream TestRasterFile;
+    TestRasterFile.open(InputFilenames[3]);
+    TestRasterFile << "Test problem raster scan" << std::endl;
+    TestRasterFile << "*****" << std::endl;
+    TestRasterFile << "Problem type: LM" << std::endl;
+    TestRasterFile << "Decomposition strategy: 1" << std::endl;
+    TestRasterFile << "Material: Inconel625" << std::endl;
+    TestRasterFile << "Cell size: 1" << std::endl;
+    TestRasterFile << "Heterogeneous nucleation density: 10" << std::endl;
+    TestRasterFile << "Mean nucleation undercooling: 5" << std::endl;
+    TestRasterFile << "Standard deviation of nucleation undercooling: 0.5" << std::endl;
+    TestRasterFile << "Path to output: ExaCA" << std::endl;
+    TestRasterFile << "Output file base name: TestRaster" << std::endl;
+    TestRasterFile << "File of grain orientations: GrainOrientationVectors.csv" << std::endl;
+    TestRasterFile << "Print file of grain misorientation values: Y" << std::endl;
+    TestRasterFile << "Print file of final undercooling values: N" << std::endl;
+    TestRasterFile << "Print file of all ExaCA data: N" << std::endl;
+    TestRasterFile << "Time step: 0.05" << std::endl;
+    TestRasterFile << "Absorbed beam power: 100" << std::endl;
+    TestRasterFile << "Scan speed: 1" << std::endl;
+    TestRasterFile << "Thermal conductivity: 25" << std::endl;
+    TestRasterFile << "Thermal diffusivity: 0.000005" << std::endl;
+    TestRasterFile << "Preheat temperature: 300" << std::endl;
+    TestRasterFile << "Liquidus temperature: 1600" << std::endl;
+    TestRasterFile << "Track length: 200" << std::endl;
+    TestRasterFile << "Hatch spacing: 40" << std::endl;
+    TestRasterFile << "Number of tracks: 3" << std::endl;
+    TestRasterFile << "Number of layers: 2" << std::endl;
+    TestRasterFile << "Offset between layers: 10" << std::endl;
+    TestRasterFile << "Substrate grain spacing: 10" << std::endl;
+    TestRasterFile.close();
+
     // Write test temperature instructions file - don't give HT_deltax, let value default to deltax
     std::ofstream TestTField;
     TestTField.open("TInstructions.txt");
     TestTField << "Number of layers: 2" << std::endl;
     TestTField << "Offset between layers: 1" << std::endl;
+    TestTField << "Number of MPI ranks reading temperature data: 2" << std::endl;
+    TestTField << "Memory for reusing temperature data: 64" << std::endl;
+    TestTField << "Time steps per window of streamed solidification events: 500" << std::endl;
     TestTField << "*****" << std::endl;
     TestTField << ".//" << TemperatureFNames[0] << std::endl;
     TestTField << ".//" << TemperatureFNames[1] << std::endl;
@@ -94,28 +142,32 @@ void testInputReadFromFile() {
     // Read and parse each input file
     for (auto FileName : InputFilenames) {
         int TempFilesInSeries, NumberOfLayers, LayerHeight, nx, ny, nz, PrintDebug, NSpotsX, NSpotsY, SpotOffset,
-            SpotRadius, TimeSeriesInc, RVESize;
+            SpotRadius, TimeSeriesInc, RVESize, TempReaderRanks, TempReuseMemory, TempEventWindow;
         float SubstrateGrainSpacing;
         double deltax, NMax, dTN, dTsigma, HT_deltax, deltat, G, R, FractSurfaceSitesActive, RNGSeed, PowderDensity;
         bool RemeltingYN, PrintMisorientation, PrintFinalUndercoolingVals, PrintFullOutput, PrintTimeSeries,
             UseSubstrateFile, PrintIdleTimeSeriesFrames, PrintDefaultRVE = false, BaseplateThroughPowder,
-                                                         LayerwiseTempInit, PrintBinary;
+                                                         LayerwiseTempInit, PrintBinary, FreezeSolidifiedCells,
+                                                         RunLengthEncodeFrozen;
         std::string SimulationType, OutputFile, GrainOrientationFile, temppath, tempfile, SubstrateFileName,
             PathToOutput, MaterialFileName;
         std::vector<std::string> temp_paths;
+        RosenthalRasterProvider Raster;
         InputReadFromFile(id, FileName, SimulationType, deltax, NMax, dTN, dTsigma, OutputFile, GrainOrientationFile,
                           TempFilesInSeries, temp_paths, HT_deltax, RemeltingYN, deltat, NumberOfLayers, LayerHeight,
                           MaterialFileName, SubstrateFileName, SubstrateGrainSpacing, UseSubstrateFile, G, R, nx, ny,
                           nz, FractSurfaceSitesActive, PathToOutput, PrintDebug, PrintMisorientation,
                           PrintFinalUndercoolingVals, PrintFullOutput, NSpotsX, NSpotsY, SpotOffset, SpotRadius,
                           PrintTimeSeries, TimeSeriesInc, PrintIdleTimeSeriesFrames, PrintDefaultRVE, RNGSeed,
-                          BaseplateThroughPowder, PowderDensity, RVESize, LayerwiseTempInit, PrintBinary);
+                          BaseplateThroughPowder, PowderDensity, RVESize, LayerwiseTempInit, PrintBinary,
+                          FreezeSolidifiedCells, RunLengthEncodeFrozen, TempReaderRanks, TempReuseMemory,
+                          TempEventWindow, Raster);
         InterfacialResponseFunction irf(0, MaterialFileName, deltat, deltax);
 
         // Check the results
         // The existence of the specified orientation, substrate, and temperature filenames was already checked within
         // InputReadFromFile
-        // These should be the same for all 3 test problems
+        // These should be the same for all 4 test problems
         EXPECT_DOUBLE_EQ(deltax, 1.0 * pow(10, -6));
         EXPECT_DOUBLE_EQ(NMax, 1.0 * pow(10, 13));
         EXPECT_DOUBLE_EQ(dTN, 5.0);
@@ -127,7 +179,7 @@ void testInputReadFromFile() {
         EXPECT_DOUBLE_EQ(irf.D, 0);
         EXPECT_DOUBLE_EQ(irf.FreezingRange, 210);
 
-        // These are different for all 3 test problems
+        // These are different for all 4 test problems
         if (FileName == "Inp_DirSolidification.txt") {
             EXPECT_TRUE(PrintTimeSeries);
             EXPECT_EQ(TimeSeriesInc, 5250);
@@ -145,6 +197,8 @@ void testInputReadFromFile() {
             EXPECT_TRUE(PrintFullOutput);
             EXPECT_DOUBLE_EQ(RNGSeed, 0.0);
             EXPECT_FALSE(PrintBinary);
+            EXPECT_FALSE(FreezeSolidifiedCells);
+            EXPECT_TRUE(RunLengthEncodeFrozen);
         }
         else if (FileName == "Inp_SpotMelt.txt") {
             EXPECT_TRUE(PrintTimeSeries);
@@ -167,6 +221,8 @@ void testInputReadFromFile() {
             EXPECT_TRUE(PrintFullOutput);
             EXPECT_DOUBLE_EQ(RNGSeed, 0.0);
             EXPECT_FALSE(PrintBinary);
+            EXPECT_FALSE(FreezeSolidifiedCells);
+            EXPECT_TRUE(RunLengthEncodeFrozen);
         }
         else if (FileName == "Inp_TemperatureTest.txt") {
             EXPECT_DOUBLE_EQ(deltat, 1.5 * pow(10, -6));
@@ -177,6 +233,9 @@ void testInputReadFromFile() {
             EXPECT_FALSE(BaseplateThroughPowder);
             EXPECT_DOUBLE_EQ(PowderDensity, 0.001);
             EXPECT_DOUBLE_EQ(HT_deltax, deltax);
+            EXPECT_EQ(TempReaderRanks, 2);
+            EXPECT_EQ(TempReuseMemory, 64);
+            EXPECT_EQ(TempEventWindow, 500);
             EXPECT_TRUE(OutputFile == "Test");
             EXPECT_TRUE(temp_paths[0] == ".//1DummyTemperature.txt");
             EXPECT_TRUE(temp_paths[1] == ".//2DummyTemperature.txt");
@@ -186,6 +245,34 @@ void testInputReadFromFile() {
             EXPECT_FALSE(PrintFullOutput);
             EXPECT_DOUBLE_EQ(RNGSeed, 2.0);
             EXPECT_TRUE(PrintBinary);
+            EXPECT_FALSE(FreezeSolidifiedCells);
+            EXPECT_FALSE(RunLengthEncodeFrozen);
+        }
+        else if (FileName == "Inp_RasterTest.txt") {
+            EXPECT_TRUE(SimulationType == "L");
+            EXPECT_TRUE(RemeltingYN);
+            EXPECT_DOUBLE_EQ(deltat, 0.05 * pow(10, -6));
+            EXPECT_DOUBLE_EQ(Raster.AbsorbedPower, 100.0);
+            EXPECT_DOUBLE_EQ(Raster.ScanSpeed, 1.0);
+            EXPECT_DOUBLE_EQ(Raster.Diffusivity, 0.000005);
+            EXPECT_DOUBLE_EQ(Raster.LiquidusRise, 1300.0);
+            EXPECT_EQ(Raster.TrackLength, 200);
+            EXPECT_EQ(Raster.HatchSpacing, 40);
+            EXPECT_EQ(Raster.NumberOfTracks, 3);
+            // The melt pool depth sets the spot radius used for the layer bounds, and the domain size
+            EXPECT_EQ(SpotRadius, Raster.PoolRadius);
+            EXPECT_GE(Raster.calcPeakTemperatureRise(SpotRadius * deltax), Raster.LiquidusRise);
+            EXPECT_LT(Raster.calcPeakTemperatureRise((SpotRadius + 1) * deltax), Raster.LiquidusRise);
+            EXPECT_EQ(NumberOfLayers, 2);
+            EXPECT_EQ(LayerHeight, 10);
+            EXPECT_EQ(nx, 201);
+            EXPECT_EQ(ny, 2 * SpotRadius + 81);
+            EXPECT_EQ(nz, SpotRadius + 11);
+            EXPECT_FALSE(UseSubstrateFile);
+            EXPECT_FLOAT_EQ(SubstrateGrainSpacing, 10.0);
+            EXPECT_TRUE(OutputFile == "TestRaster");
+            EXPECT_FALSE(PrintFinalUndercoolingVals);
+            EXPECT_FALSE(PrintFullOutput);
         }
     }
 }
@@ -385,6 +472,44 @@ void testcalcZBound_High() {
     }
 }
 
+void testcalcFrozenZ() {
+
+    int SpotRadius = 100;
+    int LayerHeight = 10;
+    double ZMin = 0.5 * pow(10, -6);
+    double deltax = 1.0 * pow(10, -6);
+    int nz = 191;
+    int NumberOfLayers = 10;
+    double *ZMinLayer = new double[NumberOfLayers];
+    double *ZMaxLayer = new double[NumberOfLayers];
+    for (int layernumber = 0; layernumber < NumberOfLayers; layernumber++) {
+        // Same layer bounds as used in the ZBound_Low/ZBound_High tests, for both problem types
+        ZMinLayer[layernumber] = ZMin + layernumber * LayerHeight * deltax;
+        ZMaxLayer[layernumber] = ZMin + SpotRadius * deltax + layernumber * LayerHeight * deltax;
+    }
+    // Cells below the bottom of the next layer are frozen, or the top of the last layer once it finishes
+    for (int layernumber = 0; layernumber < NumberOfLayers; layernumber++) {
+        int FrozenZ_Expected = LayerHeight * (layernumber + 1);
+        if (layernumber == NumberOfLayers - 1)
+            FrozenZ_Expected = SpotRadius + LayerHeight * layernumber;
+        int FrozenZ_S = calcFrozenZ("S", SpotRadius, LayerHeight, layernumber, NumberOfLayers, ZMin, deltax, nz,
+                                    ZMinLayer, ZMaxLayer);
+        EXPECT_EQ(FrozenZ_S, FrozenZ_Expected);
+        int FrozenZ_R = calcFrozenZ("R", SpotRadius, LayerHeight, layernumber, NumberOfLayers, ZMin, deltax, nz,
+                                    ZMinLayer, ZMaxLayer);
+        EXPECT_EQ(FrozenZ_R, FrozenZ_Expected);
+    }
+    // A shallow layer 5 (Z = 50 through 55) has powder starting below its lower bound, at Z = 46, and caps the frozen
+    // region at its top once it finishes
+    ZMaxLayer[5] = ZMin + 55 * deltax;
+    std::vector<int> FrozenZ_Expected = {10, 20, 30, 40, 46, 55, 70, 80, 90, 190};
+    for (int layernumber = 0; layernumber < NumberOfLayers; layernumber++) {
+        int FrozenZ_R = calcFrozenZ("R", SpotRadius, LayerHeight, layernumber, NumberOfLayers, ZMin, deltax, nz,
+                                    ZMinLayer, ZMaxLayer);
+        EXPECT_EQ(FrozenZ_R, FrozenZ_Expected[layernumber]);
+    }
+}
+
 void testcalcnzActive() {
 
     int id = 0;
@@ -456,7 +581,7 @@ void testFindXYZBounds(bool TestBinaryInputRead) {
     double *ZMinLayer = new double[NumberOfLayers];
     double *ZMaxLayer = new double[NumberOfLayers];
 
-    FindXYZBounds("R", 0, deltax, nx, ny, nz, temp_paths, XMin, XMax, YMin, YMax, ZMin, ZMax, LayerHeight,
+    FindXYZBounds("R", 0, 1, deltax, nx, ny, nz, temp_paths, XMin, XMax, YMin, YMax, ZMin, ZMax, LayerHeight,
                   NumberOfLayers, TempFilesInSeries, ZMinLayer, ZMaxLayer, 0);
 
     EXPECT_DOUBLE_EQ(XMin, 0.0);
@@ -476,6 +601,27 @@ void testFindXYZBounds(bool TestBinaryInputRead) {
     EXPECT_EQ(nx, 4);
     EXPECT_EQ(ny, 3);
     EXPECT_EQ(nz, 5);
+
+    // Reading the file in multiple parts should give the same min/max coordinates when combined, with parts too small
+    // to contain data points returning max/lowest values
+    std::array<double, 6> ExpectedMinMax = {0.0, 3 * deltax, 0.0, 2 * deltax, 0.0, 2 * deltax};
+    for (int NumParts = 2; NumParts <= 50; NumParts += 8) {
+        std::array<double, 6> CombinedMinMax;
+        for (int n = 0; n < 3; n++) {
+            CombinedMinMax[2 * n] = std::numeric_limits<double>::max();
+            CombinedMinMax[2 * n + 1] = std::numeric_limits<double>::lowest();
+        }
+        for (int Part = 0; Part < NumParts; Part++) {
+            std::array<double, 6> PartMinMax =
+                parseTemperatureCoordinateMinMax(TestFilename, TestBinaryInputRead, Part, NumParts);
+            for (int n = 0; n < 3; n++) {
+                CombinedMinMax[2 * n] = std::min(CombinedMinMax[2 * n], PartMinMax[2 * n]);
+                CombinedMinMax[2 * n + 1] = std::max(CombinedMinMax[2 * n + 1], PartMinMax[2 * n + 1]);
+            }
+        }
+        for (int n = 0; n < 6; n++)
+            EXPECT_DOUBLE_EQ(CombinedMinMax[n], ExpectedMinMax[n]);
+    }
 }
 
 void testReadTemperatureData(int NumberOfLayers, bool LayerwiseTempRead, bool TestBinaryInputRead) {
@@ -560,56 +706,405 @@ void testReadTemperatureData(int NumberOfLayers, bool LayerwiseTempRead, bool Te
         int TempFilesInSeries = 2;
         int *FirstValue = new int[NumberOfLayers];
         int *LastValue = new int[NumberOfLayers];
-        unsigned int NumberOfTemperatureDataPoints = 0;
 
         // Read in data to "RawData"
-        std::vector<double> RawData(9);
+        RawTemperatureData RawData;
 
-        ReadTemperatureData(id, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, YMin, temp_paths, NumberOfLayers,
-                            TempFilesInSeries, NumberOfTemperatureDataPoints, RawData, FirstValue, LastValue,
-                            LayerwiseTempRead, layernumber);
+        ReadTemperatureData(id, 1, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, 0.0, YMin, 0.0, temp_paths,
+                            NumberOfLayers, TempFilesInSeries, RawData, FirstValue, LastValue, LayerwiseTempRead,
+                            layernumber, 0);
 
         // Check the results.
-        // Does each rank have the right number of temperature data points? Each rank should have six (x,y,z,tm,tl,cr)
-        // for each of the 9 cells in the subdomain
+        // Does each rank have the right number of temperature data points? Each rank should have one data point for
+        // each of the 9 cells in the subdomain
         // If both files were read, twice as many temperature data points per file should be present
         int NumTempPointsMultiplier;
         if (LayerwiseTempRead)
             NumTempPointsMultiplier = 1;
         else
             NumTempPointsMultiplier = std::min(NumberOfLayers, TempFilesInSeries);
-        EXPECT_EQ(NumberOfTemperatureDataPoints, 54 * NumTempPointsMultiplier);
+        EXPECT_EQ(RawData.size(), 9 * NumTempPointsMultiplier);
         // Ratio of HT cell size and CA cell size should be 1
         EXPECT_EQ(HTtoCAratio, 1);
         int NumberOfCellsPerRank = 9;
         // Does each rank have the right temperature data values?
         for (int layercounter = 0; layercounter < NumTempPointsMultiplier; layercounter++) {
             for (int n = 0; n < NumberOfCellsPerRank; n++) {
-                double ExpectedValues_ThisDataPoint[6];
-                // Location on local grid
-                int CARow = n % 3;
-                int CACol = n / 3;
-                // X Coordinate
-                ExpectedValues_ThisDataPoint[0] = CARow * deltax;
-                // Y Coordinate
-                ExpectedValues_ThisDataPoint[1] = (CACol + 3 * id) * deltax;
-                // Z Coordinate
-                ExpectedValues_ThisDataPoint[2] = deltax * layercounter;
-                int XInt = ExpectedValues_ThisDataPoint[0] / deltax;
-                int YInt = ExpectedValues_ThisDataPoint[1] / deltax;
-                // Melting time
-                ExpectedValues_ThisDataPoint[3] = XInt * YInt;
-                // Liquidus time
-                ExpectedValues_ThisDataPoint[4] = XInt * YInt + XInt;
-                // Cooling rate
-                ExpectedValues_ThisDataPoint[5] = XInt * YInt + YInt;
-                for (int nn = 0; nn < 6; nn++) {
-                    EXPECT_DOUBLE_EQ(ExpectedValues_ThisDataPoint[nn],
-                                     RawData[NumberOfCellsPerRank * 6 * layercounter + 6 * n + nn]);
+                int DataPoint = NumberOfCellsPerRank * layercounter + n;
+                // Location on the CA grid
+                int XInt = n % 3;
+                int YInt = n / 3 + 3 * id;
+                EXPECT_EQ(RawData.XInt[DataPoint], XInt);
+                EXPECT_EQ(RawData.YInt[DataPoint], YInt);
+                EXPECT_EQ(RawData.ZInt[DataPoint], layercounter);
+                // Melting time, liquidus time, and cooling rate
+                EXPECT_DOUBLE_EQ(RawData.TMelting[DataPoint], XInt * YInt);
+                EXPECT_DOUBLE_EQ(RawData.TLiquidus[DataPoint], XInt * YInt + XInt);
+                EXPECT_DOUBLE_EQ(RawData.CoolingRate[DataPoint], XInt * YInt + YInt);
+            }
+        }
+    }
+}
+
+// Decimal separator of ',' instead of '.', to check that temperature file parsing doesn't depend on the global locale
+struct CommaDecimalSeparator : std::numpunct<char> {
+    char do_decimal_point() const { return ','; }
+};
+
+void testParseTemperatureDataChunk() {
+
+    double deltax = 1 * pow(10, -6);
+    int nx = 3;
+    int ny = 14;
+    // Write an ASCII temperature file, with values of different lengths so that lines are not all the same length, and
+    // trailing whitespace on some lines
+    std::string TestTempFileName = "TestDataChunks.txt";
+    std::ofstream TestDataFile;
+    TestDataFile.open(TestTempFileName);
+    TestDataFile << "x, y, z, tm, tl, cr" << std::endl;
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            TestDataFile << i * deltax << "," << j * deltax << "," << 0.0 << "," << 0.125 * i * j << ","
+                         << 1000.5 + i + j << "," << static_cast<double>(j);
+            if ((i + j) % 4 == 0)
+                TestDataFile << " \r";
+            TestDataFile << std::endl;
+        }
+    }
+    TestDataFile.close();
+    std::ifstream TestDataStream(TestTempFileName);
+    std::string Text((std::istreambuf_iterator<char>(TestDataStream)), std::istreambuf_iterator<char>());
+    TestDataStream.close();
+    long int TextSize = Text.size();
+    long int DataStart = Text.find('\n') + 1;
+
+    // Expected data points, from parsing the file serially one line at a time
+    std::vector<int> LowerYBounds_All = {std::numeric_limits<int>::min()};
+    std::vector<int> UpperYBounds_All = {std::numeric_limits<int>::max()};
+    std::vector<std::vector<double>> FileData(1);
+    parseTemperatureDataByRank(TestTempFileName, 0.0, deltax, LowerYBounds_All, UpperYBounds_All, FileData, false, 0,
+                               1);
+    int NumDataPoints = FileData[0].size() / 6;
+    EXPECT_EQ(NumDataPoints, nx * ny);
+
+    // Parse the file in chunks split at different positions: at the start of the data, at the start of a line, in the
+    // middle of a line, just before and just after a line break, and in the middle of the last line. Chunks should
+    // give the same data points as serial parsing with or without a Y bound, even if the global locale uses a
+    // different decimal separator
+    long int Line4Start = Text.find('\n', DataStart);
+    for (int Line = 0; Line < 3; Line++)
+        Line4Start = Text.find('\n', Line4Start + 1);
+    Line4Start++;
+    std::vector<std::vector<long int>> ChunkBounds = {
+        {DataStart, TextSize},
+        {DataStart, Line4Start, TextSize},
+        {DataStart, Line4Start + 5, TextSize},
+        {DataStart, Line4Start - 1, Line4Start + 1, TextSize},
+        {DataStart, DataStart + 1, Line4Start + 3, TextSize - 4, TextSize}};
+    std::vector<int> LowerYBounds = {std::numeric_limits<int>::min(), 4};
+    std::vector<int> UpperYBounds = {std::numeric_limits<int>::max(), 9};
+    std::locale DefaultLocale = std::locale::global(std::locale(std::locale::classic(), new CommaDecimalSeparator));
+    for (std::size_t Bounds = 0; Bounds < LowerYBounds.size(); Bounds++) {
+        RawTemperatureData RawData_Serial(0.0, 0.0, 0.0, deltax);
+        for (int DataPoint = 0; DataPoint < NumDataPoints; DataPoint++) {
+            int YInt = round(FileData[0][6 * DataPoint + 1] / deltax);
+            if ((YInt >= LowerYBounds[Bounds]) && (YInt <= UpperYBounds[Bounds]))
+                RawData_Serial.addPoint(&FileData[0][6 * DataPoint]);
+        }
+        for (std::size_t Split = 0; Split < ChunkBounds.size(); Split++) {
+            RawTemperatureData RawData(0.0, 0.0, 0.0, deltax);
+            for (std::size_t Chunk = 0; Chunk < ChunkBounds[Split].size() - 1; Chunk++) {
+                RawTemperatureData ChunkData(0.0, 0.0, 0.0, deltax);
+                std::string ChunkError =
+                    parseTemperatureDataChunk(Text.c_str(), TextSize, ChunkBounds[Split][Chunk],
+                                              ChunkBounds[Split][Chunk + 1], LowerYBounds[Bounds],
+                                              UpperYBounds[Bounds], ChunkData);
+                EXPECT_TRUE(ChunkError.empty());
+                RawData.append(ChunkData);
+            }
+            EXPECT_EQ(RawData.size(), RawData_Serial.size());
+            for (int DataPoint = 0; DataPoint < std::min(RawData.size(), RawData_Serial.size()); DataPoint++) {
+                EXPECT_EQ(RawData.XInt[DataPoint], RawData_Serial.XInt[DataPoint]);
+                EXPECT_EQ(RawData.YInt[DataPoint], RawData_Serial.YInt[DataPoint]);
+                EXPECT_EQ(RawData.ZInt[DataPoint], RawData_Serial.ZInt[DataPoint]);
+                EXPECT_DOUBLE_EQ(RawData.TMelting[DataPoint], RawData_Serial.TMelting[DataPoint]);
+                EXPECT_DOUBLE_EQ(RawData.TLiquidus[DataPoint], RawData_Serial.TLiquidus[DataPoint]);
+                EXPECT_DOUBLE_EQ(RawData.CoolingRate[DataPoint], RawData_Serial.CoolingRate[DataPoint]);
+            }
+        }
+    }
+
+    // A last line without a newline should be parsed without reading past the end of the text
+    std::vector<char> LastLine = {'0', ',', '0', ',', '0', ',', '3', '.', '5', ',', '4', ',', '5'};
+    RawTemperatureData LastLineData(0.0, 0.0, 0.0, deltax);
+    std::string LastLineError = parseTemperatureDataChunk(LastLine.data(), LastLine.size(), 0, LastLine.size(),
+                                                          std::numeric_limits<int>::min(),
+                                                          std::numeric_limits<int>::max(), LastLineData);
+    EXPECT_TRUE(LastLineError.empty());
+    EXPECT_EQ(LastLineData.size(), 1);
+    if (LastLineData.size() == 1) {
+        EXPECT_DOUBLE_EQ(LastLineData.TMelting[0], 3.5);
+        EXPECT_DOUBLE_EQ(LastLineData.CoolingRate[0], 5.0);
+    }
+
+    // Lines with a value that isn't a number (including a missing last value, which should not be taken from the next
+    // line), or with anything other than whitespace after the last value, should not be parsed
+    std::vector<std::string> BadLines = {"0,1,2,3,4,5 x\n", "0,1,2,3,4x,5\n", "0,1,2,3,4,5.0.5\n",
+                                         "0,1,2,,4,5\n",    "0,1,2,3,4,\n",  "0,1,2,3,4, \n5,6,7,8,9,10\n"};
+    for (std::size_t Line = 0; Line < BadLines.size(); Line++) {
+        RawTemperatureData ChunkData(0.0, 0.0, 0.0, deltax);
+        long int LineSize = BadLines[Line].size();
+        std::string ChunkError = parseTemperatureDataChunk(BadLines[Line].c_str(), LineSize, 0, LineSize,
+                                                           std::numeric_limits<int>::min(),
+                                                           std::numeric_limits<int>::max(), ChunkData);
+        EXPECT_FALSE(ChunkError.empty());
+    }
+    std::locale::global(DefaultLocale);
+}
+
+void testParseTemperatureData_Mapped() {
+
+    double deltax = 1 * pow(10, -6);
+    int nx = 3;
+    int ny = 5;
+    // Write a binary temperature file, and a copy with an incomplete data point (3 values) at the end
+    std::string TestTempFileName = "TestDataMapped.catemp";
+    std::string TestTempFileName_Incomplete = "TestDataMapped_Incomplete.catemp";
+    std::ofstream TestDataFile(TestTempFileName, std::ios::binary);
+    std::ofstream TestDataFile_Incomplete(TestTempFileName_Incomplete, std::ios::binary);
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            std::array<double, 6> XYZTemperaturePoint = {i * deltax, j * deltax, 0.0, static_cast<double>(i * j),
+                                                         static_cast<double>(i * j + i),
+                                                         static_cast<double>(i * j + j)};
+            for (int component = 0; component < 6; component++) {
+                WriteData(TestDataFile, XYZTemperaturePoint[component], true);
+                WriteData(TestDataFile_Incomplete, XYZTemperaturePoint[component], true);
+            }
+        }
+    }
+    for (int component = 0; component < 3; component++)
+        WriteData(TestDataFile_Incomplete, 0.0, true);
+    TestDataFile.close();
+    TestDataFile_Incomplete.close();
+
+    // Read the points with Y coordinates 1 through 3 through the memory-mapped file
+    RawTemperatureData RawData(0.0, 0.0, 0.0, deltax);
+    parseTemperatureData(TestTempFileName, 1, 3, RawData, true, false);
+    EXPECT_EQ(RawData.size(), 3 * nx);
+    for (int DataPoint = 0; DataPoint < std::min(RawData.size(), 3 * nx); DataPoint++) {
+        int XInt = DataPoint % nx;
+        int YInt = DataPoint / nx + 1;
+        EXPECT_EQ(RawData.XInt[DataPoint], XInt);
+        EXPECT_EQ(RawData.YInt[DataPoint], YInt);
+        EXPECT_EQ(RawData.ZInt[DataPoint], 0);
+        EXPECT_DOUBLE_EQ(RawData.TMelting[DataPoint], static_cast<double>(XInt * YInt));
+        EXPECT_DOUBLE_EQ(RawData.TLiquidus[DataPoint], static_cast<double>(XInt * YInt + XInt));
+        EXPECT_DOUBLE_EQ(RawData.CoolingRate[DataPoint], static_cast<double>(XInt * YInt + YInt));
+    }
+
+    // A file whose size isn't a whole number of data points should not be read
+    RawTemperatureData RawData_Incomplete(0.0, 0.0, 0.0, deltax);
+    EXPECT_THROW(parseTemperatureData(TestTempFileName_Incomplete, 1, 3, RawData_Incomplete, true, false),
+                 std::runtime_error);
+}
+
+void testTemperatureCache(bool TestBinaryInputRead) {
+
+    double deltax = 1 * pow(10, -6);
+    double HT_deltax = 1 * pow(10, -6);
+    int nx = 3;
+    int ny = 12;
+    int nz = 2;
+    // Write temperature data with decreasing Y coordinates, with the top layer of cells melting and solidifying twice
+    std::string TestTempFileName = "TestDataCache";
+    if (TestBinaryInputRead)
+        TestTempFileName = TestTempFileName + ".catemp";
+    else
+        TestTempFileName = TestTempFileName + ".txt";
+    std::ofstream TestDataFile;
+    if (TestBinaryInputRead)
+        TestDataFile.open(TestTempFileName, std::ios::out | std::ios::binary);
+    else {
+        TestDataFile.open(TestTempFileName);
+        TestDataFile << "x, y, z, tm, tl, cr" << std::endl;
+    }
+    for (int k = 0; k <= nz; k++) {
+        for (int j = ny - 1; j >= 0; j--) {
+            for (int i = 0; i < nx; i++) {
+                std::array<double, 6> XYZTemperaturePoint = {i * deltax,
+                                                             j * deltax,
+                                                             std::min(k, 1) * deltax,
+                                                             static_cast<double>(i * j + k),
+                                                             static_cast<double>(i + k),
+                                                             static_cast<double>(j + k)};
+                for (int n = 0; n < 6; n++) {
+                    if (TestBinaryInputRead)
+                        WriteData(TestDataFile, XYZTemperaturePoint[n], TestBinaryInputRead);
+                    else {
+                        TestDataFile << XYZTemperaturePoint[n];
+                        if (n < 5)
+                            TestDataFile << ",";
+                        else
+                            TestDataFile << std::endl;
+                    }
                 }
             }
         }
     }
+    TestDataFile.close();
+
+    // Write the cache file and check the header
+    std::string TestCacheFileName = getTemperatureCacheName(TestTempFileName);
+    EXPECT_EQ(TestCacheFileName, "TestDataCache.catcache");
+    EXPECT_TRUE(checkTemperatureCacheFormat(TestCacheFileName));
+    EXPECT_FALSE(checkTemperatureCacheFormat(TestTempFileName));
+    std::uint64_t SourceHash = hashTemperatureFile(TestTempFileName);
+    EXPECT_FALSE(checkTemperatureCacheCurrent(TestCacheFileName, SourceHash, HT_deltax));
+    writeTemperatureCache(TestTempFileName, TestCacheFileName, HT_deltax, SourceHash);
+    EXPECT_TRUE(checkTemperatureCacheCurrent(TestCacheFileName, SourceHash, HT_deltax));
+    EXPECT_FALSE(checkTemperatureCacheCurrent(TestCacheFileName, SourceHash + 1, HT_deltax));
+    EXPECT_FALSE(checkTemperatureCacheCurrent(TestCacheFileName, SourceHash, 2 * HT_deltax));
+    TemperatureCacheHeader Header = readTemperatureCacheHeader(TestCacheFileName);
+    EXPECT_EQ(static_cast<int>(Header.NumDataPoints), nx * ny * (nz + 1));
+    EXPECT_EQ(static_cast<int>(Header.NumYSlices), ny);
+    std::array<double, 6> ExpectedXYZMinMax = {0.0, (nx - 1) * deltax, 0.0, (ny - 1) * deltax, 0.0, deltax};
+    for (int n = 0; n < 6; n++)
+        EXPECT_DOUBLE_EQ(Header.XYZMinMax[n], ExpectedXYZMinMax[n]);
+    EXPECT_DOUBLE_EQ(Header.HT_deltax, HT_deltax);
+
+    // Each range of Y coordinates read from the cache file should contain the same data points as read from the
+    // temperature file, in the same order (since the temperature fields are placed from RawData, they are then also the
+    // same)
+    std::vector<int> LowerYBounds = {0, 3, 5, 11, -2, 14};
+    std::vector<int> UpperYBounds = {2, 7, 5, 13, 0, 16};
+    for (std::size_t Range = 0; Range < LowerYBounds.size(); Range++) {
+        RawTemperatureData RawData(0.0, 0.0, 0.0, deltax), RawData_Cache(0.0, 0.0, 0.0, deltax);
+        parseTemperatureData(TestTempFileName, LowerYBounds[Range], UpperYBounds[Range], RawData, TestBinaryInputRead);
+        parseTemperatureData_Cache(TestCacheFileName, HT_deltax, LowerYBounds[Range], UpperYBounds[Range],
+                                   RawData_Cache);
+        EXPECT_EQ(RawData_Cache.size(), RawData.size());
+        for (int DataPoint = 0; DataPoint < RawData.size(); DataPoint++) {
+            EXPECT_EQ(RawData_Cache.XInt[DataPoint], RawData.XInt[DataPoint]);
+            EXPECT_EQ(RawData_Cache.YInt[DataPoint], RawData.YInt[DataPoint]);
+            EXPECT_EQ(RawData_Cache.ZInt[DataPoint], RawData.ZInt[DataPoint]);
+            EXPECT_DOUBLE_EQ(RawData_Cache.TMelting[DataPoint], RawData.TMelting[DataPoint]);
+            EXPECT_DOUBLE_EQ(RawData_Cache.TLiquidus[DataPoint], RawData.TLiquidus[DataPoint]);
+            EXPECT_DOUBLE_EQ(RawData_Cache.CoolingRate[DataPoint], RawData.CoolingRate[DataPoint]);
+        }
+    }
+
+    // Reading the cache file with a different heat transport data mesh size than it was written with should fail
+    RawTemperatureData RawData_WrongMesh(0.0, 0.0, 0.0, deltax);
+    EXPECT_THROW(parseTemperatureData_Cache(TestCacheFileName, 2 * HT_deltax, 0, ny - 1, RawData_WrongMesh),
+                 std::runtime_error);
+}
+
+void testTemperaturePrefetch() {
+
+    double deltax = 1 * pow(10, -6);
+    double HT_deltax = 1 * pow(10, -6);
+    int nx = 3;
+    int ny = 12;
+    int NumberOfLayers = 3;
+    int TempFilesInSeries = 2;
+    // Write two temperature files, with different Z coordinates and melting times
+    std::vector<std::string> temp_paths = {"TestDataPrefetch1.txt", "TestDataPrefetch2.txt"};
+    for (int FileNumber = 0; FileNumber < TempFilesInSeries; FileNumber++) {
+        std::ofstream TestDataFile;
+        TestDataFile.open(temp_paths[FileNumber]);
+        TestDataFile << "x, y, z, tm, tl, cr" << std::endl;
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++)
+                TestDataFile << i * deltax << "," << j * deltax << "," << FileNumber * deltax << ","
+                             << static_cast<double>(i * j + FileNumber) << "," << static_cast<double>(i + j) << ","
+                             << static_cast<double>(j) << std::endl;
+        }
+        TestDataFile.close();
+    }
+
+    // Each layer's data read in the background should match the data read by ReadTemperatureData
+    int MyYSlices = 4;
+    int MyYOffset = 5;
+    double YMin = 0.0;
+    int HTtoCAratio;
+    int *FirstValue = new int[NumberOfLayers];
+    int *LastValue = new int[NumberOfLayers];
+    RawTemperatureData RawData;
+    TemperaturePrefetch Prefetch;
+    for (int layernumber = 0; layernumber < NumberOfLayers; layernumber++) {
+        ReadTemperatureData(0, 1, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, 0.0, YMin, 0.0, temp_paths,
+                            NumberOfLayers, TempFilesInSeries, RawData, FirstValue, LastValue, true, layernumber, 0);
+        RawTemperatureData RawData_Expected = RawData;
+        // Data for layer 0 is not being read in the background
+        if (layernumber == 0)
+            EXPECT_FALSE(finishTemperaturePrefetch(Prefetch, layernumber, RawData, FirstValue, LastValue));
+        else {
+            EXPECT_TRUE(finishTemperaturePrefetch(Prefetch, layernumber, RawData, FirstValue, LastValue));
+            EXPECT_EQ(RawData.size(), RawData_Expected.size());
+            EXPECT_EQ(FirstValue[layernumber], 0);
+            EXPECT_EQ(LastValue[layernumber], RawData_Expected.size());
+            for (int n = 0; n < RawData_Expected.size(); n++) {
+                EXPECT_EQ(RawData.XInt[n], RawData_Expected.XInt[n]);
+                EXPECT_EQ(RawData.YInt[n], RawData_Expected.YInt[n]);
+                EXPECT_EQ(RawData.ZInt[n], RawData_Expected.ZInt[n]);
+                EXPECT_DOUBLE_EQ(RawData.TMelting[n], RawData_Expected.TMelting[n]);
+                EXPECT_DOUBLE_EQ(RawData.TLiquidus[n], RawData_Expected.TLiquidus[n]);
+                EXPECT_DOUBLE_EQ(RawData.CoolingRate[n], RawData_Expected.CoolingRate[n]);
+            }
+        }
+        // Each rank has 4 Y coordinates with 3 data points each
+        EXPECT_EQ(RawData.size(), 12);
+        startTemperaturePrefetch(Prefetch, layernumber + 1, NumberOfLayers, TempFilesInSeries, temp_paths, 0.0, YMin,
+                                 0.0, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset);
+    }
+    // No data is read in the background past the last layer
+    EXPECT_FALSE(finishTemperaturePrefetch(Prefetch, NumberOfLayers, RawData, FirstValue, LastValue));
+    delete[] FirstValue;
+    delete[] LastValue;
+}
+
+void testTemperatureDataStore() {
+
+    // Room for 20 data points
+    TemperatureDataStore Store;
+    std::size_t DataPointSize = 3 * sizeof(int) + 3 * sizeof(double);
+    Store.MemoryLimit = 20 * DataPointSize;
+    int FirstValue[4], LastValue[4];
+    // Each file's data points have melting times equal to the file number
+    std::vector<RawTemperatureData> RawData_Files(5);
+    std::vector<int> NumDataPoints_Files = {0, 6, 6, 30, 12};
+    for (int FileNumber = 1; FileNumber <= 4; FileNumber++) {
+        std::array<double, 6> XYZTemperaturePoint = {0.0, 0.0, 0.0, static_cast<double>(FileNumber), 0.0, 0.0};
+        for (int n = 0; n < NumDataPoints_Files[FileNumber]; n++)
+            RawData_Files[FileNumber].addPoint(XYZTemperaturePoint.data());
+    }
+    RawTemperatureData RawData;
+    storeTemperatureData(Store, "File1", RawData_Files[1]);
+    storeTemperatureData(Store, "File2", RawData_Files[2]);
+    // Too large to be stored
+    storeTemperatureData(Store, "File3", RawData_Files[3]);
+    EXPECT_TRUE(checkStoredTemperatureData(Store, "File1"));
+    EXPECT_TRUE(checkStoredTemperatureData(Store, "File2"));
+    EXPECT_FALSE(checkStoredTemperatureData(Store, "File3"));
+    EXPECT_EQ(static_cast<int>(Store.MemoryUsed), static_cast<int>(12 * DataPointSize));
+    EXPECT_FALSE(getStoredTemperatureData(Store, "File3", 0, RawData, FirstValue, LastValue));
+    // Using File1 makes File2 the least recently used file, which is removed to make room for File4
+    EXPECT_TRUE(getStoredTemperatureData(Store, "File1", 2, RawData, FirstValue, LastValue));
+    EXPECT_EQ(RawData.size(), 6);
+    EXPECT_EQ(FirstValue[2], 0);
+    EXPECT_EQ(LastValue[2], 6);
+    for (int n = 0; n < 6; n++)
+        EXPECT_DOUBLE_EQ(RawData.TMelting[n], 1.0);
+    storeTemperatureData(Store, "File4", RawData_Files[4]);
+    EXPECT_TRUE(checkStoredTemperatureData(Store, "File1"));
+    EXPECT_FALSE(checkStoredTemperatureData(Store, "File2"));
+    EXPECT_TRUE(checkStoredTemperatureData(Store, "File4"));
+    EXPECT_EQ(static_cast<int>(Store.MemoryUsed), static_cast<int>(18 * DataPointSize));
+    EXPECT_TRUE(getStoredTemperatureData(Store, "File4", 3, RawData, FirstValue, LastValue));
+    EXPECT_EQ(LastValue[3], 12);
+    for (int n = 0; n < 12; n++)
+        EXPECT_DOUBLE_EQ(RawData.TMelting[n], 4.0);
 }
 
 void testgetTempCoords() {
@@ -618,6 +1113,7 @@ void testgetTempCoords() {
     double deltax = 0.5;
     double XMin = -5;
     double YMin = 0.0;
+    double ZMin = 0.0;
 
     // test - each rank initializes data for layer id, of 4 total layers
     for (int layernumber = 0; layernumber < 4; layernumber++) {
@@ -628,15 +1124,18 @@ void testgetTempCoords() {
         int LayerHeight = 10;
 
         // Fill "RawData" with example temperature field data - 2 data point (x,y,z,tm,tl,cr)
-        std::vector<double> RawData = {0.0, 0.0, 3.0, 0.000050, 0.000055, 2000.0,
-                                       5.0, 2.0, 2.0, 0.000150, 0.000155, 3500.0};
+        RawTemperatureData RawData(XMin, YMin, ZMin, deltax);
+        std::vector<double> XYZTemperaturePoints = {0.0, 0.0, 3.0, 0.000050, 0.000055, 2000.0,
+                                                    5.0, 2.0, 2.0, 0.000150, 0.000155, 3500.0};
+        RawData.addPoint(XYZTemperaturePoints.data());
+        RawData.addPoint(XYZTemperaturePoints.data() + 6);
 
         // Read and check RawData values against expected results from getTempCoordX,Y,Z,TM,TL,CR functions
-        // First data point (i = 0 through i = 5 values)
+        // First data point
         int i = 0;
-        int XInt = getTempCoordX(i, XMin, deltax, RawData);
-        int YInt = getTempCoordY(i, YMin, deltax, RawData);
-        int ZInt = getTempCoordZ(i, deltax, RawData, LayerHeight, layernumber, ZMinLayer);
+        int XInt = getTempCoordX(i, RawData);
+        int YInt = getTempCoordY(i, RawData);
+        int ZInt = getTempCoordZ(i, RawData, LayerHeight, layernumber, ZMinLayer);
         double TMelting = getTempCoordTM(i, RawData);
         double TLiquidus = getTempCoordTL(i, RawData);
         double CoolingRate = getTempCoordCR(i, RawData);
@@ -646,11 +1145,11 @@ void testgetTempCoords() {
         EXPECT_DOUBLE_EQ(TMelting, 0.000050);
         EXPECT_DOUBLE_EQ(TLiquidus, 0.000055);
         EXPECT_DOUBLE_EQ(CoolingRate, 2000.0);
-        // Second data point (i = 6 through i = 11 values)
-        i = 6;
-        XInt = getTempCoordX(i, XMin, deltax, RawData);
-        YInt = getTempCoordY(i, YMin, deltax, RawData);
-        ZInt = getTempCoordZ(i, deltax, RawData, LayerHeight, layernumber, ZMinLayer);
+        // Second data point
+        i = 1;
+        XInt = getTempCoordX(i, RawData);
+        YInt = getTempCoordY(i, RawData);
+        ZInt = getTempCoordZ(i, RawData, LayerHeight, layernumber, ZMinLayer);
         TMelting = getTempCoordTM(i, RawData);
         TLiquidus = getTempCoordTL(i, RawData);
         CoolingRate = getTempCoordCR(i, RawData);
@@ -680,6 +1179,7 @@ TEST(TEST_CATEGORY, fileread_test) {
 TEST(TEST_CATEGORY, activedomainsizecalc) {
     testcalcZBound_Low();
     testcalcZBound_High();
+    testcalcFrozenZ();
     testcalcnzActive();
     testcalcLocalActiveDomainSize();
 }
@@ -697,6 +1197,17 @@ TEST(TEST_CATEGORY, temperature_init_test) {
         testReadTemperatureData(NumberOfLayers_vals[test_count], LayerwiseTempRead_vals[test_count],
                                 TestBinaryInputRead_vals[test_count]);
     }
+    // parsing ASCII temperature files in chunks
+    testParseTemperatureDataChunk();
+    // reading binary temperature files mapped into memory
+    testParseTemperatureData_Mapped();
+    // writing and reading temperature cache files, from binary/non-binary format
+    testTemperatureCache(false);
+    testTemperatureCache(true);
+    // reading the next layer's temperature data in the background
+    testTemperaturePrefetch();
+    // reusing temperature data from previous layers
+    testTemperatureDataStore();
     testgetTempCoords();
 }
 } // end namespace Test
@@ -6,20 +6,215 @@
 #include <Kokkos_Core.hpp>
 
 #include "CAinitialize.hpp"
+#include "CAprint.hpp"
 
 #include <gtest/gtest.h>
 
 #include "mpi.h"
 
+#include <cmath>
 #include <fstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include <unistd.h>
+
 namespace Test {
 //---------------------------------------------------------------------------//
+// temp_init_test
+//---------------------------------------------------------------------------//
+void testReadTemperatureData_Readers(bool TestBinaryInputRead) {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    double deltax = 1 * pow(10, -6);
+    double HT_deltax = 1 * pow(10, -6);
+    int HTtoCAratio;
+    // Domain size is a 3 by 3 * np region, with each rank's data overlapping with one Y coordinate of the next rank's
+    // data (if this rank isn't at the north boundary)
+    int nx = 3;
+    int ny = 3 * np;
+    int MyYOffset = 3 * id;
+    int MyYSlices = 3;
+    if (id != np - 1)
+        MyYSlices++;
+    // Write fake OpenFOAM data - only rank 0. Temperature data should be of type double
+    std::string TestTempFileName = "TestDataReaders";
+    if (TestBinaryInputRead)
+        TestTempFileName = TestTempFileName + ".catemp";
+    else
+        TestTempFileName = TestTempFileName + ".txt";
+    if (id == 0) {
+        std::ofstream TestDataFile;
+        if (TestBinaryInputRead)
+            TestDataFile.open(TestTempFileName, std::ios::out | std::ios::binary);
+        else {
+            TestDataFile.open(TestTempFileName);
+            TestDataFile << "x, y, z, tm, tl, cr" << std::endl;
+        }
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                if (TestBinaryInputRead) {
+                    WriteData(TestDataFile, static_cast<double>(i * deltax), TestBinaryInputRead);
+                    WriteData(TestDataFile, static_cast<double>(j * deltax), TestBinaryInputRead);
+                    WriteData(TestDataFile, static_cast<double>(0.0), TestBinaryInputRead);
+                    WriteData(TestDataFile, static_cast<double>(i * j), TestBinaryInputRead);
+                    WriteData(TestDataFile, static_cast<double>(i * j + i), TestBinaryInputRead);
+                    WriteData(TestDataFile, static_cast<double>(i * j + j), TestBinaryInputRead);
+                }
+                else
+                    TestDataFile << i * deltax << "," << j * deltax << "," << 0.0 << "," << static_cast<double>(i * j)
+                                 << "," << static_cast<double>(i * j + i) << "," << static_cast<double>(i * j + j)
+                                 << std::endl;
+            }
+        }
+        TestDataFile.close();
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // Each rank should have the same data regardless of how many ranks read the file (0 = all ranks read the file)
+    std::vector<int> TempReaderRanks_vals = {0, 1, 2, np};
+    for (auto TempReaderRanks : TempReaderRanks_vals) {
+        std::vector<std::string> temp_paths = {TestTempFileName};
+        int FirstValue[1], LastValue[1];
+        RawTemperatureData RawData;
+        ReadTemperatureData(id, np, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, 0.0, 0.0, 0.0, temp_paths, 1,
+                            1, RawData, FirstValue, LastValue, false, 0, TempReaderRanks);
+
+        // Each rank should have one data point for each cell in its subdomain, in the order they appear in the file
+        int NumberOfCellsPerRank = nx * MyYSlices;
+        EXPECT_EQ(RawData.size(), NumberOfCellsPerRank);
+        EXPECT_EQ(FirstValue[0], 0);
+        EXPECT_EQ(LastValue[0], NumberOfCellsPerRank);
+        for (int n = 0; n < NumberOfCellsPerRank; n++) {
+            int XInt = n % nx;
+            int YInt = n / nx + MyYOffset;
+            EXPECT_EQ(RawData.XInt[n], XInt);
+            EXPECT_EQ(RawData.YInt[n], YInt);
+            EXPECT_EQ(RawData.ZInt[n], 0);
+            EXPECT_DOUBLE_EQ(RawData.TMelting[n], XInt * YInt);
+            EXPECT_DOUBLE_EQ(RawData.TLiquidus[n], XInt * YInt + XInt);
+            EXPECT_DOUBLE_EQ(RawData.CoolingRate[n], XInt * YInt + YInt);
+        }
+    }
+}
+
+void testReadTemperatureData_Coupled() {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    double deltax = 1 * pow(10, -6);
+    double HT_deltax = 1 * pow(10, -6);
+    int HTtoCAratio;
+    // Domain size is a 3 by 3 * np region, with each rank's data overlapping with one Y coordinate of the next rank's
+    // data (if this rank isn't at the north boundary)
+    int nx = 3;
+    int ny = 3 * np;
+    int MyYOffset = 3 * id;
+    int MyYSlices = 3;
+    if (id != np - 1)
+        MyYSlices++;
+    // Each rank adds the data points for cells where (i + j) % np == id, which are mostly in other ranks' subdomains.
+    // Rank 0 receives its data points through a pipe from a stand-in heat transport code on another thread, while the
+    // other ranks add theirs from separate arrays of x, y, z, tm, tl, cr values
+    std::vector<double> X, Y, Z, TM, TL, CR;
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            if ((i + j) % np == id) {
+                X.push_back(i * deltax);
+                Y.push_back(j * deltax);
+                Z.push_back(0.0);
+                TM.push_back(i * j);
+                TL.push_back(i * j + i);
+                CR.push_back(i * j + j);
+            }
+        }
+    }
+    int NumPoints = X.size();
+    TemperatureCoupling Coupling;
+    if (id == 0) {
+        std::vector<double> XYZTemperaturePoints;
+        for (int n = 0; n < NumPoints; n++)
+            XYZTemperaturePoints.insert(XYZTemperaturePoints.end(), {X[n], Y[n], Z[n], TM[n], TL[n], CR[n]});
+        int PipeFileDescriptors[2];
+        ASSERT_EQ(pipe(PipeFileDescriptors), 0);
+        std::thread Producer([&]() {
+            sendTemperaturePoints(PipeFileDescriptors[1], XYZTemperaturePoints.data(), NumPoints);
+            close(PipeFileDescriptors[1]);
+        });
+        long int NumPointsReceived = receiveTemperaturePoints(Coupling, "CoupledData", PipeFileDescriptors[0]);
+        Producer.join();
+        close(PipeFileDescriptors[0]);
+        EXPECT_EQ(NumPointsReceived, NumPoints);
+    }
+    else
+        addTemperaturePoints(Coupling, "CoupledData", X.data(), Y.data(), Z.data(), TM.data(), TL.data(), CR.data(),
+                             NumPoints);
+
+    // Domain bounds should be found from the data points on all ranks
+    std::vector<std::string> temp_paths = {"CoupledData"};
+    int nx_Coupled, ny_Coupled, nz_Coupled, LayerHeight = 1;
+    double XMin, XMax, YMin, YMax, ZMin, ZMax, ZMinLayer[1], ZMaxLayer[1];
+    FindXYZBounds("R", id, np, deltax, nx_Coupled, ny_Coupled, nz_Coupled, temp_paths, XMin, XMax, YMin, YMax, ZMin,
+                  ZMax, LayerHeight, 1, 1, ZMinLayer, ZMaxLayer, 0, Coupling);
+    EXPECT_EQ(nx_Coupled, nx);
+    EXPECT_EQ(ny_Coupled, ny);
+    EXPECT_EQ(nz_Coupled, 1);
+    EXPECT_DOUBLE_EQ(XMin, 0.0);
+    EXPECT_DOUBLE_EQ(XMax, (nx - 1) * deltax);
+    EXPECT_DOUBLE_EQ(YMin, 0.0);
+    EXPECT_DOUBLE_EQ(YMax, (ny - 1) * deltax);
+
+    // Each rank should have one data point for each cell in its subdomain, in order of the rank that added them
+    int FirstValue[1], LastValue[1];
+    RawTemperatureData RawData;
+    ReadTemperatureData(id, np, deltax, HT_deltax, HTtoCAratio, MyYSlices, MyYOffset, XMin, YMin, ZMin, temp_paths, 1,
+                        1, RawData, FirstValue, LastValue, false, 0, 0, Coupling);
+    int NumberOfCellsPerRank = nx * MyYSlices;
+    EXPECT_EQ(RawData.size(), NumberOfCellsPerRank);
+    EXPECT_EQ(FirstValue[0], 0);
+    EXPECT_EQ(LastValue[0], NumberOfCellsPerRank);
+    std::vector<int> PointsPerCell(NumberOfCellsPerRank, 0);
+    int PreviousAddingRank = 0;
+    for (int n = 0; n < RawData.size(); n++) {
+        int XInt = RawData.XInt[n];
+        int YInt = RawData.YInt[n];
+        ASSERT_GE(XInt, 0);
+        ASSERT_LT(XInt, nx);
+        ASSERT_GE(YInt, MyYOffset);
+        ASSERT_LT(YInt, MyYOffset + MyYSlices);
+        PointsPerCell[(YInt - MyYOffset) * nx + XInt]++;
+        int AddingRank = (XInt + YInt) % np;
+        EXPECT_GE(AddingRank, PreviousAddingRank);
+        PreviousAddingRank = AddingRank;
+        EXPECT_EQ(RawData.ZInt[n], 0);
+        EXPECT_DOUBLE_EQ(RawData.TMelting[n], XInt * YInt);
+        EXPECT_DOUBLE_EQ(RawData.TLiquidus[n], XInt * YInt + XInt);
+        EXPECT_DOUBLE_EQ(RawData.CoolingRate[n], XInt * YInt + YInt);
+    }
+    for (int n = 0; n < NumberOfCellsPerRank; n++)
+        EXPECT_EQ(PointsPerCell[n], 1);
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
+TEST(TEST_CATEGORY, temperature_init_test) {
+    // Reading temperature data with all ranks or a subset of ranks, as ASCII (false) and binary (true)
+    testReadTemperatureData_Readers(false);
+    testReadTemperatureData_Readers(true);
+    // Reading temperature data added in memory by a coupled code
+    testReadTemperatureData_Coupled();
+}
 // TODO: Init subroutines that use MPI but not kokkos are InitialDecomposition, X and YOffsetCalc, X and YMPSlicesCalc,
 // and AddGhostNodes
 } // end namespace Test
@@ -5,15 +5,18 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "CAfrozenregion.hpp"
 #include "CAfunctions.hpp"
 #include "CAinitialize.hpp"
 #include "CAparsefiles.hpp"
+#include "CArandom.hpp"
 #include "CAtypes.hpp"
 
 #include <gtest/gtest.h>
 
 #include "mpi.h"
 
+#include <algorithm>
 #include <fstream>
 #include <string>
 #include <vector>
@@ -79,6 +82,246 @@ void testOrientationInit_Angles() {
     }
 }
 
+void testFreezeBottomCells(bool RunLengthEncode) {
+
+    int id;
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    int nx = 4;
+    int MyYSlices = 3;
+    int nz = 5;
+    int LocalDomainSize = nx * MyYSlices * nz;
+    // GrainID values are repeated for pairs of cells in X, LayerID values depend only on Z coordinate
+    ViewI_H GrainID_Host(Kokkos::ViewAllocateWithoutInitializing("GrainID"), LocalDomainSize);
+    ViewI_H LayerID_Host(Kokkos::ViewAllocateWithoutInitializing("LayerID"), LocalDomainSize);
+    for (int k = 0; k < nz; k++) {
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < MyYSlices; j++) {
+                int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
+                GrainID_Host(D3D1ConvPosition) = 100 * k + 10 * j + i / 2 + 1;
+                LayerID_Host(D3D1ConvPosition) = k;
+            }
+        }
+    }
+    ViewI GrainID = Kokkos::create_mirror_view_and_copy(device_memory_space(), GrainID_Host);
+    ViewI LayerID = Kokkos::create_mirror_view_and_copy(device_memory_space(), LayerID_Host);
+    ViewI CellType(Kokkos::ViewAllocateWithoutInitializing("CellType"), LocalDomainSize);
+    ViewI CritTimeStep(Kokkos::ViewAllocateWithoutInitializing("CritTimeStep"), LocalDomainSize);
+    ViewF UndercoolingChange(Kokkos::ViewAllocateWithoutInitializing("UndercoolingChange"), LocalDomainSize);
+    ViewF UndercoolingCurrent(Kokkos::ViewAllocateWithoutInitializing("UndercoolingCurrent"), LocalDomainSize);
+    // Not sized to the domain, should be left as is
+    ViewI MeltTimeStep(Kokkos::ViewAllocateWithoutInitializing("MeltTimeStep"), 0);
+
+    FrozenRegion Frozen;
+    Frozen.RunLengthEncode = RunLengthEncode;
+    // Freeze the bottom 3 Z coordinates over two calls
+    FreezeBottomCells(id, Frozen, 2, nx, MyYSlices, GrainID, LayerID, CellType, CritTimeStep, UndercoolingChange,
+                      UndercoolingCurrent, MeltTimeStep);
+    FreezeBottomCells(id, Frozen, 1, nx, MyYSlices, GrainID, LayerID, CellType, CritTimeStep, UndercoolingChange,
+                      UndercoolingCurrent, MeltTimeStep);
+    EXPECT_EQ(Frozen.nzFrozen, 3);
+    int ResidentSize = nx * MyYSlices * (nz - 3);
+    EXPECT_EQ(static_cast<int>(GrainID.extent(0)), ResidentSize);
+    EXPECT_EQ(static_cast<int>(LayerID.extent(0)), ResidentSize);
+    EXPECT_EQ(static_cast<int>(CellType.extent(0)), ResidentSize);
+    EXPECT_EQ(static_cast<int>(CritTimeStep.extent(0)), ResidentSize);
+    EXPECT_EQ(static_cast<int>(UndercoolingChange.extent(0)), ResidentSize);
+    EXPECT_EQ(static_cast<int>(UndercoolingCurrent.extent(0)), ResidentSize);
+    EXPECT_EQ(static_cast<int>(MeltTimeStep.extent(0)), 0);
+    // Each line of cells in X is 2 runs with run length encoding, otherwise nx runs
+    int NumLines = 3 * MyYSlices;
+    EXPECT_EQ(static_cast<int>(Frozen.LineStart.size()), NumLines + 1);
+    if (RunLengthEncode)
+        EXPECT_EQ(static_cast<int>(Frozen.RunGrainID.size()), 2 * NumLines);
+    else
+        EXPECT_EQ(static_cast<int>(Frozen.RunGrainID.size()), nx * NumLines);
+
+    // Remaining cells should be those above the frozen region
+    ViewI_H ResidentGrainID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), GrainID);
+    for (int n = 0; n < ResidentSize; n++) {
+        EXPECT_EQ(ResidentGrainID_Host(n), GrainID_Host(n + 3 * nx * MyYSlices));
+    }
+
+    // Restoring the frozen cells should give back the original views and empty the store
+    UnfreezeBottomCells(Frozen, nx, MyYSlices, GrainID, LayerID);
+    EXPECT_EQ(Frozen.nzFrozen, 0);
+    EXPECT_EQ(static_cast<int>(Frozen.RunGrainID.size()), 0);
+    ViewI_H RestoredGrainID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), GrainID);
+    ViewI_H RestoredLayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
+    EXPECT_EQ(static_cast<int>(RestoredGrainID_Host.extent(0)), LocalDomainSize);
+    for (int n = 0; n < LocalDomainSize; n++) {
+        EXPECT_EQ(RestoredGrainID_Host(n), GrainID_Host(n));
+        EXPECT_EQ(RestoredLayerID_Host(n), LayerID_Host(n));
+    }
+}
+
+void testCounterRNG() {
+
+    // Known answers for Philox-4x32-10, for all-zero and all-one counters and keys
+    uint32_t Words[4] = {0, 0, 0, 0};
+    CounterRNG::philox(Words, 0, 0);
+    EXPECT_EQ(Words[0], 0x6627e8d5U);
+    EXPECT_EQ(Words[1], 0xe169c58dU);
+    EXPECT_EQ(Words[2], 0xbc57ac4cU);
+    EXPECT_EQ(Words[3], 0x9b00dbd8U);
+    for (int n = 0; n < 4; n++)
+        Words[n] = 0xffffffffU;
+    CounterRNG::philox(Words, 0xffffffffU, 0xffffffffU);
+    EXPECT_EQ(Words[0], 0x408f276dU);
+    EXPECT_EQ(Words[1], 0x41c83b0eU);
+    EXPECT_EQ(Words[2], 0xa20bc7c6U);
+    EXPECT_EQ(Words[3], 0x6d5451fdU);
+
+    // Draws depend only on the seed, stream, sample index, and draw number
+    CounterRNG RNG(2.0, NucleiStream, 1);
+    CounterRNG RNG_Copy(2.0, NucleiStream, 1);
+    CounterRNG RNG_OtherStream(2.0, PowderStream, 1);
+    int NumSamples = 10000;
+    int N = 7;
+    std::vector<int> Counts(N, 0);
+    int SameAsOtherStream = 0;
+    double Mean = 0.0;
+    double Variance = 0.0;
+    for (int n = NumSamples - 1; n >= 0; n--) {
+        int Value = RNG.uniformInt(n, 0, N);
+        ASSERT_GE(Value, 0);
+        ASSERT_LT(Value, N);
+        Counts[Value]++;
+        EXPECT_EQ(Value, RNG_Copy.uniformInt(n, 0, N));
+        double Uniform = RNG.uniform(n, 1);
+        EXPECT_GE(Uniform, 0.0);
+        EXPECT_LT(Uniform, 1.0);
+        if (Uniform == RNG_OtherStream.uniform(n, 1))
+            SameAsOtherStream++;
+        double Normal = RNG.normal(n, 2, 5.0, 0.5);
+        Mean += Normal / NumSamples;
+        Variance += (Normal - 5.0) * (Normal - 5.0) / NumSamples;
+    }
+    EXPECT_EQ(SameAsOtherStream, 0);
+    // Each integer should be drawn about as often as the others
+    for (int Value = 0; Value < N; Value++)
+        EXPECT_NEAR(Counts[Value], NumSamples / N, 0.1 * NumSamples / N);
+    EXPECT_NEAR(Mean, 5.0, 0.02);
+    EXPECT_NEAR(Variance, 0.25, 0.02);
+
+    // Random permutations should contain each value once, and be the same for the same stream
+    std::vector<int> PermutationSizes = {1, 2, 3, 16, 100, 4097};
+    for (int Size : PermutationSizes) {
+        RandomPermutation Permutation(RNG, Size);
+        RandomPermutation Permutation_Copy(RNG_Copy, Size);
+        RandomPermutation Permutation_OtherStream(RNG_OtherStream, Size);
+        ViewI Values(Kokkos::ViewAllocateWithoutInitializing("Values"), Size);
+        ViewI SameAsCopy("SameAsCopy", 1);
+        ViewI SameAsOtherStream_Permutation("SameAsOtherStream_Permutation", 1);
+        Kokkos::parallel_for(
+            "TestPermutation", Size, KOKKOS_LAMBDA(const int &n) {
+                Values(n) = Permutation(n);
+                if (Values(n) == Permutation_Copy(n))
+                    Kokkos::atomic_add(&SameAsCopy(0), 1);
+                if (Values(n) == Permutation_OtherStream(n))
+                    Kokkos::atomic_add(&SameAsOtherStream_Permutation(0), 1);
+            });
+        ViewI_H Values_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Values);
+        ViewI_H SameAsCopy_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SameAsCopy);
+        ViewI_H SameAsOtherStream_Host =
+            Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SameAsOtherStream_Permutation);
+        EXPECT_EQ(SameAsCopy_Host(0), Size);
+        std::vector<int> SortedValues(Values_Host.data(), Values_Host.data() + Size);
+        std::sort(SortedValues.begin(), SortedValues.end());
+        for (int n = 0; n < Size; n++)
+            EXPECT_EQ(SortedValues[n], n);
+        // Few values should be at the same position for an unrelated stream, or left in their original position
+        if (Size >= 100) {
+            int UnmovedValues = 0;
+            for (int n = 0; n < Size; n++) {
+                if (Values_Host(n) == n)
+                    UnmovedValues++;
+            }
+            EXPECT_LT(UnmovedValues, 10);
+            EXPECT_LT(SameAsOtherStream_Host(0), 10);
+        }
+    }
+}
+
+void testNucleiSampler() {
+
+    int nx = 5;
+    int ny = 7;
+    int nzActive = 3;
+    double dTN = 10.0;
+    double dTsigma = 0.5;
+    NucleiSampler Sampler(2.0, 1, nx, ny, nzActive, dTN, dTsigma);
+    // Same inputs, but for the next layer
+    NucleiSampler Sampler_NextLayer(2.0, 2, nx, ny, nzActive, dTN, dTsigma);
+    int NumEvents = 1000;
+    int RepeatedEvents = 0;
+    double MeanUndercooling = 0.0;
+    for (int NEvent = 0; NEvent < NumEvents; NEvent++) {
+        int NucleusX, NucleusY, NucleusZ;
+        double NucleusUndercooling;
+        Sampler.getNucleus(NEvent, NucleusX, NucleusY, NucleusZ, NucleusUndercooling);
+        // Events should be located in the domain, with nucleation undercoolings near dTN
+        EXPECT_GE(NucleusX, 0);
+        EXPECT_LT(NucleusX, nx);
+        EXPECT_GE(NucleusY, 0);
+        EXPECT_LT(NucleusY, ny);
+        EXPECT_GE(NucleusZ, 0);
+        EXPECT_LT(NucleusZ, nzActive);
+        EXPECT_NEAR(NucleusUndercooling, dTN, 10 * dTsigma);
+        MeanUndercooling += NucleusUndercooling / NumEvents;
+        // Drawing the same event again should give the same result, regardless of the events drawn in between
+        int NucleusX_Again, NucleusY_Again, NucleusZ_Again;
+        double NucleusUndercooling_Again;
+        Sampler.getNucleus(NEvent, NucleusX_Again, NucleusY_Again, NucleusZ_Again, NucleusUndercooling_Again);
+        EXPECT_EQ(NucleusX, NucleusX_Again);
+        EXPECT_EQ(NucleusY, NucleusY_Again);
+        EXPECT_EQ(NucleusZ, NucleusZ_Again);
+        EXPECT_DOUBLE_EQ(NucleusUndercooling, NucleusUndercooling_Again);
+        // The next layer's events should be different
+        Sampler_NextLayer.getNucleus(NEvent, NucleusX_Again, NucleusY_Again, NucleusZ_Again,
+                                     NucleusUndercooling_Again);
+        if (NucleusUndercooling == NucleusUndercooling_Again)
+            RepeatedEvents++;
+    }
+    EXPECT_EQ(RepeatedEvents, 0);
+    EXPECT_NEAR(MeanUndercooling, dTN, 0.1);
+}
+
+void testSortNucleiData() {
+
+    // Nucleation times, with repeats, and locations and grain IDs that identify each event
+    std::vector<int> NucleationTimes_V = {40, 3, 17, 3, 100, 0, 17, 56, 2, 99, 41};
+    int PossibleNuclei = NucleationTimes_V.size();
+    ViewI_H NucleationTimes_Host(Kokkos::ViewAllocateWithoutInitializing("NucleationTimes_Host"), PossibleNuclei);
+    ViewI_H NucleiLocation_Host(Kokkos::ViewAllocateWithoutInitializing("NucleiLocation_Host"), PossibleNuclei);
+    ViewI_H NucleiGrainID_Host(Kokkos::ViewAllocateWithoutInitializing("NucleiGrainID_Host"), PossibleNuclei);
+    for (int n = 0; n < PossibleNuclei; n++) {
+        NucleationTimes_Host(n) = NucleationTimes_V[n];
+        NucleiLocation_Host(n) = 10 * NucleationTimes_V[n] + n;
+        NucleiGrainID_Host(n) = -(n + 1);
+    }
+    using memory_space = Kokkos::DefaultExecutionSpace::memory_space;
+    ViewI NucleationTimes = Kokkos::create_mirror_view_and_copy(memory_space(), NucleationTimes_Host);
+    ViewI NucleiLocation = Kokkos::create_mirror_view_and_copy(memory_space(), NucleiLocation_Host);
+    ViewI NucleiGrainID = Kokkos::create_mirror_view_and_copy(memory_space(), NucleiGrainID_Host);
+    sortNucleiData(PossibleNuclei, NucleiLocation, NucleationTimes, NucleiGrainID);
+    NucleationTimes_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NucleationTimes);
+    NucleiLocation_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NucleiLocation);
+    NucleiGrainID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NucleiGrainID);
+
+    // Times should be sorted from low to high, with each event's location and grain ID kept with it
+    std::sort(NucleationTimes_V.begin(), NucleationTimes_V.end());
+    std::vector<bool> EventFound(PossibleNuclei, false);
+    for (int n = 0; n < PossibleNuclei; n++) {
+        EXPECT_EQ(NucleationTimes_Host(n), NucleationTimes_V[n]);
+        int OriginalEvent = -NucleiGrainID_Host(n) - 1;
+        EXPECT_EQ(NucleiLocation_Host(n), 10 * NucleationTimes_Host(n) + OriginalEvent);
+        EXPECT_FALSE(EventFound[OriginalEvent]);
+        EventFound[OriginalEvent] = true;
+    }
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -86,4 +329,13 @@ TEST(TEST_CATEGORY, orientation_init_tests) {
     testOrientationInit_Vectors();
     testOrientationInit_Angles();
 }
+TEST(TEST_CATEGORY, nuclei_init_tests) {
+    testCounterRNG();
+    testNucleiSampler();
+    testSortNucleiData();
+}
+TEST(TEST_CATEGORY, frozen_region_tests) {
+    testFreezeBottomCells(true);
+    testFreezeBottomCells(false);
+}
 } // end namespace Test
@@ -14,6 +14,9 @@
 
 #include "mpi.h"
 
+#include <algorithm>
+#include <climits>
+#include <cstdio>
 #include <fstream>
 #include <string>
 #include <vector>
@@ -107,6 +110,88 @@ void testSubstrateInit_ConstrainedGrowth() {
     }
 }
 
+void testSubstrateInit_FromFile(bool BinarySubstrateFile) {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+    // Domain of 4 by 3 * np by 5 cells, with each rank assigned a different portion of the domain in Y
+    int nx = 4;
+    int ny = 3 * np;
+    int nz = 5;
+    int nzActive = 3;
+    int MyYSlices = 3;
+    int MyYOffset = 3 * id;
+    int LocalDomainSize = nx * MyYSlices * nz;
+
+    // Write substrate data for the whole domain on rank 0, with GrainID values based on each cell's location
+    std::string SubstrateFileName = "TestSubstrate";
+    if (BinarySubstrateFile)
+        SubstrateFileName = SubstrateFileName + ".casub";
+    else
+        SubstrateFileName = SubstrateFileName + ".txt";
+    if (id == 0) {
+        std::ofstream SubstrateFile;
+        if (BinarySubstrateFile) {
+            SubstrateFile.open(SubstrateFileName, std::ios::out | std::ios::binary);
+            SubstrateFile.write("ExaCASub", 8);
+            int Dimensions[3] = {nz, ny, nx};
+            SubstrateFile.write(reinterpret_cast<const char *>(Dimensions), 3 * sizeof(int));
+        }
+        else {
+            SubstrateFile.open(SubstrateFileName);
+            SubstrateFile << "Z = " << nz << std::endl;
+            SubstrateFile << "Y = " << ny << std::endl;
+            SubstrateFile << "X = " << nx << std::endl;
+        }
+        for (int k = 0; k < nz; k++) {
+            for (int j = 0; j < ny; j++) {
+                for (int i = 0; i < nx; i++) {
+                    int SubstrateGrainID = (k * ny + j) * nx + i + 1;
+                    if (BinarySubstrateFile)
+                        SubstrateFile.write(reinterpret_cast<const char *>(&SubstrateGrainID), sizeof(int));
+                    else
+                        SubstrateFile << SubstrateGrainID << std::endl;
+                }
+            }
+        }
+        SubstrateFile.close();
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // Read the substrate for the first layer only, and for the whole domain
+    for (int BaseplateThroughPowder = 0; BaseplateThroughPowder < 2; BaseplateThroughPowder++) {
+        ViewI GrainID("GrainID", LocalDomainSize);
+        SubstrateInit_FromFile(SubstrateFileName, nz, nx, ny, MyYSlices, MyYOffset, id, GrainID, nzActive,
+                               BaseplateThroughPowder);
+        ViewI_H GrainID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), GrainID);
+        int BaseplateSizeZ = BaseplateThroughPowder ? nz : nzActive;
+        for (int k = 0; k < nz; k++) {
+            for (int i = 0; i < nx; i++) {
+                for (int j = 0; j < MyYSlices; j++) {
+                    // Cells above the baseplate should not be assigned GrainID values
+                    int ExpectedGrainID = 0;
+                    if (k < BaseplateSizeZ)
+                        ExpectedGrainID = (k * ny + j + MyYOffset) * nx + i + 1;
+                    EXPECT_EQ(GrainID_Host(k * nx * MyYSlices + i * MyYSlices + j), ExpectedGrainID);
+                }
+            }
+        }
+    }
+    // A binary substrate file without enough layers of substrate data should be rejected on all ranks
+    if (BinarySubstrateFile) {
+        ViewI GrainID("GrainID", nx * MyYSlices * (nz + 1));
+        EXPECT_THROW(SubstrateInit_FromFile(SubstrateFileName, nz + 1, nx, ny, MyYSlices, MyYOffset, id, GrainID,
+                                            nzActive, true),
+                     std::runtime_error);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (id == 0)
+        std::remove(SubstrateFileName.c_str());
+}
+
 void testBaseplateInit_FromGrainSpacing() {
 
     int id, np;
@@ -159,6 +244,77 @@ void testBaseplateInit_FromGrainSpacing() {
     EXPECT_EQ(NextLayer_FirstEpitaxialGrainID, np + 2);
 }
 
+void testAssignVoronoiGrainIDs() {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+    // Domain of 12 by 5 * np by 7 cells, with each rank assigned a different portion of the domain in Y
+    int nx = 12;
+    int ny = 5 * np;
+    int SizeZ = 7;
+    int MyYSlices = 5;
+    int MyYOffset = 5 * id;
+    int LocalDomainSize = nx * MyYSlices * SizeZ;
+
+    // Check numbers of grain centers from 1 (a single grain) up to half of the cells in the domain. As grain centers
+    // are at integer coordinates, many cells are equidistant from multiple centers
+    int NumCells = nx * ny * SizeZ;
+    for (int NumberOfCenters = 1; NumberOfCenters <= NumCells / 2; NumberOfCenters = 3 * NumberOfCenters + 1) {
+        ViewI_H CenterLocations_Host(Kokkos::ViewAllocateWithoutInitializing("CenterLocations_Host"), NumberOfCenters);
+        ViewI_H CenterGrainIDs_Host(Kokkos::ViewAllocateWithoutInitializing("CenterGrainIDs_Host"), NumberOfCenters);
+        for (int n = 0; n < NumberOfCenters; n++) {
+            int CenterLoc = (n * 7919) % NumCells;
+            while (CenterLoc % 2 != 0)
+                CenterLoc = (CenterLoc + 7) % NumCells;
+            // Skip locations already used by another grain center
+            bool Used = true;
+            while (Used) {
+                Used = false;
+                for (int m = 0; m < n; m++) {
+                    if (CenterLocations_Host(m) == CenterLoc)
+                        Used = true;
+                }
+                if (Used)
+                    CenterLoc = (CenterLoc + 2) % NumCells;
+            }
+            CenterLocations_Host(n) = CenterLoc;
+            CenterGrainIDs_Host(n) = NumberOfCenters - n;
+        }
+        ViewI CenterLocations = Kokkos::create_mirror_view_and_copy(device_memory_space(), CenterLocations_Host);
+        ViewI CenterGrainIDs = Kokkos::create_mirror_view_and_copy(device_memory_space(), CenterGrainIDs_Host);
+        ViewI GrainID("GrainID", LocalDomainSize);
+        assignVoronoiGrainIDs(NumberOfCenters, CenterLocations, CenterGrainIDs, nx, ny, SizeZ, MyYSlices, MyYOffset,
+                              GrainID);
+        ViewI_H GrainID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), GrainID);
+
+        // Each cell should have the GrainID of the closest grain center (the first one listed, if multiple are equally
+        // close)
+        for (int k = 0; k < SizeZ; k++) {
+            for (int i = 0; i < nx; i++) {
+                for (int j = 0; j < MyYSlices; j++) {
+                    float MinDistance = NumCells;
+                    int ExpectedGrainID = 0;
+                    for (int n = 0; n < NumberOfCenters; n++) {
+                        float DistanceX = i - (CenterLocations_Host(n) % (nx * ny)) / ny;
+                        float DistanceY = (j + MyYOffset) - (CenterLocations_Host(n) % (nx * ny)) % ny;
+                        float DistanceZ = k - CenterLocations_Host(n) / (nx * ny);
+                        float Distance =
+                            sqrtf(DistanceX * DistanceX + DistanceY * DistanceY + DistanceZ * DistanceZ);
+                        if (Distance < MinDistance) {
+                            MinDistance = Distance;
+                            ExpectedGrainID = CenterGrainIDs_Host(n);
+                        }
+                    }
+                    EXPECT_EQ(GrainID_Host(k * nx * MyYSlices + i * MyYSlices + j), ExpectedGrainID);
+                }
+            }
+        }
+    }
+}
+
 void testPowderInit() {
 
     int id, np;
@@ -194,7 +350,7 @@ void testPowderInit() {
     double RNGSeed = 0.0;
 
     PowderInit(layernumber, nx, ny, LayerHeight, ZMaxLayer, ZMin, deltax, MyYSlices, MyYOffset, id, GrainID, RNGSeed,
-               NextLayer_FirstEpitaxialGrainID, 1.0);
+               NextLayer_FirstEpitaxialGrainID, 1.0, 0);
 
     // Copy results back to host to check
     ViewI_H GrainID_H = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), GrainID);
@@ -314,10 +470,10 @@ void testCellTypeInit_NoRemelt() {
     Buffer2D BufferNorthSend("BufferNorthSend", BufSizeX * nzActive, 5);
 
     // Initialize cell types and active cell data structures
-    CellTypeInit_NoRemelt(layernumber, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, nz, LocalActiveDomainSize,
-                          LocalDomainSize, CellType, CritTimeStep, NeighborX, NeighborY, NeighborZ, NGrainOrientations,
-                          GrainUnitVector, DiagonalLength, GrainID, CritDiagonalLength, DOCenter, LayerID,
-                          BufferNorthSend, BufferSouthSend, BufSizeX, AtNorthBoundary, AtSouthBoundary);
+    CellTypeInit_NoRemelt(layernumber, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, 0, nx, 0, MyYSlices, nz,
+                          LocalActiveDomainSize, 0, nz - 1, CellType, CritTimeStep, NeighborX, NeighborY, NeighborZ,
+                          NGrainOrientations, GrainUnitVector, DiagonalLength, GrainID, CritDiagonalLength, DOCenter,
+                          LayerID, BufferNorthSend, BufferSouthSend, BufSizeX, AtNorthBoundary, AtSouthBoundary);
 
     // Copy views back to host to check the results
     ViewF_H DiagonalLength_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), DiagonalLength);
@@ -409,6 +565,24 @@ void testCellTypeInit_NoRemelt() {
             }
         }
     }
+
+    // Initializing the cell types one portion of the domain at a time (as is done when temperature data is initialized
+    // one layer at a time) should give the same cell types as initializing them all at once
+    ViewI CellType_Layerwise(Kokkos::ViewAllocateWithoutInitializing("CellType_Layerwise"), LocalDomainSize);
+    int InitZ_Split = 3;
+    CellTypeInit_NoRemelt(0, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, 0, nx, 0, MyYSlices, nz,
+                          LocalActiveDomainSize, 0, InitZ_Split, CellType_Layerwise, CritTimeStep, NeighborX, NeighborY,
+                          NeighborZ, NGrainOrientations, GrainUnitVector, DiagonalLength, GrainID, CritDiagonalLength,
+                          DOCenter, LayerID, BufferNorthSend, BufferSouthSend, BufSizeX, AtNorthBoundary,
+                          AtSouthBoundary);
+    CellTypeInit_NoRemelt(1, id, np, nx, MyYSlices, MyYOffset, ZBound_Low, 0, nx, 0, MyYSlices, nz,
+                          LocalActiveDomainSize, InitZ_Split + 1, nz - 1, CellType_Layerwise, CritTimeStep, NeighborX,
+                          NeighborY, NeighborZ, NGrainOrientations, GrainUnitVector, DiagonalLength, GrainID,
+                          CritDiagonalLength, DOCenter, LayerID, BufferNorthSend, BufferSouthSend, BufSizeX,
+                          AtNorthBoundary, AtSouthBoundary);
+    ViewI_H CellType_Layerwise_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CellType_Layerwise);
+    for (int n = 0; n < LocalDomainSize; n++)
+        EXPECT_EQ(CellType_Layerwise_Host(n), CellType_Host(n));
 }
 
 void testCellTypeInit_Remelt() {
@@ -425,7 +599,6 @@ void testCellTypeInit_Remelt() {
     int nzActive = 5;
     int ZBound_Low = 2;
     int nz = nzActive + ZBound_Low;
-    int LocalActiveDomainSize = nx * MyYSlices * nzActive;
     int LocalDomainSize = nx * MyYSlices * nz;
 
     // Temporary host view for initializing CritTimeStep
@@ -454,7 +627,7 @@ void testCellTypeInit_Remelt() {
     ViewI CellType("CellType", LocalDomainSize);
 
     // Initialize cell type values
-    CellTypeInit_Remelt(nx, MyYSlices, LocalActiveDomainSize, CellType, CritTimeStep, id, ZBound_Low);
+    CellTypeInit_Remelt(nx, MyYSlices, nzActive, CellType, CritTimeStep, id, ZBound_Low);
 
     // Copy cell types back to host to check
     ViewI_H CellType_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CellType);
@@ -479,8 +652,913 @@ void testCellTypeInit_Remelt() {
     }
 }
 //---------------------------------------------------------------------------//
+// temperature_init_tests
+//---------------------------------------------------------------------------//
+void testTempInit_ReadDataNoRemelt(int HTtoCAratio) {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    // Domain for each rank, with a single layer of temperature data
+    int nx = 5;
+    int MyYSlices = 4;
+    int MyYOffset = MyYSlices * id;
+    int ny = MyYSlices * np;
+    int nz = 5;
+    int LocalDomainSize = nx * MyYSlices * nz;
+    double deltax = 1 * pow(10, -6);
+    double deltat = 1 * pow(10, -6);
+    double ZMin = 0.0;
+    double ZMinLayer[1] = {0.0};
+    double ZMaxLayer[1] = {(nz - 1) * deltax};
+    int FinishTimeStep[1];
+    int FirstValue[1], LastValue[1];
+
+    // Temperature data is given at every HTtoCAratio-th cell in each direction, within this rank's Y bounds. The
+    // liquidus time and cooling rate vary linearly with position, so interpolation between data points should reproduce
+    // these values. The first location also has data points with smaller liquidus times both before and after the one
+    // that should be kept
+    int LowerYBound, UpperYBound;
+    calcTemperatureYBounds(HTtoCAratio, MyYSlices, MyYOffset, LowerYBound, UpperYBound);
+    UpperYBound = std::min(UpperYBound, ny - 1);
+    RawTemperatureData RawData(0.0, 0.0, ZMin, deltax);
+    for (int k = 0; k < nz; k += HTtoCAratio) {
+        for (int i = 0; i < nx; i += HTtoCAratio) {
+            for (int j = LowerYBound; j <= UpperYBound; j += HTtoCAratio) {
+                double TLiquidus = (100 + 2 * i + 3 * j + 5 * k) * deltat;
+                double CoolingRate = 1 + i + j + k;
+                if ((k == 0) && (i == 0) && (j == LowerYBound)) {
+                    double EarlierPoint[6] = {i * deltax, j * deltax, k * deltax, 0.0, TLiquidus - 50 * deltat, 9.0};
+                    RawData.addPoint(EarlierPoint);
+                }
+                double Point[6] = {i * deltax, j * deltax, k * deltax, 0.0, TLiquidus, CoolingRate};
+                RawData.addPoint(Point);
+                if ((k == 0) && (i == 0) && (j == LowerYBound)) {
+                    double LaterPoint[6] = {i * deltax, j * deltax, k * deltax, 0.0, TLiquidus - 10 * deltat, 7.0};
+                    RawData.addPoint(LaterPoint);
+                }
+            }
+        }
+    }
+    FirstValue[0] = 0;
+    LastValue[0] = RawData.size();
+
+    ViewI CritTimeStep, LayerID;
+    ViewF UndercoolingChange;
+    TempInit_ReadDataNoRemelt(id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio, deltat, nz, LocalDomainSize,
+                              CritTimeStep, UndercoolingChange, ZMin, ZMinLayer, ZMaxLayer, nz, 1, FinishTimeStep, 0.0,
+                              LayerID, FirstValue, LastValue, RawData, ny);
+
+    // The data point with the largest liquidus time is in the last plane of data points in each direction
+    int LastXData = (nx - 1) - (nx - 1) % HTtoCAratio;
+    int LastYData = (ny - 1) - (ny - 1) % HTtoCAratio;
+    int LastZData = (nz - 1) - (nz - 1) % HTtoCAratio;
+    EXPECT_EQ(FinishTimeStep[0], 100 + 2 * LastXData + 3 * LastYData + 5 * LastZData);
+
+    // Cells beyond the last plane of data points in each direction take the values from that plane. Liquidus time steps
+    // are relative to the layer's smallest liquidus time, that of the earlier point at the first location on rank 0
+    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
+    ViewF_H UndercoolingChange_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange);
+    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
+    for (int k = 0; k < nz; k++) {
+        for (int i = 0; i < nx; i++) {
+            for (int RankY = 0; RankY < MyYSlices; RankY++) {
+                int j = RankY + MyYOffset;
+                int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + RankY;
+                int iData = std::min(i, LastXData);
+                int jData = std::min(j, LastYData);
+                int kData = std::min(k, LastZData);
+                EXPECT_EQ(CritTimeStep_Host(D3D1ConvPosition), 50 + 2 * iData + 3 * jData + 5 * kData);
+                EXPECT_FLOAT_EQ(UndercoolingChange_Host(D3D1ConvPosition), (1 + iData + jData + kData) * deltat);
+                EXPECT_EQ(LayerID_Host(D3D1ConvPosition), 0);
+            }
+        }
+    }
+
+    // When initializing part of the domain, with views that do not store cells below FrozenZ, only cells between
+    // InitZ_Low and InitZ_High (and the row above) should be initialized, with the same values as above
+    int FrozenZ = 1;
+    int InitZ_Low = 1;
+    int InitZ_High = 1;
+    int LayerDomainSize = nx * MyYSlices * (nz - FrozenZ);
+    ViewI CritTimeStep_Layer(Kokkos::ViewAllocateWithoutInitializing("CritTimeStep_Layer"), LayerDomainSize);
+    ViewF UndercoolingChange_Layer(Kokkos::ViewAllocateWithoutInitializing("UndercoolingChange_Layer"),
+                                   LayerDomainSize);
+    ViewI LayerID_Layer(Kokkos::ViewAllocateWithoutInitializing("LayerID_Layer"), LayerDomainSize);
+    TempInit_ReadDataNoRemelt_Layer(0, id, nx, MyYSlices, MyYOffset, deltax, HTtoCAratio, deltat, nz,
+                                    CritTimeStep_Layer, UndercoolingChange_Layer, LayerID_Layer, ZMin, ZMinLayer,
+                                    ZMaxLayer, nz, 1, FinishTimeStep, 0.0, FirstValue, LastValue, RawData, ny,
+                                    InitZ_Low, InitZ_High, FrozenZ);
+    ViewI_H CritTimeStep_Layer_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep_Layer);
+    ViewF_H UndercoolingChange_Layer_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange_Layer);
+    ViewI_H LayerID_Layer_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID_Layer);
+    for (int k = FrozenZ; k < nz; k++) {
+        for (int i = 0; i < nx; i++) {
+            for (int RankY = 0; RankY < MyYSlices; RankY++) {
+                int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + RankY;
+                int LayerD3D1ConvPosition = (k - FrozenZ) * nx * MyYSlices + i * MyYSlices + RankY;
+                if (k <= InitZ_High + 1) {
+                    EXPECT_EQ(CritTimeStep_Layer_Host(LayerD3D1ConvPosition), CritTimeStep_Host(D3D1ConvPosition));
+                    EXPECT_FLOAT_EQ(UndercoolingChange_Layer_Host(LayerD3D1ConvPosition),
+                                    UndercoolingChange_Host(D3D1ConvPosition));
+                    EXPECT_EQ(LayerID_Layer_Host(LayerD3D1ConvPosition), LayerID_Host(D3D1ConvPosition));
+                }
+                else {
+                    EXPECT_EQ(CritTimeStep_Layer_Host(LayerD3D1ConvPosition), 0);
+                    EXPECT_FLOAT_EQ(UndercoolingChange_Layer_Host(LayerD3D1ConvPosition), 0.0);
+                    EXPECT_EQ(LayerID_Layer_Host(LayerD3D1ConvPosition), -1);
+                }
+            }
+        }
+    }
+}
+//---------------------------------------------------------------------------//
+void testTempInit_ReadDataNoRemelt_OffGrid() {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    // Domain for each rank, with a single layer of temperature data, starting at a nonzero X coordinate
+    int nx = 5;
+    int MyYSlices = 4;
+    int MyYOffset = MyYSlices * id;
+    int ny = MyYSlices * np;
+    int nz = 3;
+    int LocalDomainSize = nx * MyYSlices * nz;
+    double deltax = 1 * pow(10, -6);
+    // Time step small enough that the time steps of cells depend on the exact x coordinates
+    double deltat = 1 * pow(10, -9);
+    double XMin = 2.5 * deltax;
+    double ZMin = 0.0;
+    double ZMinLayer[1] = {0.0};
+    double ZMaxLayer[1] = {(nz - 1) * deltax};
+    double FreezingRange = 0.0;
+    int FinishTimeStep[1];
+    int FirstValue[1], LastValue[1];
+
+    // Three data points at each cell within this rank's Y bounds, with x coordinates up to 0.3 cells away from the
+    // cell center, and liquidus times given out of order so that the layer's smallest time depends on the order the
+    // data points are read
+    RawTemperatureData RawData(XMin, 0.0, ZMin, deltax);
+    for (int p = 0; p < 3; p++) {
+        for (int k = 0; k < nz; k++) {
+            for (int i = 0; i < nx; i++) {
+                for (int j = MyYOffset; j < MyYOffset + MyYSlices; j++) {
+                    double XOffset = 0.1 * ((3 * i + 5 * j + 7 * k + p) % 7 - 3);
+                    double TLiquidus = 0.5 * (1 + (7 * i + 11 * j + 13 * k + 5 * p) % 17) * deltax;
+                    double CoolingRate = 1 + (3 * i + j + k + p) % 5;
+                    double Point[6] = {XMin + (i + XOffset) * deltax, j * deltax, k * deltax, 0.0, TLiquidus,
+                                       CoolingRate};
+                    RawData.addPoint(Point);
+                }
+            }
+        }
+    }
+    FirstValue[0] = 0;
+    LastValue[0] = RawData.size();
+
+    ViewI CritTimeStep, LayerID;
+    ViewF UndercoolingChange;
+    TempInit_ReadDataNoRemelt(id, nx, MyYSlices, MyYOffset, deltax, 1, deltat, nz, LocalDomainSize, CritTimeStep,
+                              UndercoolingChange, ZMin, ZMinLayer, ZMaxLayer, nz, 1, FinishTimeStep, FreezingRange,
+                              LayerID, FirstValue, LastValue, RawData, ny);
+
+    // Expected values, from the previous host implementation: each cell keeps the liquidus time and cooling rate of
+    // the data points that set a new largest liquidus time, in the order they were read, and the layer's smallest time
+    // is the smallest liquidus time of these points
+    std::vector<double> CritTL(LocalDomainSize, -1.0), CR(LocalDomainSize, -1.0);
+    double SmallestTime = 1000000000;
+    double LargestTime = 0;
+    for (int n = 0; n < RawData.size(); n++) {
+        int D3D1ConvPosition =
+            RawData.ZInt[n] * nx * MyYSlices + RawData.XInt[n] * MyYSlices + RawData.YInt[n] - MyYOffset;
+        if (RawData.TLiquidus[n] > CritTL[D3D1ConvPosition]) {
+            CritTL[D3D1ConvPosition] = RawData.TLiquidus[n];
+            if (RawData.TLiquidus[n] < SmallestTime)
+                SmallestTime = RawData.TLiquidus[n];
+            CR[D3D1ConvPosition] = RawData.CoolingRate[n];
+            LargestTime = std::max(LargestTime, RawData.TLiquidus[n] + FreezingRange / RawData.CoolingRate[n]);
+        }
+    }
+    double SmallestTime_Global, LargestTime_Global;
+    MPI_Allreduce(&SmallestTime, &SmallestTime_Global, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&LargestTime, &LargestTime_Global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    EXPECT_EQ(FinishTimeStep[0], round(LargestTime_Global / deltat));
+
+    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
+    ViewF_H UndercoolingChange_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange);
+    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
+    int NumPlacedCells = 0;
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LocalDomainSize; D3D1ConvPosition++) {
+        double CTLiq = CritTL[D3D1ConvPosition] - SmallestTime_Global;
+        if (CTLiq > 0) {
+            EXPECT_EQ(CritTimeStep_Host(D3D1ConvPosition), round(CTLiq / deltat));
+            EXPECT_FLOAT_EQ(UndercoolingChange_Host(D3D1ConvPosition), std::abs(CR[D3D1ConvPosition]) * deltat);
+            EXPECT_EQ(LayerID_Host(D3D1ConvPosition), 0);
+            NumPlacedCells++;
+        }
+        else {
+            EXPECT_EQ(CritTimeStep_Host(D3D1ConvPosition), 0);
+            EXPECT_FLOAT_EQ(UndercoolingChange_Host(D3D1ConvPosition), 0.0);
+            EXPECT_EQ(LayerID_Host(D3D1ConvPosition), -1);
+        }
+    }
+    EXPECT_GT(NumPlacedCells, 0);
+}
+//---------------------------------------------------------------------------//
+// Host implementation of the event table for a layer built by TempInit_ReadDataRemelt, used to check the device
+// implementation: each cell's events in order of melting time, with double counted events removed, and the temperature
+// fields initialized from each cell's first event
+void buildEventTable_Host(int nx, int MyYSlices, int MyYOffset, int LocalActiveDomainSize, int ZBound_Low,
+                          double deltat, const RawTemperatureData &RawData, double *ZMinLayer,
+                          ViewI_H NumberOfSolidificationEvents_Host, ViewI_H SolidificationEventOffset_Host,
+                          ViewF2D_H &LayerTimeTempHistory_Host, ViewI_H MeltTimeStep_Host, ViewI_H CritTimeStep_Host,
+                          ViewF_H UndercoolingChange_Host, ViewI_H LayerID_Host) {
+
+    // Count the number of times each cell will undergo melting/solidification
+    int NumDataPoints = RawData.size();
+    for (int i = 0; i < NumDataPoints; i++) {
+        int XInt = getTempCoordX(i, RawData);
+        int YInt = getTempCoordY(i, RawData);
+        int ZInt = getTempCoordZ(i, RawData, 1, 0, ZMinLayer);
+        int D3D1ConvPosition = ZInt * nx * MyYSlices + XInt * MyYSlices + (YInt - MyYOffset);
+        NumberOfSolidificationEvents_Host(D3D1ConvPosition)++;
+    }
+    int NumberOfEvents = calcSolidificationEventOffsets(LocalActiveDomainSize, NumberOfSolidificationEvents_Host,
+                                                        SolidificationEventOffset_Host);
+    LayerTimeTempHistory_Host = ViewF2D_H("TimeTempHistory_H", NumberOfEvents, 3);
+    // Store each data point's TM, TL, CR values in the order read, counting events again as they are stored
+    Kokkos::deep_copy(NumberOfSolidificationEvents_Host, 0);
+    for (int i = 0; i < NumDataPoints; i++) {
+        int XInt = getTempCoordX(i, RawData);
+        int YInt = getTempCoordY(i, RawData);
+        int ZInt = getTempCoordZ(i, RawData, 1, 0, ZMinLayer);
+        int D3D1ConvPosition = ZInt * nx * MyYSlices + XInt * MyYSlices + (YInt - MyYOffset);
+        int EventIndex =
+            SolidificationEventOffset_Host(D3D1ConvPosition) + NumberOfSolidificationEvents_Host(D3D1ConvPosition);
+        LayerTimeTempHistory_Host(EventIndex, 0) = round(getTempCoordTM(i, RawData) / deltat) + 1;
+        LayerTimeTempHistory_Host(EventIndex, 1) = round(getTempCoordTL(i, RawData) / deltat) + 1;
+        LayerTimeTempHistory_Host(EventIndex, 2) = std::abs(getTempCoordCR(i, RawData)) * deltat;
+        NumberOfSolidificationEvents_Host(D3D1ConvPosition)++;
+    }
+    for (int n = 0; n < LocalActiveDomainSize; n++) {
+        int FirstEvent = SolidificationEventOffset_Host(n);
+        // Reorder the cell's events based on the melting time values
+        for (int i = FirstEvent; i < FirstEvent + NumberOfSolidificationEvents_Host(n) - 1; i++) {
+            for (int j = (i + 1); j < FirstEvent + NumberOfSolidificationEvents_Host(n); j++) {
+                if (LayerTimeTempHistory_Host(i, 0) > LayerTimeTempHistory_Host(j, 0)) {
+                    for (int l = 0; l < 3; l++)
+                        std::swap(LayerTimeTempHistory_Host(i, l), LayerTimeTempHistory_Host(j, l));
+                }
+            }
+        }
+        // Remove events where the cell melts again before reaching the liquidus, keeping whichever of the two events
+        // has the larger liquidus time
+        for (int i = 0; i < NumberOfSolidificationEvents_Host(n) - 1; i++) {
+            int ThisEvent = FirstEvent + i;
+            if (LayerTimeTempHistory_Host(ThisEvent + 1, 0) < LayerTimeTempHistory_Host(ThisEvent, 1)) {
+                if (LayerTimeTempHistory_Host(ThisEvent + 1, 1) > LayerTimeTempHistory_Host(ThisEvent, 1)) {
+                    for (int l = 0; l < 3; l++)
+                        LayerTimeTempHistory_Host(ThisEvent, l) = LayerTimeTempHistory_Host(ThisEvent + 1, l);
+                }
+                for (int ii = (ThisEvent + 1); ii < FirstEvent + NumberOfSolidificationEvents_Host(n) - 1; ii++) {
+                    for (int l = 0; l < 3; l++)
+                        LayerTimeTempHistory_Host(ii, l) = LayerTimeTempHistory_Host(ii + 1, l);
+                }
+                NumberOfSolidificationEvents_Host(n)--;
+            }
+        }
+        // Initialize the cell's temperature fields using its first event
+        int GlobalD3D1ConvPosition = n + ZBound_Low * nx * MyYSlices;
+        if ((NumberOfSolidificationEvents_Host(n) > 0) && (LayerTimeTempHistory_Host(FirstEvent, 0) > 0)) {
+            LayerID_Host(GlobalD3D1ConvPosition) = 0;
+            MeltTimeStep_Host(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory_Host(FirstEvent, 0));
+            CritTimeStep_Host(GlobalD3D1ConvPosition) = (int)(LayerTimeTempHistory_Host(FirstEvent, 1));
+            UndercoolingChange_Host(GlobalD3D1ConvPosition) = LayerTimeTempHistory_Host(FirstEvent, 2);
+        }
+    }
+}
+
+void testTempInit_ReadDataRemelt() {
+
+    int id;
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    // Domain for each rank, with a single layer of temperature data starting at Z = 2
+    int nx = 4;
+    int MyYSlices = 3;
+    int MyYOffset = MyYSlices * id;
+    int nzActive = 2;
+    int ZBound_Low = 2;
+    int nz = ZBound_Low + nzActive;
+    int LocalDomainSize = nx * MyYSlices * nz;
+    int LayerDomainSize = nx * MyYSlices * nzActive;
+    double deltax = 1 * pow(10, -6);
+    double deltat = 1 * pow(10, -6);
+    double ZMinLayer[1] = {0.0};
+    int FirstValue[1], LastValue[1];
+
+    // Data points for all but the last few cells of the layer, with many points per cell given out of order of melting
+    // time. Many cells melt again before reaching the liquidus of an earlier event, and some cells have events with
+    // the same melting and liquidus times but different cooling rates, so the order of events read matters
+    RawTemperatureData RawData(0.0, 0.0, 0.0, deltax);
+    int NumCellsWithData = LayerDomainSize - 3;
+    for (int Point = 0; Point < 150; Point++) {
+        int D3D1ConvPosition = (37 * Point + 11 * id) % NumCellsWithData;
+        int ZInt = D3D1ConvPosition / (nx * MyYSlices);
+        int XInt = (D3D1ConvPosition % (nx * MyYSlices)) / MyYSlices;
+        int YInt = D3D1ConvPosition % MyYSlices + MyYOffset;
+        double MeltTime = 5 * (Point % 21) + 11 * ((Point / 21) % 5);
+        double LiquidusTime = MeltTime + 1 + 4 * (Point % 7);
+        double CoolingRate = 0.5 + (Point % 5) + 0.25 * (Point / 21);
+        double XYZTemperaturePoint[6] = {XInt * deltax,     YInt * deltax,         ZInt * deltax,
+                                         MeltTime * deltat, LiquidusTime * deltat, CoolingRate};
+        RawData.addPoint(XYZTemperaturePoint);
+    }
+    FirstValue[0] = 0;
+    LastValue[0] = RawData.size();
+
+    // Build the event table on the device
+    ViewI CritTimeStep("CritTimeStep", LocalDomainSize), LayerID("LayerID", LocalDomainSize);
+    ViewF UndercoolingChange("UndercoolingChange", LocalDomainSize),
+        UndercoolingCurrent("UndercoolingCurrent", LocalDomainSize);
+    ViewI MaxSolidificationEvents("MaxSolidificationEvents", 1), MeltTimeStep, NumberOfSolidificationEvents,
+        SolidificationEventOffset, SolidificationEventCounter;
+    ViewF2D LayerTimeTempHistory;
+    int FinishTimeStep[1];
+    TempInit_ReadDataRemelt(0, id, nx, MyYSlices, nz, LayerDomainSize, LocalDomainSize, MyYOffset, deltax, deltat, 0.0,
+                            LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                            MaxSolidificationEvents, MeltTimeStep, CritTimeStep, UndercoolingChange,
+                            UndercoolingCurrent, ZMinLayer, 1, nzActive, ZBound_Low, FinishTimeStep, LayerID,
+                            FirstValue, LastValue, RawData, SolidificationEventCounter, 1);
+
+    // Build the event table on the host
+    ViewI_H NumberOfSolidificationEvents_Ref("NumSEvents_Ref", LayerDomainSize);
+    ViewI_H SolidificationEventOffset_Ref("SEventOffset_Ref", LayerDomainSize + 1);
+    ViewF2D_H LayerTimeTempHistory_Ref;
+    ViewI_H MeltTimeStep_Ref("MeltTimeStep_Ref", LocalDomainSize);
+    ViewI_H CritTimeStep_Ref("CritTimeStep_Ref", LocalDomainSize);
+    ViewF_H UndercoolingChange_Ref("UndercoolingChange_Ref", LocalDomainSize);
+    ViewI_H LayerID_Ref("LayerID_Ref", LocalDomainSize);
+    Kokkos::deep_copy(LayerID_Ref, -1);
+    buildEventTable_Host(nx, MyYSlices, MyYOffset, LayerDomainSize, ZBound_Low, deltat, RawData, ZMinLayer,
+                         NumberOfSolidificationEvents_Ref, SolidificationEventOffset_Ref, LayerTimeTempHistory_Ref,
+                         MeltTimeStep_Ref, CritTimeStep_Ref, UndercoolingChange_Ref, LayerID_Ref);
+
+    // The maximum number of events is counted before removing double counted events
+    int MaxEvents = 0;
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LayerDomainSize; D3D1ConvPosition++)
+        MaxEvents = std::max(MaxEvents, SolidificationEventOffset_Ref(D3D1ConvPosition + 1) -
+                                            SolidificationEventOffset_Ref(D3D1ConvPosition));
+    int MaxEvents_Global;
+    MPI_Allreduce(&MaxEvents, &MaxEvents_Global, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    ViewI_H MaxSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
+    EXPECT_EQ(MaxSolidificationEvents_Host(0), MaxEvents_Global);
+
+    // Each cell's events, and the events remaining after removing double counted events, should match
+    ViewI_H NumberOfSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NumberOfSolidificationEvents);
+    ViewI_H SolidificationEventOffset_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SolidificationEventOffset);
+    ViewF2D_H LayerTimeTempHistory_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory);
+    int NumCellsWithRemovedEvents = 0;
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LayerDomainSize; D3D1ConvPosition++) {
+        EXPECT_EQ(SolidificationEventOffset_Host(D3D1ConvPosition), SolidificationEventOffset_Ref(D3D1ConvPosition));
+        EXPECT_EQ(NumberOfSolidificationEvents_Host(D3D1ConvPosition),
+                  NumberOfSolidificationEvents_Ref(D3D1ConvPosition));
+        int FirstEvent = SolidificationEventOffset_Ref(D3D1ConvPosition);
+        if (NumberOfSolidificationEvents_Ref(D3D1ConvPosition) < SolidificationEventOffset_Ref(D3D1ConvPosition + 1) -
+                                                                     FirstEvent)
+            NumCellsWithRemovedEvents++;
+        for (int Event = FirstEvent; Event < FirstEvent + NumberOfSolidificationEvents_Ref(D3D1ConvPosition);
+             Event++) {
+            for (int l = 0; l < 3; l++)
+                EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(Event, l), LayerTimeTempHistory_Ref(Event, l));
+        }
+    }
+    EXPECT_EQ(SolidificationEventOffset_Host(LayerDomainSize), SolidificationEventOffset_Ref(LayerDomainSize));
+    EXPECT_GT(NumCellsWithRemovedEvents, 0);
+
+    // Temperature fields should match in the layer, including the cells without data
+    ViewI_H MeltTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep);
+    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
+    ViewF_H UndercoolingChange_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange);
+    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
+    for (int GlobalD3D1ConvPosition = 0; GlobalD3D1ConvPosition < LocalDomainSize; GlobalD3D1ConvPosition++) {
+        EXPECT_EQ(MeltTimeStep_Host(GlobalD3D1ConvPosition), MeltTimeStep_Ref(GlobalD3D1ConvPosition));
+        EXPECT_EQ(CritTimeStep_Host(GlobalD3D1ConvPosition), CritTimeStep_Ref(GlobalD3D1ConvPosition));
+        EXPECT_FLOAT_EQ(UndercoolingChange_Host(GlobalD3D1ConvPosition),
+                        UndercoolingChange_Ref(GlobalD3D1ConvPosition));
+        EXPECT_EQ(LayerID_Host(GlobalD3D1ConvPosition), LayerID_Ref(GlobalD3D1ConvPosition));
+    }
+}
+//---------------------------------------------------------------------------//
+void testTempInit_ReadDataRemelt_Streamed() {
+
+    int id;
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    // Domain for each rank, with a single layer of temperature data starting at Z = 1
+    int nx = 4;
+    int MyYSlices = 3;
+    int MyYOffset = MyYSlices * id;
+    int nzActive = 2;
+    int ZBound_Low = 1;
+    int nz = ZBound_Low + nzActive;
+    int LocalDomainSize = nx * MyYSlices * nz;
+    int LayerDomainSize = nx * MyYSlices * nzActive;
+    double deltax = 1 * pow(10, -6);
+    double deltat = 1 * pow(10, -6);
+    double ZMinLayer[1] = {0.0};
+    int FirstValue[1], LastValue[1];
+
+    // Melting time, liquidus time, and cooling rate for each cell's data points, given out of order of melting time.
+    // The cell at X = 2 melts for the second time before reaching the liquidus (the second data point replaces the
+    // first), and the data point after it is kept regardless. The cell at X = 1, Y = 2 also melts for the second time
+    // before reaching the liquidus, but the second data point has a smaller liquidus time and is discarded
+    std::vector<std::vector<double>> Points = {
+        {1, 0, 0, 70, 80, 3.0}, {2, 1, 1, 30, 45, 6.0}, {1, 0, 0, 10, 20, 1.0},  {1, 2, 0, 100, 110, 9.0},
+        {3, 0, 1, 8, 9, 10.0},  {2, 1, 1, 15, 30, 4.0}, {1, 2, 0, 5, 25, 8.0},   {2, 1, 1, 60, 70, 7.0},
+        {1, 0, 0, 40, 50, 2.0}, {2, 1, 1, 25, 35, 5.0}, {1, 2, 0, 12, 18, 11.0}};
+    RawTemperatureData RawData(0.0, 0.0, 0.0, deltax);
+    for (auto &Point : Points) {
+        double XYZTemperaturePoint[6] = {Point[0] * deltax, (Point[1] + MyYOffset) * deltax, Point[2] * deltax,
+                                         Point[3] * deltat, Point[4] * deltat, Point[5]};
+        RawData.addPoint(XYZTemperaturePoint);
+    }
+    FirstValue[0] = 0;
+    LastValue[0] = RawData.size();
+
+    // Initialize the layer with all events stored on the device, and with events streamed to the device
+    ViewI CritTimeStep("CritTimeStep", LocalDomainSize), LayerID("LayerID", LocalDomainSize);
+    ViewF UndercoolingChange("UndercoolingChange", LocalDomainSize),
+        UndercoolingCurrent("UndercoolingCurrent", LocalDomainSize);
+    ViewI MaxSolidificationEvents("MaxSolidificationEvents", 1), MeltTimeStep, NumberOfSolidificationEvents,
+        SolidificationEventOffset, SolidificationEventCounter;
+    ViewF2D LayerTimeTempHistory;
+    int FinishTimeStep[1];
+    TempInit_ReadDataRemelt(0, id, nx, MyYSlices, nz, LayerDomainSize, LocalDomainSize, MyYOffset, deltax, deltat, 0.0,
+                            LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                            MaxSolidificationEvents, MeltTimeStep, CritTimeStep, UndercoolingChange,
+                            UndercoolingCurrent, ZMinLayer, 1, nzActive, ZBound_Low, FinishTimeStep, LayerID,
+                            FirstValue, LastValue, RawData, SolidificationEventCounter, 1);
+
+    TemperatureEventStream EventStream;
+    EventStream.WindowSize = 10;
+    ViewI CritTimeStep_S("CritTimeStep_S", LocalDomainSize), LayerID_S("LayerID_S", LocalDomainSize);
+    ViewF UndercoolingChange_S("UndercoolingChange_S", LocalDomainSize),
+        UndercoolingCurrent_S("UndercoolingCurrent_S", LocalDomainSize);
+    ViewI MaxSolidificationEvents_S("MaxSolidificationEvents_S", 1), MeltTimeStep_S, NumberOfSolidificationEvents_S,
+        SolidificationEventOffset_S, SolidificationEventCounter_S;
+    ViewF2D LayerTimeTempHistory_S;
+    int FinishTimeStep_S[1];
+    TempInit_ReadDataRemelt_Streamed(0, id, nx, MyYSlices, LayerDomainSize, LocalDomainSize, MyYOffset, deltat, 0.0,
+                                     NumberOfSolidificationEvents_S, MaxSolidificationEvents_S, MeltTimeStep_S,
+                                     CritTimeStep_S, UndercoolingChange_S, UndercoolingCurrent_S, ZMinLayer, 1,
+                                     nzActive, ZBound_Low, FinishTimeStep_S, LayerID_S, FirstValue, LastValue,
+                                     RawData, SolidificationEventCounter_S, 1, EventStream);
+
+    // Temperature fields should match
+    EXPECT_EQ(FinishTimeStep_S[0], FinishTimeStep[0]);
+    ViewI_H MaxSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents_S);
+    EXPECT_EQ(MaxSolidificationEvents_Host(0), 4);
+    ViewI_H MeltTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep);
+    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
+    ViewF_H UndercoolingChange_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange);
+    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
+    ViewI_H MeltTimeStep_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep_S);
+    ViewI_H CritTimeStep_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep_S);
+    ViewF_H UndercoolingChange_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), UndercoolingChange_S);
+    ViewI_H LayerID_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID_S);
+    for (int GlobalD3D1ConvPosition = ZBound_Low * nx * MyYSlices; GlobalD3D1ConvPosition < LocalDomainSize;
+         GlobalD3D1ConvPosition++) {
+        EXPECT_EQ(MeltTimeStep_S_Host(GlobalD3D1ConvPosition), MeltTimeStep_Host(GlobalD3D1ConvPosition));
+        EXPECT_EQ(CritTimeStep_S_Host(GlobalD3D1ConvPosition), CritTimeStep_Host(GlobalD3D1ConvPosition));
+        EXPECT_FLOAT_EQ(UndercoolingChange_S_Host(GlobalD3D1ConvPosition),
+                        UndercoolingChange_Host(GlobalD3D1ConvPosition));
+        EXPECT_EQ(LayerID_S_Host(GlobalD3D1ConvPosition), LayerID_Host(GlobalD3D1ConvPosition));
+    }
+
+    // After trimming to the active region, the host copy of the streamed events should match the events stored on the
+    // device without streaming
+    int XBound_Low, nxActive, YBound_Low, nyActive;
+    calcActiveRegionBounds("R", id, 0, nx, MyYSlices, nzActive, ZBound_Low, CritTimeStep, XBound_Low, nxActive,
+                           YBound_Low, nyActive);
+    TrimEventDataToActiveRegion(nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive,
+                                LayerTimeTempHistory, NumberOfSolidificationEvents, SolidificationEventOffset,
+                                SolidificationEventCounter);
+    TrimEventStreamToActiveRegion(nx, MyYSlices, nzActive, XBound_Low, nxActive, YBound_Low, nyActive, EventStream,
+                                  LayerTimeTempHistory_S, NumberOfSolidificationEvents_S, SolidificationEventOffset_S,
+                                  SolidificationEventCounter_S);
+    int LocalActiveDomainSize = nxActive * nyActive * nzActive;
+    EXPECT_EQ(LocalActiveDomainSize, 18);
+    ViewI_H NumberOfSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NumberOfSolidificationEvents);
+    ViewI_H NumberOfSolidificationEvents_S_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NumberOfSolidificationEvents_S);
+    ViewI_H SolidificationEventOffset_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SolidificationEventOffset);
+    ViewF2D_H LayerTimeTempHistory_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory);
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LocalActiveDomainSize; D3D1ConvPosition++) {
+        EXPECT_EQ(NumberOfSolidificationEvents_S_Host(D3D1ConvPosition),
+                  NumberOfSolidificationEvents_Host(D3D1ConvPosition));
+        EXPECT_EQ(EventStream.NumberOfSolidificationEvents_Host(D3D1ConvPosition),
+                  NumberOfSolidificationEvents_Host(D3D1ConvPosition));
+        EXPECT_EQ(EventStream.SolidificationEventOffset_Host(D3D1ConvPosition),
+                  SolidificationEventOffset_Host(D3D1ConvPosition));
+    }
+    int NumberOfEvents = SolidificationEventOffset_Host(LocalActiveDomainSize);
+    EXPECT_EQ(NumberOfEvents, 9);
+    for (int Event = 0; Event < NumberOfEvents; Event++) {
+        for (int l = 0; l < 3; l++)
+            EXPECT_FLOAT_EQ(EventStream.LayerTimeTempHistory_Host(Event, l), LayerTimeTempHistory_Host(Event, l));
+    }
+
+    // Active region cells with temperature data, and their expected events (melting and liquidus time steps)
+    int CellA = 0;      // X = 1, Y = 0, Z = 0
+    int CellB = 13;     // X = 2, Y = 1, Z = 1
+    int CellC = 2;      // X = 1, Y = 2, Z = 0
+    int GlobalCellC = ZBound_Low * nx * MyYSlices + 1 * MyYSlices + 2;
+    EXPECT_EQ(NumberOfSolidificationEvents_Host(CellA), 3);
+    EXPECT_EQ(NumberOfSolidificationEvents_Host(CellB), 3);
+    EXPECT_EQ(NumberOfSolidificationEvents_Host(CellC), 2);
+    int FirstEventB = SolidificationEventOffset_Host(CellB);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEventB, 0), 26);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEventB, 1), 36);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEventB + 1, 0), 31);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEventB + 2, 0), 61);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(SolidificationEventOffset_Host(CellC) + 1, 0), 101);
+
+    // No events other than the first are on the device yet, and the first to load melts at time step 31
+    EXPECT_EQ(EventStream.EventSlots, 1);
+    EXPECT_EQ(EventStream.NextLoadTimeStep, 31 - EventStream.WindowSize);
+    ViewI TileWakeTime("TileWakeTime", 1);
+    Kokkos::deep_copy(TileWakeTime, INT_MAX - 1);
+
+    // The first window holds the second events of cells B (melting at 31) and A (melting at 41), each stored in the
+    // cell's only ring buffer slot
+    loadEventWindow(EventStream.NextLoadTimeStep, EventStream, nx, MyYSlices, ZBound_Low, XBound_Low, nxActive,
+                    YBound_Low, nyActive, nzActive, LayerTimeTempHistory_S, SolidificationEventOffset_S,
+                    SolidificationEventCounter_S, MeltTimeStep_S, CritTimeStep_S, UndercoolingChange_S, TileWakeTime);
+    EXPECT_EQ(EventStream.EventSlots, 1);
+    EXPECT_EQ(EventStream.NextLoadTimeStep, 61 - EventStream.WindowSize);
+    ViewF2D_H LayerTimeTempHistory_S_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory_S);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(CellB, 0), 31);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(CellB, 1), 46);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(CellA, 0), 41);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(CellC, 0), 0);
+
+    // The second window holds the third events of cells B and A, which haven't used their second events yet: the ring
+    // buffer grows to two slots per cell, with event "n" in slot "n" modulo 2
+    loadEventWindow(EventStream.NextLoadTimeStep, EventStream, nx, MyYSlices, ZBound_Low, XBound_Low, nxActive,
+                    YBound_Low, nyActive, nzActive, LayerTimeTempHistory_S, SolidificationEventOffset_S,
+                    SolidificationEventCounter_S, MeltTimeStep_S, CritTimeStep_S, UndercoolingChange_S, TileWakeTime);
+    EXPECT_EQ(EventStream.EventSlots, 2);
+    EXPECT_EQ(EventStream.NextLoadTimeStep, 101 - EventStream.WindowSize);
+    ViewI_H SolidificationEventOffset_S_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SolidificationEventOffset_S);
+    LayerTimeTempHistory_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory_S);
+    EXPECT_EQ(SolidificationEventOffset_S_Host(CellB), 2 * CellB);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(2 * CellB + 1, 0), 31);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(2 * CellB, 0), 61);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(2 * CellB, 1), 71);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(2 * CellA + 1, 0), 41);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(2 * CellA, 0), 71);
+
+    // Cell C already solidified for the first time, and is waiting for its second event: the last window's event is
+    // placed in its temperature fields directly, and its tile is woken up at the new melting time
+    ViewI_H SolidificationEventCounter_S_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SolidificationEventCounter_S);
+    SolidificationEventCounter_S_Host(CellC) = 1;
+    Kokkos::deep_copy(SolidificationEventCounter_S, SolidificationEventCounter_S_Host);
+    loadEventWindow(EventStream.NextLoadTimeStep, EventStream, nx, MyYSlices, ZBound_Low, XBound_Low, nxActive,
+                    YBound_Low, nyActive, nzActive, LayerTimeTempHistory_S, SolidificationEventOffset_S,
+                    SolidificationEventCounter_S, MeltTimeStep_S, CritTimeStep_S, UndercoolingChange_S, TileWakeTime);
+    EXPECT_EQ(EventStream.NextLoadTimeStep, INT_MAX);
+    MeltTimeStep_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep_S);
+    CritTimeStep_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep_S);
+    LayerTimeTempHistory_S_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory_S);
+    ViewI_H TileWakeTime_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), TileWakeTime);
+    EXPECT_EQ(MeltTimeStep_S_Host(GlobalCellC), 101);
+    EXPECT_EQ(CritTimeStep_S_Host(GlobalCellC), 111);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(2 * CellC, 0), 0);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_S_Host(2 * CellC + 1, 0), 0);
+    EXPECT_EQ(TileWakeTime_Host(0), 101);
+}
+
+void testTempInit_SpotRemelt() {
+
+    int id;
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    // Two spots of radius 3 cells, 2 cells apart in X, with each rank holding the whole domain in Y
+    int NSpotsX = 2;
+    int NSpotsY = 1;
+    int SpotRadius = 3;
+    int SpotOffset = 2;
+    int nx = 2 * SpotRadius + 1 + SpotOffset;
+    int MyYSlices = 2 * SpotRadius + 1;
+    int nzActive = SpotRadius + 1;
+    int LocalDomainSize = nx * MyYSlices * nzActive;
+    double G = 500000.0;
+    double R = 300000.0;
+    double deltax = 1 * pow(10, -6);
+    double deltat = deltax / (10 * (R / G));
+    double FreezingRange = 210.0;
+
+    ViewI CritTimeStep("CritTimeStep", LocalDomainSize), LayerID("LayerID", LocalDomainSize);
+    ViewF UndercoolingChange("UndercoolingChange", LocalDomainSize),
+        UndercoolingCurrent("UndercoolingCurrent", LocalDomainSize);
+    ViewI MaxSolidificationEvents("MaxSolidificationEvents", 1), MeltTimeStep, NumberOfSolidificationEvents,
+        SolidificationEventOffset, SolidificationEventCounter;
+    ViewF2D LayerTimeTempHistory;
+    int MyYOffset = 0;
+    TempInit_SpotRemelt(0, G, R, "S", id, nx, MyYSlices, MyYOffset, deltax, deltat, 0, nzActive, LocalDomainSize,
+                        LocalDomainSize, CritTimeStep, UndercoolingChange, UndercoolingCurrent, 1, FreezingRange,
+                        LayerID, NSpotsX, NSpotsY, SpotRadius, SpotOffset, LayerTimeTempHistory,
+                        NumberOfSolidificationEvents, SolidificationEventOffset, MeltTimeStep, MaxSolidificationEvents,
+                        SolidificationEventCounter);
+
+    SpotArrayProvider Spots(G, R, deltax, deltat, FreezingRange, NSpotsX, NSpotsY, SpotRadius, SpotOffset);
+    EXPECT_FLOAT_EQ(Spots.IsothermVelocity, 0.1);
+    ViewI_H MaxSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
+    EXPECT_EQ(MaxSolidificationEvents_Host(0), 2);
+    ViewI_H NumberOfSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NumberOfSolidificationEvents);
+    ViewI_H SolidificationEventOffset_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SolidificationEventOffset);
+    ViewF2D_H LayerTimeTempHistory_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory);
+    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
+    ViewI_H MeltTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep);
+    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
+
+    // The cell at the top of the first spot's center is 2 cells from the second spot's center, and melts in both
+    int CenterCell = SpotRadius * nx * MyYSlices + SpotRadius * MyYSlices + SpotRadius;
+    EXPECT_EQ(NumberOfSolidificationEvents_Host(CenterCell), 2);
+    int FirstEvent = SolidificationEventOffset_Host(CenterCell);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEvent, 0), 1);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEvent, 1), 1 + (int)(3.0f / Spots.IsothermVelocity));
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEvent + 1, 0), 1 + Spots.TimeBetweenSpots);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEvent + 1, 1),
+                    1 + (int)(1.0f / Spots.IsothermVelocity) + Spots.TimeBetweenSpots);
+    EXPECT_FLOAT_EQ(LayerTimeTempHistory_Host(FirstEvent + 1, 2), R * deltat);
+    EXPECT_EQ(MeltTimeStep_Host(CenterCell), 1);
+    EXPECT_EQ(CritTimeStep_Host(CenterCell), 1 + (int)(3.0f / Spots.IsothermVelocity));
+    EXPECT_EQ(LayerID_Host(CenterCell), 0);
+    // The bottom corner cell is outside of both spots
+    EXPECT_EQ(NumberOfSolidificationEvents_Host(0), 0);
+    EXPECT_EQ(CritTimeStep_Host(0), 0);
+    EXPECT_EQ(LayerID_Host(0), -1);
+
+    // Without remelting, each cell keeps its last solidification event
+    ViewI CritTimeStep_NR("CritTimeStep_NR", 0), LayerID_NR("LayerID_NR", 0);
+    ViewF UndercoolingChange_NR("UndercoolingChange_NR", 0);
+    TempInit_SpotNoRemelt(G, R, "S", id, nx, MyYSlices, MyYOffset, deltax, deltat, nzActive, LocalDomainSize,
+                          CritTimeStep_NR, UndercoolingChange_NR, 1, 1, FreezingRange, LayerID_NR, NSpotsX, NSpotsY,
+                          SpotRadius, SpotOffset);
+    ViewI_H CritTimeStep_NR_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep_NR);
+    ViewI_H LayerID_NR_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID_NR);
+    for (int D3D1ConvPosition = 0; D3D1ConvPosition < LocalDomainSize; D3D1ConvPosition++) {
+        int NumEvents = NumberOfSolidificationEvents_Host(D3D1ConvPosition);
+        if (NumEvents > 0) {
+            int LastEvent = SolidificationEventOffset_Host(D3D1ConvPosition) + NumEvents - 1;
+            EXPECT_FLOAT_EQ(CritTimeStep_NR_Host(D3D1ConvPosition), LayerTimeTempHistory_Host(LastEvent, 1));
+        }
+        else {
+            EXPECT_EQ(CritTimeStep_NR_Host(D3D1ConvPosition), 0);
+        }
+        EXPECT_EQ(LayerID_NR_Host(D3D1ConvPosition), LayerID_Host(D3D1ConvPosition));
+    }
+}
+
+void testSpotArrayProvider() {
+
+    // Spot arrays with heavily overlapping, barely overlapping, separate, and coincident spots
+    int NSpotsX = 4;
+    int NSpotsY = 3;
+    int SpotRadius = 4;
+    std::vector<int> SpotOffsets = {1, 3, 7, 12, 0};
+    double G = 500000.0;
+    double R = 300000.0;
+    double deltax = 1 * pow(10, -6);
+    double deltat = deltax / (10 * (R / G));
+    double FreezingRange = 210.0;
+    for (int SpotOffset : SpotOffsets) {
+        SpotArrayProvider Spots(G, R, deltax, deltat, FreezingRange, NSpotsX, NSpotsY, SpotRadius, SpotOffset);
+        int nx = 2 * SpotRadius + 1 + SpotOffset * (NSpotsX - 1);
+        int ny = 2 * SpotRadius + 1 + SpotOffset * (NSpotsY - 1);
+        for (int k = 0; k <= SpotRadius; k++) {
+            for (int i = 0; i < nx; i++) {
+                for (int j = 0; j < ny; j++) {
+                    // Each spot containing the cell should give one event, in the order the spots are melted
+                    int NumEvents = Spots.numEvents(i, j, k);
+                    int EventNumber = 0;
+                    for (int Spot = 0; Spot < Spots.NumberOfSpots; Spot++) {
+                        float TotDist = Spots.calcSpotDistance(Spot, i, j, k);
+                        if (TotDist > SpotRadius)
+                            continue;
+                        ASSERT_LT(EventNumber, NumEvents);
+                        int MeltTimeStep, CritTimeStep;
+                        float UndercoolingChange;
+                        Spots.getEvent(i, j, k, EventNumber, MeltTimeStep, CritTimeStep, UndercoolingChange);
+                        EXPECT_EQ(MeltTimeStep, 1 + Spots.TimeBetweenSpots * Spot);
+                        EXPECT_EQ(CritTimeStep, 1 + (int)(((float)(SpotRadius)-TotDist) / Spots.IsothermVelocity) +
+                                                    Spots.TimeBetweenSpots * Spot);
+                        EventNumber++;
+                    }
+                    EXPECT_EQ(NumEvents, EventNumber);
+                }
+            }
+        }
+    }
+}
+
+void testTempInit_Raster() {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    // Three tracks, 100 microns long and 50 microns apart, on a 5 micron grid
+    double deltax = 5 * pow(10, -6);
+    double deltat = 1 * pow(10, -7);
+    RosenthalRasterProvider Raster(100.0, 1.0, 25.0, 5.0 * pow(10, -6), 300.0, 1600.0, 20, 10, 3, deltax, deltat);
+    // The peak temperature reaches the liquidus at the edge of the melt pool, but not one cell further out
+    int PoolRadius = Raster.PoolRadius;
+    EXPECT_GT(PoolRadius, 1);
+    EXPECT_GE(Raster.calcPeakTemperatureRise(PoolRadius * deltax), Raster.LiquidusRise);
+    EXPECT_LT(Raster.calcPeakTemperatureRise((PoolRadius + 1) * deltax), Raster.LiquidusRise);
+
+    // Domain spanning the tracks, split among ranks in Y
+    int nx = Raster.TrackLength + 1;
+    int ny = 2 * PoolRadius + 1 + Raster.HatchSpacing * (Raster.NumberOfTracks - 1);
+    int nzActive = PoolRadius + 1;
+    int MyYOffset = id * ny / np;
+    int MyYSlices = (id + 1) * ny / np - MyYOffset;
+    int LocalDomainSize = nx * MyYSlices * nzActive;
+
+    ViewI CritTimeStep("CritTimeStep", LocalDomainSize), LayerID("LayerID", LocalDomainSize);
+    ViewF UndercoolingChange("UndercoolingChange", LocalDomainSize),
+        UndercoolingCurrent("UndercoolingCurrent", LocalDomainSize);
+    ViewI MaxSolidificationEvents("MaxSolidificationEvents", 1), MeltTimeStep, NumberOfSolidificationEvents,
+        SolidificationEventOffset, SolidificationEventCounter;
+    ViewF2D LayerTimeTempHistory;
+    TempInit_RasterRemelt(Raster, 0, id, nx, MyYSlices, MyYOffset, 0, LocalDomainSize, LocalDomainSize, CritTimeStep,
+                          UndercoolingChange, UndercoolingCurrent, LayerID, LayerTimeTempHistory,
+                          NumberOfSolidificationEvents, SolidificationEventOffset, MeltTimeStep,
+                          MaxSolidificationEvents, SolidificationEventCounter);
+    ViewI CritTimeStep_NR("CritTimeStep_NR", 0), LayerID_NR("LayerID_NR", 0);
+    ViewF UndercoolingChange_NR("UndercoolingChange_NR", 0);
+    TempInit_RasterNoRemelt(Raster, id, nx, MyYSlices, MyYOffset, LocalDomainSize, CritTimeStep_NR,
+                            UndercoolingChange_NR, 1, 1, LayerID_NR);
+
+    ViewI_H MaxSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MaxSolidificationEvents);
+    ViewI_H NumberOfSolidificationEvents_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NumberOfSolidificationEvents);
+    ViewI_H SolidificationEventOffset_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), SolidificationEventOffset);
+    ViewF2D_H LayerTimeTempHistory_Host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerTimeTempHistory);
+    ViewI_H MeltTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), MeltTimeStep);
+    ViewI_H CritTimeStep_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep);
+    ViewI_H LayerID_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID);
+    ViewI_H CritTimeStep_NR_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CritTimeStep_NR);
+    ViewI_H LayerID_NR_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), LayerID_NR);
+    EXPECT_GE(MaxSolidificationEvents_Host(0), 1);
+    EXPECT_LE(MaxSolidificationEvents_Host(0), Raster.NumberOfTracks);
+    for (int k = 0; k < nzActive; k++) {
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < MyYSlices; j++) {
+                int D3D1ConvPosition = k * nx * MyYSlices + i * MyYSlices + j;
+                // Cells melt only if they are within the melt pool radius of a track
+                double MinTrackDistance = 2.0 * ny * deltax;
+                for (int Track = 0; Track < Raster.NumberOfTracks; Track++) {
+                    double DistY = (j + MyYOffset - PoolRadius - Track * Raster.HatchSpacing) * deltax;
+                    double DistZ = (PoolRadius - k) * deltax;
+                    MinTrackDistance = std::min(MinTrackDistance, sqrt(DistY * DistY + DistZ * DistZ));
+                }
+                int NumEvents = NumberOfSolidificationEvents_Host(D3D1ConvPosition);
+                EXPECT_EQ(NumEvents > 0, MinTrackDistance <= Raster.MaxMeltDistance);
+                EXPECT_LE(NumEvents, MaxSolidificationEvents_Host(0));
+                if (NumEvents == 0) {
+                    EXPECT_EQ(CritTimeStep_Host(D3D1ConvPosition), 0);
+                    EXPECT_EQ(LayerID_Host(D3D1ConvPosition), -1);
+                    EXPECT_EQ(CritTimeStep_NR_Host(D3D1ConvPosition), 0);
+                    EXPECT_EQ(LayerID_NR_Host(D3D1ConvPosition), -1);
+                    continue;
+                }
+                // Each cell goes below the liquidus after melting, cools while doing so, and finishes each event
+                // before melting again
+                int FirstEvent = SolidificationEventOffset_Host(D3D1ConvPosition);
+                for (int n = FirstEvent; n < FirstEvent + NumEvents; n++) {
+                    EXPECT_LT(LayerTimeTempHistory_Host(n, 0), LayerTimeTempHistory_Host(n, 1));
+                    EXPECT_GT(LayerTimeTempHistory_Host(n, 2), 0.0);
+                    if (n > FirstEvent) {
+                        EXPECT_GT(LayerTimeTempHistory_Host(n, 0), LayerTimeTempHistory_Host(n - 1, 1));
+                    }
+                }
+                EXPECT_EQ(MeltTimeStep_Host(D3D1ConvPosition), LayerTimeTempHistory_Host(FirstEvent, 0));
+                EXPECT_EQ(CritTimeStep_Host(D3D1ConvPosition), LayerTimeTempHistory_Host(FirstEvent, 1));
+                EXPECT_EQ(LayerID_Host(D3D1ConvPosition), 0);
+                // Without remelting, each cell keeps its last event
+                EXPECT_EQ(CritTimeStep_NR_Host(D3D1ConvPosition),
+                          LayerTimeTempHistory_Host(FirstEvent + NumEvents - 1, 1));
+                EXPECT_EQ(LayerID_NR_Host(D3D1ConvPosition), 0);
+            }
+        }
+    }
+
+    // The first track is scanned in +X from time 0: cells on its centerline at the top surface melt in order, starting
+    // with the cell at the start of the track, which is already above the liquidus
+    if ((MyYOffset <= PoolRadius) && (PoolRadius < MyYOffset + MyYSlices)) {
+        int CenterlineJ = PoolRadius - MyYOffset;
+        for (int i = 0; i < nx; i++) {
+            int D3D1ConvPosition = PoolRadius * nx * MyYSlices + i * MyYSlices + CenterlineJ;
+            if (i == 0) {
+                EXPECT_EQ(MeltTimeStep_Host(D3D1ConvPosition), 1);
+            }
+            else {
+                EXPECT_GE(MeltTimeStep_Host(D3D1ConvPosition), MeltTimeStep_Host(D3D1ConvPosition - MyYSlices));
+            }
+        }
+    }
+}
+//---------------------------------------------------------------------------//
 // nuclei_init_tests
 //---------------------------------------------------------------------------//
+void testcalcActiveRegionBounds() {
+
+    int id, np;
+    // Get number of processes
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    // Get individual process ID
+    MPI_Comm_rank(MPI_COMM_WORLD, &id);
+
+    // Domain for each rank
+    int nx = 10;
+    int MyYSlices = 8;
+    int nzActive = 4;
+    int ZBound_Low = 3;
+    int nz = nzActive + ZBound_Low;
+    int LocalDomainSize = nx * MyYSlices * nz;
+
+    // Within the layer's Z bounds, only cells in a box (offset in X on odd ranks) have temperature data. Cells below
+    // the layer also have temperature data, but should not affect the bounds
+    ViewI_H CritTimeStep_Host("CritTimeStep_Host", LocalDomainSize);
+    for (int GlobalZ = 0; GlobalZ < nz; GlobalZ++) {
+        for (int RankX = 0; RankX < nx; RankX++) {
+            for (int RankY = 0; RankY < MyYSlices; RankY++) {
+                int GlobalD3D1ConvPosition = GlobalZ * nx * MyYSlices + RankX * MyYSlices + RankY;
+                if (GlobalZ < ZBound_Low)
+                    CritTimeStep_Host(GlobalD3D1ConvPosition) = 1;
+                else if ((RankX >= 2 + id % 2) && (RankX <= 5 + id % 2) && (RankY >= 3) && (RankY <= 4))
+                    CritTimeStep_Host(GlobalD3D1ConvPosition) = 1;
+            }
+        }
+    }
+    ViewI CritTimeStep = Kokkos::create_mirror_view_and_copy(Kokkos::DefaultExecutionSpace(), CritTimeStep_Host);
+
+    int XBound_Low, nxActive, YBound_Low, nyActive;
+    calcActiveRegionBounds("R", id, 0, nx, MyYSlices, nzActive, ZBound_Low, CritTimeStep, XBound_Low, nxActive,
+                           YBound_Low, nyActive);
+    // X bounds are shared by all ranks, Y bounds are specific to each rank
+    EXPECT_EQ(XBound_Low, 2);
+    if (np > 1)
+        EXPECT_EQ(nxActive, 5);
+    else
+        EXPECT_EQ(nxActive, 4);
+    EXPECT_EQ(YBound_Low, 3);
+    EXPECT_EQ(nyActive, 2);
+
+    // Constrained solidification problems always use the full extent of the rank's subdomain
+    calcActiveRegionBounds("C", id, 0, nx, MyYSlices, nzActive, ZBound_Low, CritTimeStep, XBound_Low, nxActive,
+                           YBound_Low, nyActive);
+    EXPECT_EQ(XBound_Low, 0);
+    EXPECT_EQ(nxActive, nx);
+    EXPECT_EQ(YBound_Low, 0);
+    EXPECT_EQ(nyActive, MyYSlices);
+}
+//---------------------------------------------------------------------------//
 void testNucleiInit(bool RemeltingYN) {
 
     // Test is different depending on whether or not remelting is considered
@@ -552,18 +1630,18 @@ void testNucleiInit(bool RemeltingYN) {
     // This part of the test is different depending on whether remelting is considered
     // Without remelting, initialize MaxSolidificationEvents to 1 for each layer, initialize CritTimeStep values and
     // UndercoolingChange values to values depending on cell coordinates relative to global grid, then copy to the
-    // device. LayerTimeTempHistory and NumberOfSolidificationEvents are unused on the device With remelting, initialize
-    // MaxSolidificationEvents to 3 for each layer. LayerTimeTempHistory and NumberOfSolidificationEvents are
-    // initialized for each cell on the host and copied to the device, while CritTimeStep and UndercoolingChange go
-    // unused
+    // device. LayerTimeTempHistory, NumberOfSolidificationEvents, and SolidificationEventOffset are unused on the
+    // device. With remelting, initialize MaxSolidificationEvents to 3 for each layer. LayerTimeTempHistory,
+    // NumberOfSolidificationEvents, and SolidificationEventOffset are initialized for each cell on the host and copied
+    // to the device, while CritTimeStep and UndercoolingChange go unused
     ViewI_H CritTimeStep_Host(Kokkos::ViewAllocateWithoutInitializing("CritTimeStep_Host"), LocalDomainSize);
     ViewF_H UndercoolingChange_Host(Kokkos::ViewAllocateWithoutInitializing("UndercoolingChange_Host"),
                                     LocalDomainSize);
     ViewI_H MaxSolidificationEvents_Host(Kokkos::ViewAllocateWithoutInitializing("MaxSolidificationEvents_Host"), 2);
     ViewI_H NumberOfSolidificationEvents_Host(
         Kokkos::ViewAllocateWithoutInitializing("NumberOfSolidificationEvents_Host"), LocalActiveDomainSize);
-    ViewF3D LayerTimeTempHistory_Host(Kokkos::ViewAllocateWithoutInitializing("LayerTimeTempHistory_Host"),
-                                      LocalActiveDomainSize, MaxSolidificationEvents_Count, 3);
+    ViewI_H SolidificationEventOffset_Host("SolidificationEventOffset_Host", LocalActiveDomainSize + 1);
+    ViewF2D_H LayerTimeTempHistory_Host(Kokkos::ViewAllocateWithoutInitializing("LayerTimeTempHistory_Host"), 0, 3);
     MaxSolidificationEvents_Host(0) = MaxSolidificationEvents_Count;
     MaxSolidificationEvents_Host(1) = MaxSolidificationEvents_Count;
     if (RemeltingYN) {
@@ -581,21 +1659,26 @@ void testNucleiInit(bool RemeltingYN) {
                 }
             }
         }
+        // Each cell's events are stored consecutively in LayerTimeTempHistory
+        int NumberOfEvents = calcSolidificationEventOffsets(LocalActiveDomainSize, NumberOfSolidificationEvents_Host,
+                                                            SolidificationEventOffset_Host);
+        Kokkos::resize(LayerTimeTempHistory_Host, NumberOfEvents, 3);
         for (int n = 0; n < MaxSolidificationEvents_Count; n++) {
             for (int RankZ = 0; RankZ < nzActive; RankZ++) {
                 for (int RankX = 0; RankX < nx; RankX++) {
                     for (int RankY = 0; RankY < MyYSlices; RankY++) {
                         int D3D1ConvPosition = RankZ * nx * MyYSlices + RankX * MyYSlices + RankY;
                         int GlobalZ = RankZ + ZBound_Low;
+                        int ThisEvent = SolidificationEventOffset_Host(D3D1ConvPosition) + n;
                         if (n < NumberOfSolidificationEvents_Host(D3D1ConvPosition)) {
-                            LayerTimeTempHistory_Host(D3D1ConvPosition, n, 0) =
+                            LayerTimeTempHistory_Host(ThisEvent, 0) =
                                 GlobalZ + RankY + MyYOffset +
                                 (LocalActiveDomainSize * n); // melting time step depends on solidification event number
-                            LayerTimeTempHistory_Host(D3D1ConvPosition, n, 1) =
+                            LayerTimeTempHistory_Host(ThisEvent, 1) =
                                 GlobalZ + RankY + MyYOffset + 1 +
                                 (LocalActiveDomainSize *
                                  n); // liquidus time stemp depends on solidification event number
-                            LayerTimeTempHistory_Host(D3D1ConvPosition, n, 2) =
+                            LayerTimeTempHistory_Host(ThisEvent, 2) =
                                 1.2; // ensures that a cell's nucleation time will be 1 time step after its CritTimeStep
                                      // value
                         }
@@ -620,12 +1703,15 @@ void testNucleiInit(bool RemeltingYN) {
     ViewI MaxSolidificationEvents = Kokkos::create_mirror_view_and_copy(memory_space(), MaxSolidificationEvents_Host);
     ViewI NumberOfSolidificationEvents =
         Kokkos::create_mirror_view_and_copy(memory_space(), NumberOfSolidificationEvents_Host);
-    ViewF3D LayerTimeTempHistory = Kokkos::create_mirror_view_and_copy(memory_space(), LayerTimeTempHistory_Host);
+    ViewI SolidificationEventOffset =
+        Kokkos::create_mirror_view_and_copy(memory_space(), SolidificationEventOffset_Host);
+    ViewF2D LayerTimeTempHistory = Kokkos::create_mirror_view_and_copy(memory_space(), LayerTimeTempHistory_Host);
 
-    NucleiInit(layernumber, RNGSeed, MyYSlices, MyYOffset, nx, ny, nzActive, ZBound_Low, id, NMax, dTN, dTsigma, deltax,
-               NucleiLocation, NucleationTimes_Host, NucleiGrainID, CellType, CritTimeStep, UndercoolingChange, LayerID,
-               PossibleNuclei_ThisRankThisLayer, Nuclei_WholeDomain, AtNorthBoundary, AtSouthBoundary, RemeltingYN,
-               NucleationCounter, MaxSolidificationEvents, NumberOfSolidificationEvents, LayerTimeTempHistory);
+    NucleiInit(layernumber, RNGSeed, MyYSlices, MyYOffset, nx, ny, nzActive, ZBound_Low, 0, nx, 0, MyYSlices, id, NMax,
+               dTN, dTsigma, deltax, NucleiLocation, NucleationTimes_Host, NucleiGrainID, CellType, CritTimeStep,
+               UndercoolingChange, LayerID, PossibleNuclei_ThisRankThisLayer, Nuclei_WholeDomain, AtNorthBoundary,
+               AtSouthBoundary, RemeltingYN, NucleationCounter, MaxSolidificationEvents, NumberOfSolidificationEvents,
+               SolidificationEventOffset, LayerTimeTempHistory);
 
     // Copy results back to host to check
     ViewI_H NucleiLocation_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), NucleiLocation);
@@ -675,12 +1761,29 @@ void testNucleiInit(bool RemeltingYN) {
 //---------------------------------------------------------------------------//
 TEST(TEST_CATEGORY, grain_init_tests) {
     testSubstrateInit_ConstrainedGrowth();
+    // ASCII and binary substrate files
+    testSubstrateInit_FromFile(false);
+    testSubstrateInit_FromFile(true);
     testBaseplateInit_FromGrainSpacing();
+    testAssignVoronoiGrainIDs();
     testPowderInit();
 }
 TEST(TEST_CATEGORY, cell_init_test) {
     testCellTypeInit_NoRemelt();
     testCellTypeInit_Remelt();
+    testcalcActiveRegionBounds();
+}
+TEST(TEST_CATEGORY, temperature_init_test) {
+    // w/ and w/o interpolation between heat transport and CA grids
+    testTempInit_ReadDataNoRemelt(1);
+    testTempInit_ReadDataNoRemelt(2);
+    // w/ a nonzero XMin and data points that are not on the CA grid
+    testTempInit_ReadDataNoRemelt_OffGrid();
+    testTempInit_ReadDataRemelt();
+    testTempInit_ReadDataRemelt_Streamed();
+    testTempInit_SpotRemelt();
+    testSpotArrayProvider();
+    testTempInit_Raster();
 }
 TEST(TEST_CATEGORY, nuclei_init_test) {
     // w/ and w/o remelting
@@ -186,11 +186,15 @@ void testGhostNodes1D() {
             }
         });
 
-    // Perform halo exchange in 1D
+    // Perform halo exchange in 1D using persistent requests
+    std::vector<MPI_Request> SendRequests, RecvRequests;
+    InitHaloRequests(NeighborRank_North, NeighborRank_South, BufferNorthSend, BufferSouthSend, BufferNorthRecv,
+                     BufferSouthRecv, BufSizeX, BufSizeZ, SendRequests, RecvRequests);
     GhostNodes1D(0, 0, NeighborRank_North, NeighborRank_South, MyXSlices, MyYSlices, MyYOffset, NeighborX, NeighborY,
                  NeighborZ, CellType, DOCenter, GrainID, GrainUnitVector, DiagonalLength, CritDiagonalLength,
                  NGrainOrientations, BufferNorthSend, BufferSouthSend, BufferNorthRecv, BufferSouthRecv, BufSizeX,
-                 BufSizeZ, ZBound_Low);
+                 BufSizeZ, ZBound_Low, 0, MyXSlices, 0, MyYSlices, SendRequests, RecvRequests);
+    FreeHaloRequests(SendRequests, RecvRequests);
 
     // Copy CellType, GrainID, DiagonalLength, DOCenter, CritDiagonalLength views to host to check values
     CellType_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), CellType);
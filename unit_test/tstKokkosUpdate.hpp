@@ -94,7 +94,7 @@ void testNucleation() {
     for (int cycle = 0; cycle < 10; cycle++) {
         Nucleation(cycle, SuccessfulNucEvents_ThisRank, NucleationCounter, PossibleNuclei_ThisRankThisLayer,
                    NucleationTimes_Host, NucleiLocation, NucleiGrainID, CellType, GrainID, ZBound_Low, nx, MyYSlices,
-                   SteeringVector, numSteer);
+                   0, nx, 0, MyYSlices, SteeringVector, numSteer);
     }
 
     // Copy CellType, SteeringVector, numSteer, GrainID back to host to check nucleation results
@@ -215,13 +215,21 @@ void testFillSteeringVector_Remelt() {
     ViewF UndercoolingChange = Kokkos::create_mirror_view_and_copy(device_memory_space(), UndercoolingChange_Host);
     ViewF UndercoolingCurrent = Kokkos::create_mirror_view_and_copy(device_memory_space(), UndercoolingCurrent_Host);
 
+    // Tile map for the active domain, initialized with the starting cell states
+    ViewI LayerID(Kokkos::ViewAllocateWithoutInitializing("LayerID"), 0);
+    ViewI TileWakeTime(Kokkos::ViewAllocateWithoutInitializing("TileWakeTime"), 0);
+    ResetTileWakeTimes(nx, MyYSlices, nzActive, TileWakeTime);
+    UpdateTileWakeTimes(0, nx, MyYSlices, nzActive, 0, nx, 0, MyYSlices, ZBound_Low, 0, true, CellType, CritTimeStep,
+                        MeltTimeStep, LayerID, TileWakeTime);
+
     int numcycles = 15;
     for (int cycle = 1; cycle <= numcycles; cycle++) {
         // Update cell types, local undercooling each time step, and fill the steering vector
         FillSteeringVector_Remelt(cycle, LocalActiveDomainSize, nx, MyYSlices, NeighborX, NeighborY, NeighborZ,
                                   CritTimeStep, UndercoolingCurrent, UndercoolingChange, CellType, GrainID, ZBound_Low,
-                                  nzActive, SteeringVector, numSteer, numSteer_Host, MeltTimeStep, BufSizeX,
-                                  AtNorthBoundary, AtSouthBoundary, BufferNorthSend, BufferSouthSend);
+                                  nzActive, 0, nx, 0, MyYSlices, SteeringVector, numSteer, numSteer_Host, MeltTimeStep,
+                                  BufSizeX, AtNorthBoundary, AtSouthBoundary, BufferNorthSend, BufferSouthSend,
+                                  TileWakeTime);
     }
 
     // Copy CellType, SteeringVector, numSteer, UndercoolingCurrent, Buffers back to host to check steering vector
@@ -422,12 +430,78 @@ void testcreateNewOctahedron() {
     }
 }
 
+void testUpdateTileWakeTimes() {
+
+    // Active domain spanning 2 tiles in each direction, with partially filled tiles at the upper X and Y edges
+    int nx = 12;
+    int MyYSlices = 10;
+    int nzActive = 16;
+    int ZBound_Low = 1;
+    int nz = nzActive + ZBound_Low;
+    int LocalDomainSize = nx * MyYSlices * nz;
+    int NumTiles = calcNumTiles(nx) * calcNumTiles(MyYSlices) * calcNumTiles(nzActive);
+    EXPECT_EQ(NumTiles, 8);
+
+    // Each active region cell should belong to exactly one tile
+    ViewI_H TileCellCount_Host("TileCellCount_Host", nx * MyYSlices * nzActive);
+    for (int TileIndex = 0; TileIndex < NumTiles; TileIndex++) {
+        for (int n = 0; n < TileVolume; n++) {
+            int RankX, RankY, RankZ;
+            if (getTileCellCoordinates(TileIndex, n, nx, MyYSlices, nzActive, RankX, RankY, RankZ))
+                TileCellCount_Host(RankZ * nx * MyYSlices + RankX * MyYSlices + RankY)++;
+        }
+    }
+    for (int i = 0; i < nx * MyYSlices * nzActive; i++)
+        EXPECT_EQ(TileCellCount_Host(i), 1);
+
+    // Cells in the lower half of the active region are solid, cells in the upper half are TempSolid and melt at a time
+    // step depending on their X and Y coordinates
+    ViewI_H CellType_Host(Kokkos::ViewAllocateWithoutInitializing("CellType_Host"), LocalDomainSize);
+    ViewI_H MeltTimeStep_Host(Kokkos::ViewAllocateWithoutInitializing("MeltTimeStep_Host"), LocalDomainSize);
+    ViewI_H CritTimeStep_Host(Kokkos::ViewAllocateWithoutInitializing("CritTimeStep_Host"), LocalDomainSize);
+    for (int i = 0; i < LocalDomainSize; i++) {
+        int GlobalZ = i / (nx * MyYSlices);
+        int Rem = i % (nx * MyYSlices);
+        int RankX = Rem / MyYSlices;
+        int RankY = Rem % MyYSlices;
+        if (GlobalZ < ZBound_Low + TileSize)
+            CellType_Host(i) = Solid;
+        else
+            CellType_Host(i) = TempSolid;
+        MeltTimeStep_Host(i) = 10 + RankX + 2 * RankY;
+        CritTimeStep_Host(i) = MeltTimeStep_Host(i) + 5;
+    }
+    ViewI CellType = Kokkos::create_mirror_view_and_copy(device_memory_space(), CellType_Host);
+    ViewI MeltTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), MeltTimeStep_Host);
+    ViewI CritTimeStep = Kokkos::create_mirror_view_and_copy(device_memory_space(), CritTimeStep_Host);
+    ViewI LayerID(Kokkos::ViewAllocateWithoutInitializing("LayerID"), 0);
+
+    ViewI TileWakeTime(Kokkos::ViewAllocateWithoutInitializing("TileWakeTime"), 0);
+    ResetTileWakeTimes(nx, MyYSlices, nzActive, TileWakeTime);
+    UpdateTileWakeTimes(0, nx, MyYSlices, nzActive, 0, nx, 0, MyYSlices, ZBound_Low, 0, true, CellType, CritTimeStep,
+                        MeltTimeStep, LayerID, TileWakeTime);
+    ViewI_H TileWakeTime_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), TileWakeTime);
+    ASSERT_EQ(static_cast<int>(TileWakeTime_Host.extent(0)), NumTiles);
+
+    // Tiles containing only solid cells are finished, other tiles wake up when their first cell melts
+    for (int TileIndex = 0; TileIndex < NumTiles; TileIndex++) {
+        int TileZ = TileIndex / 4;
+        int TileX = (TileIndex % 4) / 2;
+        int TileY = TileIndex % 2;
+        if (TileZ == 0)
+            EXPECT_EQ(TileWakeTime_Host(TileIndex), INT_MAX);
+        else
+            EXPECT_EQ(TileWakeTime_Host(TileIndex), 10 + TileSize * TileX + 2 * TileSize * TileY);
+    }
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
 TEST(TEST_CATEGORY, cell_update_tests) {
     testNucleation();
     testFillSteeringVector_Remelt();
+    testUpdateTileWakeTimes();
     testcalcCritDiagonalLength();
     testcreateNewOctahedron();
 }